@@ -0,0 +1,26 @@
+#pragma once
+
+#include "serenity-engine/core/asset_archive.hpp"
+
+namespace serenity::asset
+{
+    struct PackedFile
+    {
+        // Path of the file in the archive (relative to the root directory, the path used to load the file at runtime).
+        std::string path{};
+
+        // Path of the file on disk (relative to the root directory or absolute).
+        std::string source_path{};
+
+        // Files that are used directly from the archive mapping (for ex. cooked models) should not be compressed, and
+        // compressing already compressed formats (png / jpg) is not worth it.
+        bool allow_compression{true};
+    };
+
+    // A utility namespace for the offline step that packs files into an asset archive (see core::AssetArchive).
+    namespace AssetPacker
+    {
+        // Files are only stored compressed if compression saves at least 1/8th of the size.
+        void pack_assets(const std::string_view archive_path, const std::span<const PackedFile> files);
+    } // namespace AssetPacker
+} // namespace serenity::asset
\ No newline at end of file
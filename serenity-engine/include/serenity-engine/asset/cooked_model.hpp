@@ -0,0 +1,240 @@
+#pragma once
+
+#include "mesh_optimizer.hpp"
+#include "texture_loader.hpp"
+
+#include "serenity-engine/core/file_system.hpp"
+
+namespace serenity::asset
+{
+    // A cooked model (.smesh file) is a versioned binary representation of the data in ModelData, produced offline by
+    // the ModelCooker. The vertex / index streams are stored exactly as they are laid out in the scene resources
+    // (math::XMFLOAT3 positions and normals, math::XMFLOAT2 texture coords and uint16_t / uint32_t indices), so at
+    // runtime the file is memory mapped and the streams are used directly, with no parsing and no intermediate copies.
+    // The indices of each mesh (and its levels of detail) are stored in the 16 bit or 32 bit index stream, depending on
+    // the mesh's index format.
+    //
+    // File layout (each section starts at a COOKED_MODEL_SECTION_ALIGNMENT aligned offset) :
+    // [CookedModelHeader] [CookedMesh x mesh_count] [CookedMeshLod x lod_count] [CookedMaterial x material_count]
+    // [CookedTexture x texture_count] [positions] [normals] [texture coords] [16 bit indices] [32 bit indices]
+    // [meshlets] [meshlet vertices] [meshlet triangles] [texture data]
+
+    static constexpr uint32_t COOKED_MODEL_MAGIC = 0x48534D53u; // 'SMSH'.
+    static constexpr uint32_t COOKED_MODEL_VERSION = 9u;
+    static constexpr uint64_t COOKED_MODEL_SECTION_ALIGNMENT = 16u;
+
+    struct CookedModelHeader
+    {
+        uint32_t magic{COOKED_MODEL_MAGIC};
+        uint32_t version{COOKED_MODEL_VERSION};
+
+        uint32_t mesh_count{};
+        uint32_t material_count{};
+        uint32_t lod_count{};
+        uint32_t texture_count{};
+
+        uint64_t vertex_count{};
+        uint64_t index_count{};
+        uint64_t index_32_count{};
+
+        uint64_t meshlet_count{};
+        uint64_t meshlet_vertex_count{};
+        uint64_t meshlet_triangle_count{};
+
+        // Byte offsets of each section from the start of the file.
+        uint64_t meshes_offset{};
+        uint64_t lods_offset{};
+        uint64_t materials_offset{};
+        uint64_t textures_offset{};
+        uint64_t positions_offset{};
+        uint64_t normals_offset{};
+        uint64_t texture_coords_offset{};
+        uint64_t indices_offset{};
+        uint64_t indices_32_offset{};
+        uint64_t meshlets_offset{};
+        uint64_t meshlet_vertices_offset{};
+        uint64_t meshlet_triangles_offset{};
+        uint64_t texture_data_offset{};
+        uint64_t texture_data_size{};
+    };
+
+    struct CookedMesh
+    {
+        // Offsets are in elements, into the model's vertex / index streams (the index stream of index_format).
+        uint32_t vertex_offset{};
+        uint32_t vertex_count{};
+        uint32_t index_offset{};
+        uint32_t index_count{};
+
+        uint32_t material_index{};
+
+        // Offsets are in elements, into the model's meshlet / meshlet vertex / meshlet triangle streams. The offsets
+        // stored in the meshlets themselves are relative to the mesh's ranges.
+        uint32_t meshlet_offset{};
+        uint32_t meshlet_count{};
+        uint32_t meshlet_vertex_offset{};
+        uint32_t meshlet_vertex_count{};
+        uint32_t meshlet_triangle_offset{};
+        uint32_t meshlet_triangle_count{};
+
+        // Offset into the model's LOD table.
+        uint32_t lod_offset{};
+        uint32_t lod_count{};
+
+        IndexFormat index_format{};
+        uint32_t padding[2]{};
+
+        math::XMFLOAT4 bounding_sphere{};
+        math::XMFLOAT3 bounding_box_min{};
+        math::XMFLOAT3 bounding_box_max{};
+
+        math::XMFLOAT4X4 mesh_local_transform_matrix{};
+        math::XMFLOAT4X4 inverse_mesh_local_transform_matrix{};
+    };
+
+    // The indices of each level of detail are stored in the index stream of its mesh (after the indices of all meshes).
+    struct CookedMeshLod
+    {
+        uint32_t index_offset{};
+        uint32_t index_count{};
+
+        float error{};
+        uint32_t padding{};
+    };
+
+    // Texture (R8G8B8A8, or block compressed) in the texture data section. The texture data contains mip_levels levels,
+    // laid out as in TextureData.
+    struct CookedTexture
+    {
+        Uint2 dimension{};
+        uint64_t offset{};
+        uint64_t size{};
+        uint32_t mip_levels{1u};
+        TextureCompression compression{TextureCompression::None};
+    };
+
+    struct CookedMaterial
+    {
+        math::XMFLOAT4 base_color{};
+        math::XMFLOAT2 metallic_roughness_factor{};
+        float normal_scale{1.0f};
+        float occlusion_strength{1.0f};
+        math::XMFLOAT3 emissive_factor{};
+        uint32_t padding{};
+
+        math::XMFLOAT4 texture_coord_transform{1.0f, 1.0f, 0.0f, 0.0f};
+
+        // Indices into the textures (indexed by MaterialTextureType), or INVALID_INDEX_U32 if the material does not
+        // have the texture.
+        std::array<uint32_t, MATERIAL_TEXTURE_TYPE_COUNT> texture_indices{INVALID_INDEX_U32, INVALID_INDEX_U32,
+                                                                          INVALID_INDEX_U32, INVALID_INDEX_U32};
+    };
+
+    static_assert(sizeof(CookedModelHeader) == 184u && std::is_trivially_copyable_v<CookedModelHeader>);
+    static_assert(sizeof(CookedMesh) == 232u && std::is_trivially_copyable_v<CookedMesh>);
+    static_assert(sizeof(CookedMeshLod) == 16u && std::is_trivially_copyable_v<CookedMeshLod>);
+    static_assert(sizeof(CookedTexture) == 32u && std::is_trivially_copyable_v<CookedTexture>);
+    static_assert(sizeof(CookedMaterial) == 80u && std::is_trivially_copyable_v<CookedMaterial>);
+
+    // Read only view over a memory mapped cooked model file (or a cooked model in a mounted asset archive).
+    class CookedModel
+    {
+      public:
+        explicit CookedModel(const std::string_view cooked_model_path);
+
+        const CookedModelHeader &get_header() const
+        {
+            return *reinterpret_cast<const CookedModelHeader *>(m_file.get_data());
+        }
+
+        std::span<const CookedMesh> get_meshes() const
+        {
+            return m_file.get_span<CookedMesh>(get_header().meshes_offset, get_header().mesh_count);
+        }
+
+        std::span<const CookedMeshLod> get_lods(const CookedMesh &mesh) const
+        {
+            return m_file.get_span<CookedMeshLod>(get_header().lods_offset, get_header().lod_count)
+                .subspan(mesh.lod_offset, mesh.lod_count);
+        }
+
+        std::span<const CookedMaterial> get_materials() const
+        {
+            return m_file.get_span<CookedMaterial>(get_header().materials_offset, get_header().material_count);
+        }
+
+        std::span<const math::XMFLOAT3> get_positions(const CookedMesh &mesh) const
+        {
+            return m_file.get_span<math::XMFLOAT3>(get_header().positions_offset, get_header().vertex_count)
+                .subspan(mesh.vertex_offset, mesh.vertex_count);
+        }
+
+        std::span<const math::XMFLOAT3> get_normals(const CookedMesh &mesh) const
+        {
+            return m_file.get_span<math::XMFLOAT3>(get_header().normals_offset, get_header().vertex_count)
+                .subspan(mesh.vertex_offset, mesh.vertex_count);
+        }
+
+        std::span<const math::XMFLOAT2> get_texture_coords(const CookedMesh &mesh) const
+        {
+            return m_file.get_span<math::XMFLOAT2>(get_header().texture_coords_offset, get_header().vertex_count)
+                .subspan(mesh.vertex_offset, mesh.vertex_count);
+        }
+
+        IndicesView get_indices(const CookedMesh &mesh) const
+        {
+            return get_indices(mesh.index_format, mesh.index_offset, mesh.index_count);
+        }
+
+        IndicesView get_lod_indices(const CookedMesh &mesh, const CookedMeshLod &lod) const
+        {
+            return get_indices(mesh.index_format, lod.index_offset, lod.index_count);
+        }
+
+        std::span<const Meshlet> get_meshlets(const CookedMesh &mesh) const
+        {
+            return m_file.get_span<Meshlet>(get_header().meshlets_offset, get_header().meshlet_count)
+                .subspan(mesh.meshlet_offset, mesh.meshlet_count);
+        }
+
+        std::span<const uint32_t> get_meshlet_vertices(const CookedMesh &mesh) const
+        {
+            return m_file.get_span<uint32_t>(get_header().meshlet_vertices_offset, get_header().meshlet_vertex_count)
+                .subspan(mesh.meshlet_vertex_offset, mesh.meshlet_vertex_count);
+        }
+
+        std::span<const uint32_t> get_meshlet_triangles(const CookedMesh &mesh) const
+        {
+            return m_file
+                .get_span<uint32_t>(get_header().meshlet_triangles_offset, get_header().meshlet_triangle_count)
+                .subspan(mesh.meshlet_triangle_offset, mesh.meshlet_triangle_count);
+        }
+
+        std::span<const CookedTexture> get_textures() const
+        {
+            return m_file.get_span<CookedTexture>(get_header().textures_offset, get_header().texture_count);
+        }
+
+        std::span<const std::byte> get_texture_data(const CookedTexture &texture) const
+        {
+            return m_file.get_span<std::byte>(get_header().texture_data_offset + texture.offset, texture.size);
+        }
+
+      private:
+        IndicesView get_indices(const IndexFormat index_format, const uint32_t index_offset,
+                                const uint32_t index_count) const
+        {
+            if (index_format == IndexFormat::Uint32)
+            {
+                return m_file.get_span<uint32_t>(get_header().indices_32_offset, get_header().index_32_count)
+                    .subspan(index_offset, index_count);
+            }
+
+            return m_file.get_span<uint16_t>(get_header().indices_offset, get_header().index_count)
+                .subspan(index_offset, index_count);
+        }
+
+      private:
+        core::FileView m_file{};
+    };
+} // namespace serenity::asset
\ No newline at end of file
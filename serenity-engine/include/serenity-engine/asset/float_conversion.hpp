@@ -0,0 +1,33 @@
+#pragma once
+
+namespace serenity::asset
+{
+    // A utility namespace for converting 32 bit floats into the smaller float formats used by vertex streams and HDR
+    // textures. Conversions round to nearest even.
+    // Formats :
+    // Half : 1 sign, 5 exponent and 10 mantissa bits (DXGI_FORMAT_R16_FLOAT).
+    // R11G11B10 : 3 unsigned floats (5 exponent bits and 6 / 6 / 5 mantissa bits) packed into 32 bits, R in the lowest
+    // bits (DXGI_FORMAT_R11G11B10_FLOAT).
+    // Reference :
+    // https://learn.microsoft.com/en-us/windows/win32/direct3d10/d3d10-graphics-programming-guide-resources-float-rules
+    namespace FloatConversion
+    {
+        [[nodiscard]] uint16_t convert_float_to_half(const float value);
+
+        [[nodiscard]] float convert_half_to_float(const uint16_t value);
+
+        // Convert source.size() floats, 8 at a time using F16C or SSE2 when available. Destination must be at least as
+        // large as source.
+        void convert_floats_to_halves(const std::span<const float> source, const std::span<uint16_t> destination);
+
+        // Negative values and NaN's are converted to zero, and values that are too large (including infinity) are
+        // clamped to the largest finite value, as the packed format has no sign bit and HDR textures should not
+        // contain infinities.
+        [[nodiscard]] uint32_t pack_r11g11b10(const float r, const float g, const float b);
+
+        // Convert texels with num_channels (at least 3) floats each into packed R11G11B10 values. Channels other than
+        // the first 3 are dropped. Destination must have space for source.size() / num_channels texels.
+        void convert_texels_to_r11g11b10(const std::span<const float> source, const uint32_t num_channels,
+                                         const std::span<uint32_t> destination);
+    } // namespace FloatConversion
+} // namespace serenity::asset
\ No newline at end of file
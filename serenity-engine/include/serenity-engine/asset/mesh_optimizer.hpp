@@ -0,0 +1,147 @@
+#pragma once
+
+namespace serenity::asset
+{
+    struct MeshData;
+
+    // Post transform vertex cache efficiency of an index buffer.
+    struct VertexCacheStatistics
+    {
+        // Average cache miss ratio, i.e number of vertices transformed per triangle (lower is better, 0.5 is ideal).
+        float acmr{};
+
+        // Average transformed vertex ratio, i.e number of vertices transformed per vertex (1.0 is ideal).
+        float atvr{};
+    };
+
+    // A small cluster of triangles of a mesh, with bounds that allow the whole cluster to be culled at once.
+    // The layout matches interop::MeshletBuffer.
+    struct Meshlet
+    {
+        // Offsets into the meshlet vertex / triangle streams of the mesh (MeshletData).
+        uint32_t vertex_offset{};
+        uint32_t triangle_offset{};
+        uint32_t vertex_count{};
+        uint32_t triangle_count{};
+
+        // Bounding sphere of the meshlet in mesh local space.
+        math::XMFLOAT3 center{};
+        float radius{};
+
+        // Normal cone of the meshlet. All triangles are back facing (and the meshlet can be culled) if
+        // dot(normalize(cone_apex - camera_position), cone_axis) >= cone_cutoff. A cone_cutoff of 1 means the
+        // meshlet can never be cone culled.
+        math::XMFLOAT3 cone_axis{};
+        float cone_cutoff{1.0f};
+
+        math::XMFLOAT3 cone_apex{};
+        float padding{};
+    };
+
+    struct MeshletData
+    {
+        std::vector<Meshlet> meshlets{};
+
+        // Indices (into the vertex streams of the mesh) of the vertices used by each meshlet.
+        std::vector<uint32_t> vertices{};
+
+        // Triangles of each meshlet, as three 8 bit indices into the meshlet's vertices packed into a uint32_t
+        // (first index in the lowest byte).
+        std::vector<uint32_t> triangles{};
+    };
+
+    static_assert(sizeof(Meshlet) == 64u && std::is_trivially_copyable_v<Meshlet>);
+
+    // Width of the indices of a mesh (and its levels of detail) in cooked models and on the GPU. Meshes are processed
+    // with 32 bit indices, but use the narrowest width that can index all of their vertices once they are stored /
+    // uploaded, as most meshes have few enough vertices for 16 bit indices.
+    enum class IndexFormat : uint32_t
+    {
+        Uint16,
+        Uint32,
+    };
+
+    inline IndexFormat get_index_format(const size_t vertex_count)
+    {
+        return vertex_count <= size_t{std::numeric_limits<uint16_t>::max()} + 1u ? IndexFormat::Uint16
+                                                                                 : IndexFormat::Uint32;
+    }
+
+    // Non owning view over indices of either width.
+    using IndicesView = std::variant<std::span<const uint16_t>, std::span<const uint32_t>>;
+
+    // A simplified version (level of detail) of a mesh. The indices reference the vertices of the full detail mesh.
+    struct MeshLod
+    {
+        std::vector<uint32_t> indices{};
+
+        // Geometric error of the simplified mesh, i.e (approximately) how far the surface deviates from the full detail
+        // mesh, in mesh local units.
+        float error{};
+    };
+
+    // A utility namespace for import time mesh optimizations.
+    // The optimizations only reorder data (the rendered result is identical), but improve GPU efficiency. Since the
+    // vertex shaders pull vertex attributes from separate structured buffers, fetch locality matters as much as the
+    // post transform vertex cache.
+    namespace MeshOptimizer
+    {
+        // Size of the (FIFO) post transform vertex cache that the optimizations and statistics assume.
+        static constexpr uint32_t VERTEX_CACHE_SIZE = 16u;
+
+        [[nodiscard]] VertexCacheStatistics get_vertex_cache_statistics(const std::span<const uint32_t> indices,
+                                                                        const size_t vertex_count);
+
+        // Reorder the triangles for post transform vertex cache reuse.
+        // Reference : Fast Triangle Reordering for Vertex Locality and Reduced Overdraw (Sander et.al), i.e Tipsify.
+        void optimize_vertex_cache(std::span<uint32_t> indices, const size_t vertex_count);
+
+        // Reorder clusters of triangles (as produced by optimize_vertex_cache, the clusters are split where the cache
+        // locality breaks) so that clusters on the outside of the mesh that face outward are drawn first. This reduces
+        // overdraw from most view points while only adding a few cache misses at the cluster boundaries.
+        // Reference : Fast Triangle Reordering for Vertex Locality and Reduced Overdraw (Sander et.al).
+        void optimize_overdraw(std::span<uint32_t> indices, const std::span<const math::XMFLOAT3> positions);
+
+        // Split the mesh into meshlets with at most max_vertices vertices and max_triangles triangles. Triangles are
+        // consumed in index buffer order, so the index buffer is expected to be optimized for vertex cache (which
+        // makes consecutive triangles share vertices).
+        [[nodiscard]] MeshletData build_meshlets(const std::span<const uint32_t> indices,
+                                                 const std::span<const math::XMFLOAT3> positions,
+                                                 const uint32_t max_vertices = 64u,
+                                                 const uint32_t max_triangles = 124u);
+
+        // Simplify the mesh (using quadric error metrics, reference : Surface Simplification Using Quadric Error
+        // Metrics (Garland et.al)) until it has at most target_index_count indices, or until the next simplification
+        // step would exceed max_error (in mesh local units). Vertices on mesh borders and attribute seams (i.e vertices
+        // that share their position with other vertices) are locked, and the cost of each edge collapse includes the
+        // difference in normals and texture coords, so that texture / shading discontinuities are preserved.
+        [[nodiscard]] MeshLod simplify(const std::span<const uint32_t> indices,
+                                       const std::span<const math::XMFLOAT3> positions,
+                                       const std::span<const math::XMFLOAT3> normals,
+                                       const std::span<const math::XMFLOAT2> texture_coords,
+                                       const size_t target_index_count, const float max_error);
+
+        // Generate a chain of (up to max_lod_count) levels of detail, where each level has roughly triangle_ratio times
+        // the triangles of the previous level. max_error is relative to the extent of the mesh. Generation stops early
+        // once the mesh cannot be simplified further within the error limit. The index buffer of each level is
+        // optimized for the vertex cache.
+        [[nodiscard]] std::vector<MeshLod> generate_lods(const std::span<const uint32_t> indices,
+                                                         const std::span<const math::XMFLOAT3> positions,
+                                                         const std::span<const math::XMFLOAT3> normals,
+                                                         const std::span<const math::XMFLOAT2> texture_coords,
+                                                         const uint32_t max_lod_count, const float triangle_ratio,
+                                                         const float max_error);
+
+        // Returns true if the meshlet is entirely back facing from the given camera position.
+        [[nodiscard]] bool is_meshlet_back_facing(const Meshlet &meshlet, const math::XMFLOAT3 camera_position);
+
+        // Returns true if the bounding sphere of the meshlet is outside the given planes (for ex. frustum planes).
+        // Planes are of the form (normal, distance), with the normals pointing inwards.
+        [[nodiscard]] bool is_meshlet_outside_planes(const Meshlet &meshlet,
+                                                     const std::span<const math::XMFLOAT4> planes);
+
+        // Reorder the vertices of the mesh in the order they are first referenced by the index buffer (and remove
+        // vertices that are not referenced), so that vertex attribute fetches are mostly sequential.
+        void optimize_vertex_fetch(MeshData &mesh_data);
+    } // namespace MeshOptimizer
+} // namespace serenity::asset
\ No newline at end of file
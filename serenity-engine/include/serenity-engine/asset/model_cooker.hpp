@@ -0,0 +1,19 @@
+#pragma once
+
+#include "cooked_model.hpp"
+#include "model_loader.hpp"
+
+namespace serenity::asset
+{
+    // A utility namespace for the offline 'cook' step, which converts models (gltf / glb) into cooked models (.smesh).
+    // Cooked models can be loaded at runtime (see CookedModel) without any parsing.
+    namespace ModelCooker
+    {
+        // Load the model from the given path and write it out as a cooked model.
+        void cook_model(const std::string_view model_path, const std::string_view cooked_model_path,
+                        const ModelImportConfig &import_config = {});
+
+        // Write already loaded model data out as a cooked model.
+        void write_cooked_model(const ModelData &model_data, const std::string_view cooked_model_path);
+    } // namespace ModelCooker
+} // namespace serenity::asset
\ No newline at end of file
@@ -1,6 +1,11 @@
 #pragma once
 
+#include "cooked_model.hpp"
+#include "mesh_optimizer.hpp"
 #include "texture_loader.hpp"
+#include "vertex_quantization.hpp"
+
+#include "serenity-engine/core/async_file_loader.hpp"
 
 namespace serenity::asset
 {
@@ -12,25 +17,98 @@ namespace serenity::asset
         std::vector<math::XMFLOAT3> normals{};
         std::vector<math::XMFLOAT2> texture_coords{};
 
-        std::vector<uint16_t> indices{};
+        std::vector<uint32_t> indices{};
+
+        // Narrowest index width for the (optimized) vertex count of the mesh, used when the mesh is cooked / uploaded.
+        IndexFormat index_format{};
 
         math::XMMATRIX mesh_local_transform_matrix{};
         math::XMMATRIX inverse_mesh_local_transform_matrix{};
 
         uint32_t material_index{};
+
+        // Bounding sphere (center in xyz, radius in w) and axis aligned bounding box in mesh local space.
+        math::XMFLOAT4 bounding_sphere{};
+        math::XMFLOAT3 bounding_box_min{};
+        math::XMFLOAT3 bounding_box_max{};
+
+        MeshletData meshlet_data{};
+
+        // Simplified versions of the mesh, from most to least detailed (the full detail mesh is not included).
+        std::vector<MeshLod> lods{};
+
+        // Compressed vertex streams (in the same vertex order as the float streams). Empty unless the model was
+        // imported with quantize_vertices.
+        QuantizedVertexData quantized_vertex_data{};
     };
 
     struct MaterialData
     {
         math::XMFLOAT4 base_color{};
         math::XMFLOAT2 metallic_roughness_factor{};
-        TextureData base_color_texture{};
+        math::XMFLOAT3 emissive_factor{};
+        float normal_scale{1.0f};
+        float occlusion_strength{1.0f};
+
+        // Scale (xy) and offset (zw) applied to the texture coords when sampling the textures of the material. For
+        // materials whose textures are in a texture atlas, this maps the texture coords into the material's rect.
+        math::XMFLOAT4 texture_coord_transform{1.0f, 1.0f, 0.0f, 0.0f};
+
+        // Indices into ModelData::textures (indexed by MaterialTextureType), or INVALID_INDEX_U32 if the material does
+        // not have the texture.
+        std::array<uint32_t, MATERIAL_TEXTURE_TYPE_COUNT> texture_indices{INVALID_INDEX_U32, INVALID_INDEX_U32,
+                                                                          INVALID_INDEX_U32, INVALID_INDEX_U32};
     };
 
     struct ModelData
     {
         std::vector<MeshData> mesh_data{};
         std::vector<MaterialData> material_data{};
+
+        // Textures of the materials (including the texture atlases). Textures that are shared by materials are only
+        // present once.
+        std::vector<TextureData> textures{};
+    };
+
+    // Import time processing that is applied to the meshes of a model.
+    // The defaults are meant for runtime imports, so processing that is expensive at import time is disabled by
+    // default. serenity-cooker enables it for cooked models.
+    struct ModelImportConfig
+    {
+        bool optimize_vertex_cache{true};
+        bool optimize_overdraw{false};
+        bool optimize_vertex_fetch{true};
+
+        bool generate_meshlets{false};
+        uint32_t max_meshlet_vertices{64u};
+        uint32_t max_meshlet_triangles{124u};
+
+        // Each level of detail has roughly lod_triangle_ratio times the triangles of the previous level. The maximum
+        // error is relative to the mesh extent.
+        bool generate_lods{false};
+        uint32_t max_lod_count{4u};
+        float lod_triangle_ratio{0.5f};
+        float max_lod_error{0.05f};
+
+        // Generate the compressed vertex streams. Positions, normals and texture coords stored as 8 / 16 bit integers
+        // (KHR_mesh_quantization) are used as is rather than being quantized again.
+        bool quantize_vertices{false};
+
+        // Block compression format of the material textures (which are always loaded with the full mip chain). Normal
+        // maps only use two channels, and have a separate format. Compressed textures are cached on disk, see
+        // TextureLoader::load_compressed_texture. Compressing a texture the first time it is loaded is slow, so
+        // runtime imports load the textures uncompressed (serenity-cooker uses BC7 / BC5).
+        TextureCompression texture_compression{TextureCompression::None};
+        TextureCompression normal_texture_compression{TextureCompression::None};
+
+        // Pack the textures of materials whose textures all have the same dimension (no larger than
+        // max_atlas_texture_dimension) into texture atlases, see TextureAtlas. Atlas textures only have
+        // log2(texture_atlas_padding) + 1 mip levels. Packing copies all texels of the packed textures, so only cooked
+        // models use texture atlases.
+        bool generate_texture_atlases{false};
+        uint32_t max_atlas_texture_dimension{256u};
+        uint32_t texture_atlas_dimension{2048u};
+        uint32_t texture_atlas_padding{8u};
     };
 
     namespace ModelLoader
@@ -40,6 +118,37 @@ namespace serenity::asset
         // here). This design is taken so as to reduce dependency between the process of loading GLTF files and actually
         // constructing data from them.
         // Model loader currently uses fastgltf.
-        [[nodiscard]] ModelData load_model(const std::string_view model_path);
+        [[nodiscard]] ModelData load_model(const std::string_view model_path,
+                                           const ModelImportConfig &import_config = {});
+
+        // Load a model from the contents of the gltf / glb file (which are already in memory). The model path is used
+        // to locate the external buffers / images of gltf files (these are still read from disk).
+        [[nodiscard]] ModelData load_model(const std::span<const std::byte> file_data,
+                                           const std::string_view model_path,
+                                           const ModelImportConfig &import_config = {});
+
+        // Returns the (absolute) paths of all files the model is loaded from : the gltf / glb file itself (always the
+        // first element), followed by the external buffers and images it references. Only the gltf json is parsed.
+        [[nodiscard]] std::vector<std::string> get_model_dependencies(const std::string_view model_path);
+
+        // Returns a reference counted model that is shared between all callers that load the same model.
+        // Models are keyed by their canonical path (and for self contained glb files, by the hash of the file contents
+        // as well), so the gltf file is parsed only once no matter how many game objects / scenes use it. The model
+        // is freed once the last reference to it is released. Models loaded with import configs that differ in any
+        // setting are cached separately. If the model is currently being loaded asynchronously (see load_model_async),
+        // this waits for that load to complete.
+        [[nodiscard]] std::shared_ptr<const ModelData> load_shared_model(const std::string_view model_path,
+                                                                         const ModelImportConfig &import_config = {});
+
+        // Asynchronous version of load_shared_model. The model file is read on the IO thread and parsed on the job
+        // system, and the returned handle becomes ready once the model is loaded (the handle of a model that is
+        // already loaded is ready immediately). Requesting a model that is still being loaded returns the handle of
+        // the pending load.
+        [[nodiscard]] core::AsyncHandle<ModelData> load_model_async(const std::string_view model_path,
+                                                                    const ModelImportConfig &import_config = {});
+
+        // Returns a reference counted cooked model (.smesh) that is shared between all callers that load the same
+        // cooked model. Cooked models are keyed by their canonical path. Can be called from any thread.
+        [[nodiscard]] std::shared_ptr<const CookedModel> load_shared_cooked_model(const std::string_view model_path);
     } // namespace ModelLoader
 } // namespace serenity::asset
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "texture_loader.hpp"
+
+namespace serenity::asset
+{
+    // Placement of a texture in a texture atlas. Position is the top left texel of the texture (the gutter around the
+    // texture is outside of the rect).
+    struct TextureAtlasRect
+    {
+        uint32_t page_index{};
+        Uint2 position{};
+        Uint2 dimension{};
+    };
+
+    // A utility namespace for packing small textures into texture atlases (pages of a fixed dimension), so that they
+    // can share a single GPU texture.
+    // Rects are packed with the skyline bottom left heuristic, tallest rects first. Each texture is surrounded by a
+    // gutter of padding texels, filled with the texels of the opposite edge of the texture (i.e as with wrap
+    // addressing), so that filtering and repeating texture coords do not bleed in texels of neighbouring textures.
+    // Rects (including the gutter) are aligned to padding texels, which keeps the gutter intact in the first
+    // log2(padding) + 1 mip levels : atlas textures only have these mip levels.
+    // Reference : https://github.com/juj/RectangleBinPack (A Thousand Ways to Pack the Bin).
+    namespace TextureAtlas
+    {
+        // Padding must be a power of 2 that is at least 4 (so that rects are aligned to 4x4 BC blocks). Returns the
+        // rect of each texture (in the same order as dimensions). Textures are placed on the first page they fit in,
+        // and pages are added as needed.
+        [[nodiscard]] std::vector<TextureAtlasRect> pack_rects(const std::span<const Uint2> dimensions,
+                                                              const Uint2 atlas_dimension, const uint32_t padding);
+
+        // Number of pages used by the rects.
+        [[nodiscard]] uint32_t get_page_count(const std::span<const TextureAtlasRect> rects);
+
+        [[nodiscard]] uint32_t get_atlas_mip_level_count(const Uint2 atlas_dimension, const uint32_t padding);
+
+        // Create the texture (4 channels, 8 bit, get_atlas_mip_level_count levels) of an atlas page from the textures
+        // (4 channels, 8 bit, only the base level is used) of the rects on the page. The texture of a rect can be null,
+        // in which case the rect is left black.
+        [[nodiscard]] TextureData create_atlas_texture(const std::span<const TextureAtlasRect> rects,
+                                                       const std::span<const TextureData *const> textures,
+                                                       const uint32_t page_index, const Uint2 atlas_dimension,
+                                                       const uint32_t padding, const bool is_srgb);
+    } // namespace TextureAtlas
+} // namespace serenity::asset
\ No newline at end of file
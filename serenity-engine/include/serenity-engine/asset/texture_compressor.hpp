@@ -0,0 +1,36 @@
+#pragma once
+
+#include "texture_loader.hpp"
+
+namespace serenity::asset
+{
+    // A utility namespace for compressing textures into the BCn block compression formats on the CPU.
+    // Each 4x4 block of texels is compressed independently (blocks that extend past the texture edge replicate the
+    // edge texels), and the blocks of each mip level are compressed in parallel using the job system.
+    // Formats :
+    // BC1 : RGB (alpha is ignored), 8 bytes per block.
+    // BC3 : RGBA (BC1 color + BC4 alpha), 16 bytes per block.
+    // BC5 : RG (two BC4 channels), 16 bytes per block. Meant for normal maps.
+    // BC7 : RGBA, 16 bytes per block. Only mode 6 (a single RGBA line with 16 interpolated values) is used.
+    // Reference : https://learn.microsoft.com/en-us/windows/win32/direct3d11/texture-block-compression-in-direct3d-11.
+    namespace TextureCompressor
+    {
+        // Version of the encoders. Must be incremented when the encoded output changes, so that cached textures are
+        // compressed again.
+        static constexpr uint32_t ENCODER_VERSION = 1u;
+
+        [[nodiscard]] uint32_t get_bytes_per_block(const TextureCompression compression);
+
+        // Block compressed textures must have a base level dimension that is a multiple of 4.
+        [[nodiscard]] bool can_compress(const Uint2 dimension);
+
+        // Size in bytes of the first mip_levels levels of a block compressed texture.
+        [[nodiscard]] size_t get_compressed_size(const Uint2 dimension, const uint32_t mip_levels,
+                                                 const TextureCompression compression);
+
+        // Compress all mip levels of a 4 channel, 8 bit texture. The compression is done in the color space of the
+        // texture, so the result should be sampled with the matching (_SRGB or not) format.
+        [[nodiscard]] TextureData compress_texture(const TextureData &texture_data,
+                                                   const TextureCompression compression);
+    } // namespace TextureCompressor
+} // namespace serenity::asset
\ No newline at end of file
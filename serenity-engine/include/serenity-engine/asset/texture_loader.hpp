@@ -1,11 +1,79 @@
 #pragma once
 
+#include "serenity-engine/core/async_file_loader.hpp"
+
 namespace serenity::asset
 {
+    // Block compression format of texture data. For block compressed textures, each mip level is stored as rows of
+    // 4x4 texel blocks (see TextureCompressor).
+    enum class TextureCompression : uint32_t
+    {
+        None,
+        BC1,
+        BC3,
+        BC5,
+        BC7,
+    };
+
+    // Textures of a (gltf metallic roughness) material.
+    enum class MaterialTextureType : uint32_t
+    {
+        BaseColor,
+
+        // Tangent space normals in RG (B is reconstructed in the shader).
+        Normal,
+
+        // Occlusion (R), roughness (G) and metallic (B) packed into a single texture. Roughness / metallic are in the
+        // same channels as in gltf metallic roughness textures.
+        OcclusionRoughnessMetallic,
+
+        Emissive,
+    };
+
+    static constexpr uint32_t MATERIAL_TEXTURE_TYPE_COUNT = 4u;
+
+    // The color textures (base color and emissive) are sRGB.
+    inline bool is_material_texture_srgb(const MaterialTextureType texture_type)
+    {
+        return texture_type == MaterialTextureType::BaseColor || texture_type == MaterialTextureType::Emissive;
+    }
+
+    // Storage format of float (HDR) textures.
+    enum class FloatTextureFormat : uint32_t
+    {
+        // 32 bit float per channel (std::vector<float>).
+        Float32,
+
+        // 16 bit half float per channel, 4 channels (std::vector<uint16_t>, DXGI_FORMAT_R16G16B16A16_FLOAT).
+        Float16,
+
+        // Packed unsigned floats, one uint32_t per texel (std::vector<uint32_t>, DXGI_FORMAT_R11G11B10_FLOAT). Alpha is
+        // dropped and negative values are clamped to zero.
+        R11G11B10,
+    };
+
     struct TextureData
     {
         Uint2 dimension{};
-        std::variant<std::vector<uint8_t>, std::vector<float>> data{};
+        uint32_t num_channels{4u};
+
+        // The data has mip_levels levels, starting from the base level, tightly packed one after the other. The
+        // dimension of mip level i is max(dimension >> i, 1).
+        uint32_t mip_levels{1u};
+
+        TextureCompression compression{TextureCompression::None};
+
+        // 8 bit textures use uint8_t's, float textures use the type of their FloatTextureFormat.
+        std::variant<std::vector<uint8_t>, std::vector<float>, std::vector<uint16_t>, std::vector<uint32_t>> data{};
+    };
+
+    // A channel of a packed texture (see TextureLoader::load_packed_texture) : channel source_channel of the image file
+    // contents in data, or fill_value if data is empty.
+    struct TextureChannelSource
+    {
+        std::span<const std::byte> data{};
+        uint32_t source_channel{};
+        uint8_t fill_value{255u};
     };
 
     // A utility namespace that helps in loading texture from file.
@@ -15,12 +83,87 @@ namespace serenity::asset
 
     namespace TextureLoader
     {
+        // Relative to the root directory.
+        static constexpr std::string_view TEXTURE_CACHE_DIRECTORY = "data/cache/textures";
+
         // Load data from file on disk and the texture path is known.
-        [[nodiscard]] TextureData load_texture(const std::string_view texture_path, const uint32_t num_channels = 4u);
+        // If generate_mips is true, the full mip chain is generated (see generate_mip_chain). Textures with the .hdr /
+        // .exr extension are loaded as 32 bit float textures (see load_hdr_texture), ignoring num_channels.
+        [[nodiscard]] TextureData load_texture(const std::string_view texture_path, const uint32_t num_channels = 4u,
+                                               const bool generate_mips = false, const bool is_srgb = false);
 
         // Load data which is in memory.
         // Internally uses stbi_load_from_memory.
         [[nodiscard]] TextureData load_texture(const std::byte *data, const uint32_t size,
-                                               const uint32_t num_channels = 4u);
+                                               const uint32_t num_channels = 4u, const bool generate_mips = false,
+                                               const bool is_srgb = false);
+
+        // Returns the dimension of the texture without decoding it (or 0 x 0 if the data is not a supported image).
+        [[nodiscard]] Uint2 get_texture_dimension(const std::byte *data, const uint32_t size);
+
+        // Decode the texture (base level only) directly into destination, which can be any caller provided memory (for
+        // ex. a mapped upload buffer) of at least dimension.x * dimension.y * num_channels bytes (see
+        // get_texture_dimension). Rows are tightly packed. Returns the dimension of the texture.
+        [[nodiscard]] Uint2 decode_texture(const std::byte *data, const uint32_t size, const uint32_t num_channels,
+                                           const std::span<uint8_t> destination);
+
+        // Load a float (HDR) texture with 4 channels (alpha is 1 if the file has no alpha channel). Supported files are
+        // Radiance .hdr files (through stbi) and single part scanline OpenEXR files (uncompressed, RLE, ZIPS or ZIP
+        // compressed, with half / float / uint channels). The mip chain (if generate_mips is true) is generated in
+        // float precision, before the texture is converted to the given format.
+        [[nodiscard]] TextureData load_hdr_texture(const std::string_view texture_path,
+                                                   const FloatTextureFormat format = FloatTextureFormat::Float32,
+                                                   const bool generate_mips = false);
+
+        [[nodiscard]] TextureData load_hdr_texture(const std::byte *data, const uint32_t size,
+                                                   const FloatTextureFormat format = FloatTextureFormat::Float32,
+                                                   const bool generate_mips = false);
+
+        // Convert the (32 bit float, all mip levels) data of a float texture into the given format. Half floats use the
+        // SIMD conversion (see FloatConversion), and the texture is converted in parallel using the job system.
+        void convert_float_texture(TextureData &texture_data, const FloatTextureFormat format);
+
+        // Asynchronous version of load_texture. The texture file is read on the IO thread and decoded on the job
+        // system.
+        [[nodiscard]] core::AsyncHandle<TextureData> load_texture_async(const std::string_view texture_path,
+                                                                        const uint32_t num_channels = 4u,
+                                                                        const bool generate_mips = false,
+                                                                        const bool is_srgb = false);
+
+        // Load a 4 channel texture with the full mip chain, block compressed to the given format. Compressed textures
+        // are cached on disk (in TEXTURE_CACHE_DIRECTORY), keyed by the hash of the source file contents and the
+        // compression settings, so each image is only compressed once. Textures that cannot be block compressed
+        // (dimension not a multiple of 4) are returned uncompressed.
+        [[nodiscard]] TextureData load_compressed_texture(const std::string_view texture_path,
+                                                          const TextureCompression compression, const bool is_srgb);
+
+        [[nodiscard]] TextureData load_compressed_texture(const std::byte *data, const uint32_t size,
+                                                          const TextureCompression compression, const bool is_srgb);
+
+        // Load a (linear) 4 channel texture with the full mip chain, where each channel is taken from a channel of a
+        // source image, block compressed to the given format and cached as in load_compressed_texture. Sources that are
+        // smaller than the largest source are upscaled (nearest texel). Each distinct source image is decoded once.
+        // Returns an empty texture (dimension 0 x 0) if no channel has a source image.
+        [[nodiscard]] TextureData load_packed_texture(const std::span<const TextureChannelSource, 4u> channel_sources,
+                                                      const TextureCompression compression);
+
+        // Path of the file in TEXTURE_CACHE_DIRECTORY that load_compressed_texture uses for the given source image file
+        // contents and compression settings (the file only exists once the texture has been compressed).
+        [[nodiscard]] std::string get_cached_texture_path(const std::span<const std::byte> source_data,
+                                                          const TextureCompression compression, const bool is_srgb);
+
+        // Number of levels in a full mip chain (i.e down to 1x1).
+        [[nodiscard]] uint32_t get_mip_level_count(const Uint2 dimension);
+
+        [[nodiscard]] Uint2 get_mip_dimension(const Uint2 dimension, const uint32_t mip_level);
+
+        // Number of texels in the first mip_levels levels of the mip chain.
+        [[nodiscard]] size_t get_mip_chain_texel_count(const Uint2 dimension, const uint32_t mip_levels);
+
+        // Replace the texture data (which must only have the base level, and be 8 bit or 32 bit float) with the full
+        // mip chain. Each level is generated from the previous level with a 2x2 box filter. Filtering is done in linear
+        // space : if is_srgb is true, the color channels (all channels except the fourth, i.e alpha) are converted from
+        // sRGB to linear before filtering and back to sRGB after. Rows are filtered in parallel using the job system.
+        void generate_mip_chain(TextureData &texture_data, const bool is_srgb);
     } // namespace TextureLoader
 } // namespace serenity::asset
\ No newline at end of file
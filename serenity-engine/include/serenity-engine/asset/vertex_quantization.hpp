@@ -0,0 +1,90 @@
+#pragma once
+
+namespace serenity::asset
+{
+    // Position quantized to 16 bit unsigned integers, relative to the bounding box of the mesh. Padded to 8 bytes so
+    // that the shaders can read it as a uint2.
+    struct QuantizedPosition
+    {
+        uint16_t x{};
+        uint16_t y{};
+        uint16_t z{};
+        uint16_t padding{};
+    };
+
+    static_assert(sizeof(QuantizedPosition) == 8u && std::is_trivially_copyable_v<QuantizedPosition>);
+
+    // Encoding of the quantized normals. Normals that are stored as 8 / 16 bit snorm values in the gltf file
+    // (KHR_mesh_quantization) are kept in their source precision rather than being octahedral encoded.
+    enum class NormalEncoding : uint32_t
+    {
+        // Two 16 bit snorm values (octahedral encoding, x in the lower 16 bits). One uint32_t per vertex.
+        Octahedral,
+        // x, y and z as 8 bit snorm values (from the lowest byte, the highest byte is unused). One uint32_t per vertex.
+        Snorm8,
+        // x, y (in the first uint32_t) and z (in the lower 16 bits of the second uint32_t) as 16 bit snorm values. Two
+        // uint32_t's per vertex.
+        Snorm16,
+    };
+
+    // Encoding of the quantized texture coords (first component in the lower 16 bits for both). Texture coords that
+    // are stored as 8 / 16 bit integers in the gltf file map exactly onto 16 bit unsigned integers, so they are kept in
+    // their source precision.
+    enum class TextureCoordEncoding : uint32_t
+    {
+        Half,
+        Unorm16,
+    };
+
+    // Compressed vertex streams of a mesh (12 bytes per vertex instead of 32 bytes for the float streams, 16 bytes if
+    // the normals are 16 bit snorm values).
+    struct QuantizedVertexData
+    {
+        std::vector<QuantizedPosition> positions{};
+        std::vector<uint32_t> normals{};
+        std::vector<uint32_t> texture_coords{};
+
+        // position = position_dequantization_offset + quantized position * position_dequantization_scale.
+        math::XMFLOAT3 position_dequantization_offset{};
+        math::XMFLOAT3 position_dequantization_scale{};
+
+        NormalEncoding normal_encoding{NormalEncoding::Octahedral};
+
+        // For 16 bit unorm texture coords, texture coord = texture_coord_dequantization_offset + quantized texture
+        // coord * texture_coord_dequantization_scale.
+        TextureCoordEncoding texture_coord_encoding{TextureCoordEncoding::Half};
+        math::XMFLOAT2 texture_coord_dequantization_offset{};
+        math::XMFLOAT2 texture_coord_dequantization_scale{};
+    };
+
+    // A utility namespace for encoding vertex attributes into the compressed vertex layout.
+    // The decode functions matching these encodings are in shaders/utils.hlsli.
+    namespace VertexQuantization
+    {
+        // Quantize all vertex streams. Positions are quantized relative to the bounding box of the positions.
+        [[nodiscard]] QuantizedVertexData quantize_vertices(const std::span<const math::XMFLOAT3> positions,
+                                                            const std::span<const math::XMFLOAT3> normals,
+                                                            const std::span<const math::XMFLOAT2> texture_coords);
+
+        // Dequantization offset / scale that map the 16 bit range onto the bounding box of the positions.
+        [[nodiscard]] std::pair<math::XMFLOAT3, math::XMFLOAT3> get_position_dequantization(
+            const std::span<const math::XMFLOAT3> positions);
+
+        // Quantize positions as round((position - offset) / scale), clamped to the 16 bit range.
+        [[nodiscard]] std::vector<QuantizedPosition> quantize_positions(const std::span<const math::XMFLOAT3> positions,
+                                                                        const math::XMFLOAT3 offset,
+                                                                        const math::XMFLOAT3 scale);
+
+        // Number of uint32_t's per vertex in the quantized normal stream.
+        constexpr size_t get_normal_stride(const NormalEncoding normal_encoding)
+        {
+            return normal_encoding == NormalEncoding::Snorm16 ? 2u : 1u;
+        }
+
+        // Reference : A Survey of Efficient Representations for Independent Unit Vectors (Cigolle et.al).
+        [[nodiscard]] std::vector<uint32_t> encode_octahedral_normals(const std::span<const math::XMFLOAT3> normals);
+
+        [[nodiscard]] std::vector<uint32_t> encode_half_texture_coords(
+            const std::span<const math::XMFLOAT2> texture_coords);
+    } // namespace VertexQuantization
+} // namespace serenity::asset
\ No newline at end of file
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "async_file_loader.hpp"
 #include "file_system.hpp"
 #include "input.hpp"
+#include "job_system.hpp"
 #include "log.hpp"
 
 #include "serenity-engine/scene/scene_manager.hpp"
@@ -51,6 +53,8 @@ namespace serenity::core
       private:
         std::unique_ptr<Log> m_log{};
         std::unique_ptr<FileSystem> m_file_system{};
+        std::unique_ptr<JobSystem> m_job_system{};
+        std::unique_ptr<AsyncFileLoader> m_async_file_loader{};
 
         std::unique_ptr<renderer::Renderer> m_renderer{};
 
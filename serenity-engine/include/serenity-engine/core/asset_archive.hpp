@@ -0,0 +1,99 @@
+#pragma once
+
+#include "memory_mapped_file.hpp"
+
+namespace serenity::core
+{
+    // An asset archive (.spak file) packs many asset files into a single file, so that opening assets costs a lookup
+    // in the (memory mapped) table of contents instead of a file open + read per asset. Archives are written offline
+    // by the AssetPacker (see serenity-cooker), and are mounted into the FileSystem at runtime.
+    //
+    // File layout :
+    // [AssetArchiveHeader] [AssetArchiveEntry x entry_count (sorted by path)] [paths] [file data]
+    // The data of each file starts at a ASSET_ARCHIVE_DATA_ALIGNMENT aligned offset, so files that are stored
+    // uncompressed (for ex. cooked models and block compressed textures) can be used / uploaded to the GPU directly
+    // from the mapping. Other files can be compressed (LZ4) individually.
+
+    static constexpr uint32_t ASSET_ARCHIVE_MAGIC = 0x4B415053u; // 'SPAK'.
+    static constexpr uint32_t ASSET_ARCHIVE_VERSION = 1u;
+
+    // Matches D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT (the required alignment of texture data in upload buffers).
+    static constexpr uint64_t ASSET_ARCHIVE_DATA_ALIGNMENT = 512u;
+
+    enum class ArchiveCompression : uint32_t
+    {
+        None,
+        Lz4,
+    };
+
+    struct AssetArchiveHeader
+    {
+        uint32_t magic{ASSET_ARCHIVE_MAGIC};
+        uint32_t version{ASSET_ARCHIVE_VERSION};
+
+        uint32_t entry_count{};
+        uint32_t padding{};
+
+        // Byte offsets from the start of the file.
+        uint64_t entries_offset{};
+        uint64_t paths_offset{};
+        uint64_t paths_size{};
+    };
+
+    struct AssetArchiveEntry
+    {
+        // The path (relative to the root directory, with '/' as separator) is stored in the paths section.
+        uint64_t path_offset{};
+        uint32_t path_size{};
+
+        ArchiveCompression compression{ArchiveCompression::None};
+
+        // Byte offset from the start of the file, stored (possibly compressed) size and the uncompressed size.
+        uint64_t data_offset{};
+        uint64_t stored_size{};
+        uint64_t size{};
+    };
+
+    static_assert(sizeof(AssetArchiveHeader) == 40u && std::is_trivially_copyable_v<AssetArchiveHeader>);
+    static_assert(sizeof(AssetArchiveEntry) == 40u && std::is_trivially_copyable_v<AssetArchiveEntry>);
+
+    // Read only view over a memory mapped asset archive.
+    class AssetArchive
+    {
+      public:
+        explicit AssetArchive(const std::string_view archive_path);
+
+        const AssetArchiveHeader &get_header() const
+        {
+            return *reinterpret_cast<const AssetArchiveHeader *>(m_file.get_data());
+        }
+
+        std::span<const AssetArchiveEntry> get_entries() const
+        {
+            return m_file.get_span<AssetArchiveEntry>(get_header().entries_offset, get_header().entry_count);
+        }
+
+        std::string_view get_path(const AssetArchiveEntry &entry) const
+        {
+            return {reinterpret_cast<const char *>(m_file.get_data() + get_header().paths_offset + entry.path_offset),
+                    entry.path_size};
+        }
+
+        // Returns nullptr if the archive has no file with the given path (relative to the root directory).
+        const AssetArchiveEntry *find_entry(const std::string_view path) const;
+
+        // The data of the file as stored in the archive (i.e compressed, if the entry is compressed).
+        std::span<const std::byte> get_stored_data(const AssetArchiveEntry &entry) const
+        {
+            return m_file.get_span<std::byte>(entry.data_offset, entry.stored_size);
+        }
+
+        // Decompress (or copy, if the entry is not compressed) the data of the file into destination, which must be
+        // entry.size bytes.
+        void read(const AssetArchiveEntry &entry, const std::span<std::byte> destination) const;
+
+      private:
+        std::string m_archive_path{};
+        MemoryMappedFile m_file{};
+    };
+} // namespace serenity::core
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "file_system.hpp"
+#include "job_system.hpp"
+#include "singleton_instance.hpp"
+
+namespace serenity::core
+{
+    // Handle to the result of an asynchronous load. Handles are cheap to copy, and all copies refer to the same
+    // result. The result is shared (and immutable) so that multiple users of the same asset do not have to copy it.
+    template <typename T>
+    class AsyncHandle
+    {
+      public:
+        AsyncHandle() = default;
+        explicit AsyncHandle(std::shared_future<std::shared_ptr<const T>> future) : m_future(std::move(future)) {}
+
+        // Create a handle that is already ready.
+        explicit AsyncHandle(std::shared_ptr<const T> value)
+        {
+            auto promise = std::promise<std::shared_ptr<const T>>{};
+            promise.set_value(std::move(value));
+
+            m_future = promise.get_future().share();
+        }
+
+        bool is_valid() const { return m_future.valid(); }
+
+        // Non blocking, returns true if the load has completed (either successfully or with an exception).
+        bool is_ready() const
+        {
+            return m_future.valid() && m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        // Blocks until the load is complete. If the load failed, the exception is rethrown here.
+        std::shared_ptr<const T> get() const { return m_future.get(); }
+
+      private:
+        std::shared_future<std::shared_ptr<const T>> m_future{};
+    };
+
+    // A singleton class that loads files asynchronously. Files are mapped (see FileSystem::map_file) and paged in on a
+    // dedicated IO thread (so that the IO latency does not block the worker threads), and the file contents are then
+    // processed (i.e decoded) by a job on the job system, directly from the mapping.
+    // Instance of async file loader will be created by engine (after the job system), no need to manually define it.
+    class AsyncFileLoader final : public SingletonInstance<AsyncFileLoader>
+    {
+      public:
+        explicit AsyncFileLoader();
+        ~AsyncFileLoader();
+
+        // Read the file at path (relative to the root directory or absolute) on the IO thread, and then call
+        // process(file) on the job system. The handle is ready once process returns. If the file could not be read or
+        // process throws, the exception is rethrown by AsyncHandle::get.
+        template <typename T>
+        AsyncHandle<T> load(const std::string_view path,
+                            std::function<std::shared_ptr<const T>(const FileView &file)> process);
+
+      private:
+        // Called on the job system with the file contents, or with the exception that occured while reading the file.
+        using ReadCallback = std::function<void(const FileView &file, std::exception_ptr exception)>;
+
+        struct ReadRequest
+        {
+            std::string path{};
+            ReadCallback callback{};
+        };
+
+        void add_read_request(const std::string_view path, ReadCallback callback);
+
+        void io_thread_function();
+
+      private:
+        AsyncFileLoader(const AsyncFileLoader &other) = delete;
+        AsyncFileLoader &operator=(const AsyncFileLoader &other) = delete;
+
+        AsyncFileLoader(AsyncFileLoader &&other) = delete;
+        AsyncFileLoader &operator=(AsyncFileLoader &&other) = delete;
+
+      private:
+        std::thread m_io_thread{};
+
+        std::mutex m_read_request_mutex{};
+        std::condition_variable m_read_request_condition_variable{};
+        std::deque<ReadRequest> m_read_requests{};
+
+        // Tracks the jobs processing the file contents, so that the destructor can wait for them to complete.
+        JobCounter m_job_counter{};
+
+        bool m_quit{false};
+    };
+
+    template <typename T>
+    inline AsyncHandle<T> AsyncFileLoader::load(const std::string_view path,
+                                                std::function<std::shared_ptr<const T>(const FileView &file)> process)
+    {
+        auto promise = std::make_shared<std::promise<std::shared_ptr<const T>>>();
+        auto handle = AsyncHandle<T>(promise->get_future().share());
+
+        add_read_request(path, [promise, process = std::move(process)](const FileView &file,
+                                                                       std::exception_ptr exception) {
+            if (!exception)
+            {
+                try
+                {
+                    promise->set_value(process(file));
+                    return;
+                }
+                catch (...)
+                {
+                    exception = std::current_exception();
+                }
+            }
+
+            promise->set_exception(exception);
+        });
+
+        return handle;
+    }
+} // namespace serenity::core
\ No newline at end of file
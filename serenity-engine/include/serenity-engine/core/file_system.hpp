@@ -1,11 +1,46 @@
 #pragma once
 
+#include "asset_archive.hpp"
 #include "singleton_instance.hpp"
 
 #include "serenity-engine/utils/string_conversions.hpp"
 
 namespace serenity::core
 {
+    // Read only contents of a file opened with FileSystem::map_file. The contents are either a view into a mounted
+    // asset archive (no copies), decompressed from an asset archive, or a memory mapped loose file.
+    class FileView
+    {
+      public:
+        FileView() = default;
+
+        bool is_valid() const { return m_data.data() != nullptr; }
+
+        const std::byte *get_data() const { return m_data.data(); }
+        size_t get_size() const { return m_data.size(); }
+
+        std::span<const std::byte> get_span() const { return m_data; }
+
+        // Number of bytes that can be read from get_data(). For memory mapped loose files, this includes the remainder
+        // of the last page of the mapping (which is zero filled, see MemoryMappedFile).
+        size_t get_readable_size() const { return m_file.is_valid() ? m_file.get_mapped_size() : m_data.size(); }
+
+        template <typename T>
+        std::span<const T> get_span(const size_t byte_offset, const size_t count) const
+        {
+            return {reinterpret_cast<const T *>(m_data.data() + byte_offset), count};
+        }
+
+      private:
+        friend class FileSystem;
+
+        std::span<const std::byte> m_data{};
+
+        // Only one of these owns the data (if the data is not a view into a mounted archive).
+        std::vector<std::byte> m_decompressed_data{};
+        MemoryMappedFile m_file{};
+    };
+
     // A singleton class primarily used to get root source directory / absolute paths (with respect to main partition,
     // such as C://).
     // note(rtarun9) : Instance of file system will be created by engine, no need to manually define it. The
@@ -15,6 +50,9 @@ namespace serenity::core
     class FileSystem final : public SingletonInstance<FileSystem>
     {
       public:
+        // If present, the archive is mounted by the engine at startup (it is written by serenity-cooker --pack).
+        static constexpr std::string_view ASSET_ARCHIVE_PATH = "data/assets.spak";
+
         explicit FileSystem();
         ~FileSystem() = default;
 
@@ -44,9 +82,26 @@ namespace serenity::core
             return string_to_wstring(m_root_directory) + std::wstring(path);
         }
 
+        // Mount an asset archive. Files in mounted archives take precedence over loose files with the same path
+        // (relative to the root directory), and archives mounted later take precedence over archives mounted earlier.
+        // Mounting is not thread safe, archives should be mounted before any assets are loaded.
+        void mount_archive(const std::string_view archive_path);
+
+        // Open the file (from a mounted archive or from disk) for reading. The returned view is invalid if the file
+        // does not exist.
+        FileView map_file(const std::string_view path) const;
+
+        // Returns true if the file exists in a mounted archive or on disk.
+        bool exists(const std::string_view path) const;
+
         std::string read_file(const std::string_view path) const;
         void write_to_file(const std::string_view path, const std::string_view buffer) const;
 
+      private:
+        // Returns the archive entry for the file (and the archive it is in), if the file is in a mounted archive.
+        std::pair<const AssetArchive *, const AssetArchiveEntry *> find_archive_entry(
+            const std::string_view path) const;
+
       private:
         FileSystem(const FileSystem &other) = delete;
         FileSystem &operator=(const FileSystem &other) = delete;
@@ -56,5 +111,7 @@ namespace serenity::core
 
       private:
         std::string m_root_directory{};
+
+        std::vector<std::unique_ptr<AssetArchive>> m_archives{};
     };
 } // namespace serenity::core
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "singleton_instance.hpp"
+
+namespace serenity::core
+{
+    // Tracks the number of outstanding jobs in a group of jobs (i.e acts as a wait group).
+    // JobSystem::wait(counter) blocks until all jobs scheduled with the counter have completed.
+    class JobCounter
+    {
+      public:
+        JobCounter() = default;
+
+        bool is_complete() const { return m_count.load(std::memory_order_acquire) == 0u; }
+
+      private:
+        JobCounter(const JobCounter &other) = delete;
+        JobCounter &operator=(const JobCounter &other) = delete;
+
+      private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_count{};
+
+        // The first exception thrown by any job of this counter. Rethrown by JobSystem::wait.
+        std::mutex m_exception_mutex{};
+        std::exception_ptr m_exception{};
+    };
+
+    struct Job
+    {
+        std::function<void()> function{};
+        JobCounter *counter{};
+    };
+
+    // Fixed size Chase-Lev work stealing deque.
+    // The owning thread pushes / pops jobs at the bottom (LIFO, which is cache friendly), while other threads steal
+    // from the top (FIFO).
+    // Reference : Correct and Efficient Work-Stealing for Weak Memory Models (Le et.al).
+    class WorkStealingQueue
+    {
+      public:
+        // Only to be called by the owning thread. Returns false if the queue is full.
+        bool push(Job *job);
+
+        // Only to be called by the owning thread.
+        Job *pop();
+
+        // Can be called by any thread.
+        Job *steal();
+
+      public:
+        static constexpr int64_t CAPACITY = 4096;
+
+      private:
+        alignas(64) std::atomic<int64_t> m_top{};
+        alignas(64) std::atomic<int64_t> m_bottom{};
+
+        std::array<std::atomic<Job *>, CAPACITY> m_jobs{};
+    };
+
+    // A singleton class that manages a pool of worker threads, which execute jobs scheduled by the engine.
+    // Each thread (the worker threads and the thread that creates the job system) has its own work stealing queue, and
+    // idle threads steal jobs from the other queues. Threads not owned by the job system can schedule jobs as well
+    // (these are placed in a shared queue).
+    // Threads waiting on a counter execute jobs while they wait, so waiting from within a job does not deadlock.
+    // Instance of job system will be created by engine, no need to manually define it.
+    class JobSystem final : public SingletonInstance<JobSystem>
+    {
+      public:
+        // If worker_thread_count is zero, hardware concurrency - 1 (but at least one) worker threads are created.
+        explicit JobSystem(const uint32_t worker_thread_count = 0u);
+        ~JobSystem();
+
+        // Number of threads executing jobs (worker threads + the thread that created the job system).
+        uint32_t get_thread_count() const { return static_cast<uint32_t>(m_queues.size()); }
+
+        void schedule(std::function<void()> job_function, JobCounter &counter);
+
+        // Blocks until all jobs associated with counter are complete. The calling thread executes jobs while
+        // waiting. If any of the jobs threw an exception, it is rethrown here.
+        void wait(JobCounter &counter);
+
+        // Calls function(index) for each index in [0, count), split into batches that are executed in parallel.
+        // If batch_size is zero, a batch size is chosen based on the number of threads.
+        template <typename Function>
+        void parallel_for(const size_t count, Function &&function, const size_t batch_size = 0u);
+
+        // Calls function(element, index) for each element of data in parallel.
+        template <typename T, typename Function>
+        void parallel_for(const std::span<T> data, Function &&function, const size_t batch_size = 0u);
+
+      private:
+        void worker_thread_function(const uint32_t thread_index);
+
+        // Get a job from (in order) the threads own queue, the shared queue, or by stealing from other threads.
+        Job *get_job(const uint32_t thread_index);
+
+        void execute_job(Job *job);
+
+        // Index of the calling thread into m_queues, or INVALID_INDEX_U32 for threads not owned by the job system.
+        uint32_t get_current_thread_index() const;
+
+      private:
+        JobSystem(const JobSystem &other) = delete;
+        JobSystem &operator=(const JobSystem &other) = delete;
+
+        JobSystem(JobSystem &&other) = delete;
+        JobSystem &operator=(JobSystem &&other) = delete;
+
+      private:
+        // Index 0 is the queue of the thread that created the job system, the rest are of the worker threads.
+        std::vector<std::unique_ptr<WorkStealingQueue>> m_queues{};
+        std::vector<std::thread> m_worker_threads{};
+
+        // Jobs scheduled by threads that are not owned by the job system.
+        std::mutex m_shared_queue_mutex{};
+        std::deque<Job *> m_shared_queue{};
+        std::atomic<uint32_t> m_shared_queue_job_count{};
+
+        // Idle worker threads sleep on the condition variable until jobs are scheduled.
+        std::mutex m_sleep_mutex{};
+        std::condition_variable m_sleep_condition_variable{};
+        std::atomic<uint32_t> m_pending_job_count{};
+        std::atomic<uint32_t> m_sleeping_thread_count{};
+
+        std::atomic<bool> m_quit{false};
+    };
+
+    template <typename Function>
+    inline void JobSystem::parallel_for(const size_t count, Function &&function, const size_t batch_size)
+    {
+        if (count == 0u)
+        {
+            return;
+        }
+
+        // By default, create a few batches per thread so that threads that finish early can steal remaining work.
+        const auto batch_count_per_thread = size_t{4u};
+        const auto parallel_for_batch_size =
+            batch_size != 0u ? batch_size : std::max<size_t>(count / (get_thread_count() * batch_count_per_thread), 1u);
+
+        auto counter = JobCounter{};
+
+        // The first batch is executed by the calling thread after the remaining batches are scheduled.
+        for (auto batch_start = parallel_for_batch_size; batch_start < count; batch_start += parallel_for_batch_size)
+        {
+            const auto batch_end = std::min(batch_start + parallel_for_batch_size, count);
+
+            schedule(
+                [&function, batch_start, batch_end]() {
+                    for (auto i = batch_start; i < batch_end; ++i)
+                    {
+                        function(i);
+                    }
+                },
+                counter);
+        }
+
+        auto exception = std::exception_ptr{};
+        try
+        {
+            for (auto i = size_t{0u}; i < std::min(parallel_for_batch_size, count); ++i)
+            {
+                function(i);
+            }
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        // The scheduled batches reference function, so they must complete before returning (even on exception).
+        wait(counter);
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    template <typename T, typename Function>
+    inline void JobSystem::parallel_for(const std::span<T> data, Function &&function, const size_t batch_size)
+    {
+        parallel_for(
+            data.size(), [&](const size_t index) { function(data[index], index); }, batch_size);
+    }
+} // namespace serenity::core
\ No newline at end of file
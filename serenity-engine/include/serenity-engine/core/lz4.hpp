@@ -0,0 +1,24 @@
+#pragma once
+
+namespace serenity::core
+{
+    // Compression / decompression of data in the LZ4 block format (without the LZ4 frame header). Decompression is
+    // very fast (a few GB/s) and only needs the destination buffer, which makes it a good fit for compressing assets
+    // in the asset archive.
+    // The compressor is a simple greedy compressor (single entry hash table), so the compression ratio is slightly
+    // worse than the reference LZ4 implementation. The output is a valid LZ4 block, so it can be decompressed by any
+    // LZ4 implementation.
+    // Reference : https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+    namespace Lz4
+    {
+        // Upper bound on the size of the compressed data (for incompressible data).
+        [[nodiscard]] size_t get_max_compressed_size(const size_t size);
+
+        [[nodiscard]] std::vector<std::byte> compress(const std::span<const std::byte> data);
+
+        // Decompress the block into destination, which must be exactly the size of the uncompressed data. Returns
+        // false if the compressed data is corrupt (the decompressor never reads / writes out of bounds).
+        [[nodiscard]] bool decompress(const std::span<const std::byte> compressed_data,
+                                      const std::span<std::byte> destination);
+    } // namespace Lz4
+} // namespace serenity::core
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+namespace serenity::core
+{
+    // RAII wrapper over a read only memory mapped file.
+    // The file contents can be accessed directly through the mapping, without reading the file into a buffer first.
+    // The OS zero fills the remainder of the last page of the mapping, so reading up to
+    // get_mapped_size() bytes (rather than get_size()) is valid.
+    class MemoryMappedFile
+    {
+      public:
+        MemoryMappedFile() = default;
+        explicit MemoryMappedFile(const std::string_view path);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(MemoryMappedFile &&other) noexcept;
+        MemoryMappedFile &operator=(MemoryMappedFile &&other) noexcept;
+
+        bool is_valid() const { return m_data != nullptr; }
+
+        const std::byte *get_data() const { return m_data; }
+        size_t get_size() const { return m_size; }
+
+        // Size of the mapping (file size rounded up to page size).
+        size_t get_mapped_size() const;
+
+        std::span<const std::byte> get_span() const { return {m_data, m_size}; }
+
+        template <typename T>
+        std::span<const T> get_span(const size_t byte_offset, const size_t count) const
+        {
+            return {reinterpret_cast<const T *>(m_data + byte_offset), count};
+        }
+
+      private:
+        void unmap();
+
+      private:
+        MemoryMappedFile(const MemoryMappedFile &other) = delete;
+        MemoryMappedFile &operator=(const MemoryMappedFile &other) = delete;
+
+      private:
+        const std::byte *m_data{};
+        size_t m_size{};
+
+#ifdef _WIN32
+        HANDLE m_file_handle{INVALID_HANDLE_VALUE};
+        HANDLE m_file_mapping_handle{};
+#endif
+    };
+} // namespace serenity::core
\ No newline at end of file
@@ -10,15 +10,24 @@ static constexpr bool SERENITY_DEBUG = false;
 // STL includes.
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <ranges>
 #include <source_location>
@@ -27,14 +36,21 @@ static constexpr bool SERENITY_DEBUG = false;
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
 using namespace std::string_literals;
 
 // D3D12 / Windows includes.
+// Only the core systems and the asset pipeline (serenity-engine-core, used by the asset cooker) are built on platforms
+// other than windows. There, DirectXMath is fetched as an external library.
+#ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 #include <DirectXMath.h>
@@ -42,6 +58,9 @@ using namespace std::string_literals;
 #include <d3d12.h>
 #include <dxgi1_6.h>
 #include <wrl.h>
+#else
+#include <DirectXMath.h>
+#endif
 
 namespace math = DirectX;
 
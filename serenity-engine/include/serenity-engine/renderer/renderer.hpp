@@ -10,6 +10,7 @@
 #include "serenity-engine/renderer/rhi/command_signature.hpp"
 #include "serenity-engine/renderer/rhi/device.hpp"
 #include "serenity-engine/renderer/shader_compiler.hpp"
+#include "serenity-engine/renderer/texture_residency_manager.hpp"
 #include "serenity-engine/window/window.hpp"
 
 namespace serenity::renderer
@@ -19,6 +20,10 @@ namespace serenity::renderer
     // so as to have minimum connect between the backend graphics api and the application (note that while the engine
     // will only support D3D12 for now, it is done as a learning exercise).
 
+    // Returns the data of a texture (all mip levels, in the layout expected by rhi::Device::create_texture), or nullptr
+    // if the data is no longer available. The returned pointer keeps the data alive while it is in use.
+    using TextureDataSource = std::function<std::shared_ptr<const std::byte>()>;
+
     class Renderer : public core::SingletonInstance<Renderer>
     {
       public:
@@ -49,21 +54,57 @@ namespace serenity::renderer
         template <typename T>
         uint32_t create_buffer(const rhi::BufferCreationDesc &buffer_creation_desc, const std::span<const T> data = {})
         {
+            if (!m_free_buffer_indices.empty())
+            {
+                const auto index = m_free_buffer_indices.back();
+                m_free_buffer_indices.pop_back();
+
+                m_allocated_buffers.at(index) = m_device->create_buffer(buffer_creation_desc, data);
+
+                return index;
+            }
+
             const auto index = m_allocated_buffers.size();
             m_allocated_buffers.emplace_back(m_device->create_buffer(buffer_creation_desc, data));
 
             return index;
         }
 
-        // Create GPU texture and return index to the created texture.
-        uint32_t create_texture(const rhi::TextureCreationDesc &texture_creation_desc, const std::byte *data = nullptr)
+        // The buffer is released once the GPU no longer uses it (see rhi::Device::release_resource), while the index
+        // can be reused by the next created buffer right away.
+        void destroy_buffer(const uint32_t index)
         {
-            const auto index = m_allocated_textures.size();
-            m_allocated_textures.emplace_back(m_device->create_texture(texture_creation_desc, data));
+            m_device->release_buffer(m_allocated_buffers.at(index));
+            m_free_buffer_indices.push_back(index);
+        }
 
-            return index;
+        TextureResidencyManager &get_texture_residency_manager() { return m_texture_residency_manager; }
+
+        // If texture streaming is enabled, textures with a data source are created with only their smallest mip levels
+        // resident, and the more detailed mip levels are streamed in (and dropped again) based on the resolution
+        // they are used at.
+        bool is_texture_streaming_enabled() const { return m_texture_streaming_enabled; }
+
+        void set_texture_streaming_enabled(const bool texture_streaming_enabled)
+        {
+            m_texture_streaming_enabled = texture_streaming_enabled;
         }
 
+        // Create GPU texture and return index to the created texture.
+        // If a texture data source is provided (only supported for non array shader resource textures), the texture
+        // can be (partially) evicted to keep the textures within the texture memory budget. Such textures must be
+        // marked as used in every frame they are used in, and are reloaded / streamed from the data source when used
+        // after being evicted. The srv index of such textures changes whenever their resident mip levels change, so it
+        // has to be read again (with get_texture_at_index) each frame.
+        uint32_t create_texture(const rhi::TextureCreationDesc &texture_creation_desc, const std::byte *data = nullptr,
+                                TextureDataSource texture_data_source = {});
+
+        // required_resolution is the number of texels (along the larger dimension of the texture) required to render
+        // the texture at its current screen size, which determines the mip levels that are streamed in. If a texture
+        // is used multiple times in a frame, the largest required resolution is used.
+        void mark_texture_as_used(const uint32_t index,
+                                  const float required_resolution = std::numeric_limits<float>::max());
+
         // Create a pipeline and return index to pipeline.
         uint32_t create_pipeline(const rhi::PipelineCreationDesc &pipeline_creation_desc)
         {
@@ -98,6 +139,14 @@ namespace serenity::renderer
         // Note : reloading of pipelines can ONLY occur at the end of the current frame.
         void reload_pipelines();
 
+        // Evict / stream textures as decided by the texture residency manager. Must be called before the commands for
+        // the current frame are recorded.
+        // The mip levels are uploaded on the copy queue without waiting for the upload, and the texture is switched
+        // over to them in the first frame after the upload has completed.
+        // Note : the data source has to keep all mip levels in CPU memory (for model textures, that is the model
+        // data), so streaming only reduces GPU memory usage.
+        void update_texture_residency();
+
       private:
         Renderer(const Renderer &other) = delete;
         Renderer &operator=(const Renderer &other) = delete;
@@ -108,6 +157,14 @@ namespace serenity::renderer
       public:
         static const uint32_t MAX_PRIMITIVE_COUNT = 1'00'00'000u;
 
+        static constexpr uint64_t DEFAULT_TEXTURE_MEMORY_BUDGET = 1024u * 1024u * 1024u;
+
+        // Size (in bytes) of the texture data uploaded by texture streaming per frame.
+        static constexpr uint64_t MAX_TEXTURE_STREAMING_SIZE_PER_FRAME = 32u * 1024u * 1024u;
+
+        // Streamed textures are created with the mip levels from the first one whose dimensions are at most this.
+        static constexpr uint32_t TEXTURE_STREAMING_INITIAL_MIP_DIMENSION = 64u;
+
       private:
         std::unique_ptr<rhi::Device> m_device{};
         std::unique_ptr<ShaderCompiler> m_shader_compiler{};
@@ -118,6 +175,33 @@ namespace serenity::renderer
         std::vector<rhi::Buffer> m_allocated_buffers{};
         std::vector<rhi::Texture> m_allocated_textures{};
 
+        // Indices of destroyed buffers, which are reused by create_buffer.
+        std::vector<uint32_t> m_free_buffer_indices{};
+
+        // Textures that can be evicted, by texture index.
+        struct EvictableTexture
+        {
+            rhi::TextureCreationDesc texture_creation_desc{};
+            TextureDataSource texture_data_source{};
+
+            // Number of mip levels tracked by the residency manager (see create_texture).
+            uint32_t residency_mip_count{};
+        };
+
+        std::unordered_map<uint32_t, EvictableTexture> m_evictable_textures{};
+
+        // Uploads of the mip levels of evictable textures that are still in progress, by texture index.
+        std::unordered_map<uint32_t, rhi::TextureUpload> m_pending_texture_uploads{};
+
+        // Textures used in the last FRAMES_IN_FLIGHT frames might still be in use by the GPU, so they are not evicted.
+        TextureResidencyManager m_texture_residency_manager{
+            DEFAULT_TEXTURE_MEMORY_BUDGET, rhi::Device::FRAMES_IN_FLIGHT, MAX_TEXTURE_STREAMING_SIZE_PER_FRAME};
+
+        bool m_texture_streaming_enabled{true};
+
+        // Number of frames rendered, used to track when textures were last used.
+        uint64_t m_frame_number{};
+
         // Renderer will hold a vector of pipelines so pipelines can be reloaded at runtime.
         // The application / game will only have a index to the pipeline in the vector. This might not be the most
         // scalable solution for the current state of engine is a good solution for convenience.
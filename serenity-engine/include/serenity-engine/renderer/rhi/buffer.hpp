@@ -60,6 +60,8 @@ namespace serenity::renderer::rhi
     {
         comptr<ID3D12Resource> resource{};
 
+        BufferUsage usage{};
+
         // Indices of the resource descriptor into the descriptor heap.
         uint32_t cbv_index{};
         uint32_t srv_index{};
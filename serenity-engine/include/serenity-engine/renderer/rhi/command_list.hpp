@@ -52,7 +52,7 @@ namespace serenity::renderer::rhi
 
         void set_primitive_topology(const D3D12_PRIMITIVE_TOPOLOGY primitive_topology) const;
 
-        void set_index_buffer(const Buffer &buffer) const;
+        void set_index_buffer(const Buffer &buffer, const DXGI_FORMAT format = DXGI_FORMAT_R16_UINT) const;
 
         void set_bindless_graphics_root_signature() const;
 
@@ -73,8 +73,9 @@ namespace serenity::renderer::rhi
         void dispatch(const Uint3 num_groups) const;
 
         // Common functions.
+        // argument_buffer_offset (in bytes) is the offset of the first command in the indirect argument buffer.
         void execute_indirect(rhi::CommandSignature &command_signature, const Buffer &indirect_argument_buffer,
-                              const uint32_t command_count) const;
+                              const uint32_t command_count, const uint64_t argument_buffer_offset = 0u) const;
 
       private:
         CommandList(const CommandList &other) = delete;
@@ -25,6 +25,9 @@ namespace serenity::renderer::rhi
         // be atleast equal to fence_value for this function to unblock the CPU thread).
         void wait_for_fence_value(const uint64_t fence_value);
 
+        // Returns the fence value the GPU has completed execution up to (without blocking).
+        uint64_t get_completed_value() const;
+
         // Wait for GPU to complete execution of all instructions given to it.
         // Returns updated value of the monotonically increasing fence value.
         uint64_t flush();
@@ -39,6 +39,13 @@ namespace serenity::renderer::rhi
 
         void offset_current_handle(const uint32_t offset = 1u);
 
+        // Allocate a single descriptor. Descriptors returned with free_descriptor are reused before the current handle
+        // is offset.
+        DescriptorHandle allocate_descriptor();
+
+        // The descriptor must no longer be in use by the GPU.
+        void free_descriptor(const uint32_t index);
+
       private:
         DescriptorHeap(const DescriptorHeap &other) = delete;
         DescriptorHeap &operator=(const DescriptorHeap &other) = delete;
@@ -54,5 +61,7 @@ namespace serenity::renderer::rhi
 
         DescriptorHandle m_descriptor_handle_for_start{};
         DescriptorHandle m_current_descriptor_handle{};
+
+        std::vector<uint32_t> m_free_descriptor_indices{};
     };
 } // namespace serenity::renderer::rhi
\ No newline at end of file
@@ -33,6 +33,8 @@ namespace serenity::renderer::rhi
 
         CommandQueue &get_direct_command_queue() { return *(m_direct_command_queue.get()); }
 
+        CommandQueue &get_copy_command_queue() { return *(m_copy_command_queue.get()); }
+
         uint64_t &get_frame_fence_value(const uint32_t frame_index) { return m_frame_fence_values.at(frame_index); }
 
         DescriptorHeap &get_cbv_srv_uav_descriptor_heap() const { return *(m_cbv_srv_uav_descriptor_heap.get()); }
@@ -59,9 +61,61 @@ namespace serenity::renderer::rhi
         [[nodiscard]] Texture create_texture(const TextureCreationDesc &texture_creation_desc,
                                              const std::byte *data = nullptr);
 
+        // Release the resource of a (non array) shader resource texture entirely, replacing its SRV with a null
+        // descriptor. The previous resource and SRV are released after FRAMES_IN_FLIGHT frames (see release_resource),
+        // and the texture gets a new srv index, which the caller has to use from then on.
+        void evict_texture(Texture &texture, const TextureCreationDesc &texture_creation_desc);
+
+        // Create a resource with only the mip levels from most_detailed_mip onwards of a (non array) shader resource
+        // texture, and upload them on the copy queue without waiting for the upload. data has the same layout as for
+        // create_texture (i.e has all mip levels), and is copied before this returns. Once the upload is complete (see
+        // is_texture_upload_complete), complete_texture_upload replaces the resource of the texture like
+        // evict_texture does. Uploads that are no longer needed are released with release_texture_upload.
+        [[nodiscard]] TextureUpload upload_texture_resident_mips(const TextureCreationDesc &texture_creation_desc,
+                                                                 const uint32_t most_detailed_mip,
+                                                                 const std::byte *data);
+
+        bool is_texture_upload_complete(const TextureUpload &texture_upload) const;
+
+        void complete_texture_upload(Texture &texture, TextureUpload &texture_upload);
+
+        void release_texture_upload(TextureUpload &texture_upload);
+
         [[nodiscard]] Pipeline create_pipeline(const PipelineCreationDesc &pipeline_creation_desc,
                                                const bool ignore_shader_errors = false);
 
+        // The resource (and the cbv / srv / uav descriptors at descriptor_indices) might still be used by the frames in
+        // flight, so they are only released (the descriptors are returned to the descriptor heap for reuse) once
+        // FRAMES_IN_FLIGHT frames have ended.
+        void release_resource(comptr<ID3D12Resource> resource, const std::span<const uint32_t> descriptor_indices = {});
+
+        // Release the buffer (see release_resource).
+        void release_buffer(Buffer &buffer);
+
+      private:
+        // Create the texture resource and upload the data (if not nullptr).
+        comptr<ID3D12Resource> create_texture_resource(const TextureCreationDesc &texture_creation_desc,
+                                                       const std::byte *data);
+
+        // Record the upload of the data into the texture resource, and return the upload buffer (which must be kept
+        // alive until the upload has completed).
+        comptr<ID3D12Resource> record_texture_upload(CommandList &command_list, ID3D12Resource *resource,
+                                                     const TextureCreationDesc &texture_creation_desc,
+                                                     const std::byte *data);
+
+        void validate_evictable_texture(const TextureCreationDesc &texture_creation_desc) const;
+
+        // Replace the resource of the texture (which can be nullptr) and give it a new SRV, releasing the previous
+        // resource and SRV (see release_resource).
+        void replace_texture_resource(Texture &texture, comptr<ID3D12Resource> resource,
+                                      const TextureCreationDesc &texture_creation_desc);
+
+        void create_shader_resource_view(ID3D12Resource *resource, const TextureCreationDesc &texture_creation_desc,
+                                         const D3D12_CPU_DESCRIPTOR_HANDLE descriptor_handle);
+
+        // Release the resources whose frames in flight have ended.
+        void process_deferred_releases();
+
       private:
         Device(const Device &other) = delete;
         Device &operator=(const Device &other) = delete;
@@ -96,6 +150,16 @@ namespace serenity::renderer::rhi
         std::array<std::unique_ptr<CommandList>, FRAMES_IN_FLIGHT> m_direct_command_lists{};
         std::unique_ptr<CommandList> m_copy_command_list{};
 
+        // Command lists of the texture uploads that are not waited for (see upload_texture_resident_mips). A command
+        // list can be reused once the copy queue fence has reached its fence value.
+        struct UploadCommandList
+        {
+            std::unique_ptr<CommandList> command_list{};
+            uint64_t fence_value{};
+        };
+
+        std::vector<UploadCommandList> m_upload_command_lists{};
+
         // Descriptor heaps are contiguous memory allocations of descriptors (which in turn are small blocks of memory
         // that fully describe a resource to the gpu).
         std::unique_ptr<DescriptorHeap> m_rtv_descriptor_heap{};
@@ -110,6 +174,22 @@ namespace serenity::renderer::rhi
 
         // Bindless root signature (a singleton instance).
         std::unique_ptr<RootSignature> m_root_signature{};
+
+        // Number of frames that have ended, used to track when released resources are no longer in use by the GPU.
+        uint64_t m_frame_number{};
+
+        struct DeferredRelease
+        {
+            comptr<ID3D12Resource> resource{};
+            std::vector<uint32_t> descriptor_indices{};
+
+            uint64_t frame_number{};
+
+            // For resources used by the copy queue, the fence value of the copy queue that has to be reached as well.
+            uint64_t copy_fence_value{};
+        };
+
+        std::vector<DeferredRelease> m_deferred_releases{};
     };
 
     template <typename T>
@@ -124,6 +204,7 @@ namespace serenity::renderer::rhi
         }
 
         auto buffer = Buffer{};
+        buffer.usage = buffer_creation_desc.usage;
 
         const auto size = sizeof(T) * std::max<size_t>(data.size(), static_cast<size_t>(1u));
         buffer.size_in_bytes = size;
@@ -212,12 +293,10 @@ namespace serenity::renderer::rhi
                     },
             };
 
-            const auto current_srv_descriptor = m_cbv_srv_uav_descriptor_heap->get_current_handle();
-            m_device->CreateShaderResourceView(buffer.resource.Get(), &srv_desc,
-                                               current_srv_descriptor.cpu_descriptor_handle);
+            const auto srv_descriptor = m_cbv_srv_uav_descriptor_heap->allocate_descriptor();
+            m_device->CreateShaderResourceView(buffer.resource.Get(), &srv_desc, srv_descriptor.cpu_descriptor_handle);
 
-            buffer.srv_index = current_srv_descriptor.index;
-            m_cbv_srv_uav_descriptor_heap->offset_current_handle();
+            buffer.srv_index = srv_descriptor.index;
         }
         break;
 
@@ -227,11 +306,10 @@ namespace serenity::renderer::rhi
                 .SizeInBytes = static_cast<uint32_t>(buffer.size_in_bytes),
             };
 
-            const auto current_cbv_descriptor = m_cbv_srv_uav_descriptor_heap->get_current_handle();
-            m_device->CreateConstantBufferView(&cbv_desc, current_cbv_descriptor.cpu_descriptor_handle);
+            const auto cbv_descriptor = m_cbv_srv_uav_descriptor_heap->allocate_descriptor();
+            m_device->CreateConstantBufferView(&cbv_desc, cbv_descriptor.cpu_descriptor_handle);
 
-            buffer.cbv_index = current_cbv_descriptor.index;
-            m_cbv_srv_uav_descriptor_heap->offset_current_handle();
+            buffer.cbv_index = cbv_descriptor.index;
         }
         break;
         };
@@ -44,6 +44,42 @@ namespace serenity::renderer::rhi
         }
     }
 
+    // Returns the size in bytes of a 4x4 block for block compressed formats, and 0 for all other formats.
+    inline uint32_t get_bytes_per_block(const DXGI_FORMAT format)
+    {
+        switch (format)
+        {
+        case DXGI_FORMAT_BC1_UNORM:
+        case DXGI_FORMAT_BC1_UNORM_SRGB:
+        case DXGI_FORMAT_BC4_UNORM:
+        case DXGI_FORMAT_BC4_SNORM: {
+            return 8u;
+        }
+        break;
+
+        case DXGI_FORMAT_BC2_UNORM:
+        case DXGI_FORMAT_BC2_UNORM_SRGB:
+        case DXGI_FORMAT_BC3_UNORM:
+        case DXGI_FORMAT_BC3_UNORM_SRGB:
+        case DXGI_FORMAT_BC5_UNORM:
+        case DXGI_FORMAT_BC5_SNORM:
+        case DXGI_FORMAT_BC6H_UF16:
+        case DXGI_FORMAT_BC6H_SF16:
+        case DXGI_FORMAT_BC7_UNORM:
+        case DXGI_FORMAT_BC7_UNORM_SRGB: {
+            return 16u;
+        }
+        break;
+
+        default: {
+            return 0u;
+        }
+        break;
+        }
+    }
+
+    // For block compressed formats, bytes_per_pixel is not used (the size of the data is determined by the block size
+    // of the format).
     struct TextureCreationDesc
     {
         TextureUsage usage{};
@@ -56,6 +92,50 @@ namespace serenity::renderer::rhi
         std::wstring name{};
     };
 
+    // Size (in bytes) of a mip level of a non array texture, when the data of all mip levels is tightly packed (i.e
+    // the layout of the data passed to Device::create_texture).
+    inline uint64_t get_mip_size_in_bytes(const TextureCreationDesc &texture_creation_desc, const uint32_t mip_level)
+    {
+        auto width = std::max(texture_creation_desc.dimension.x >> mip_level, 1u);
+        auto height = std::max(texture_creation_desc.dimension.y >> mip_level, 1u);
+
+        const auto bytes_per_block = get_bytes_per_block(texture_creation_desc.format);
+        if (bytes_per_block != 0u)
+        {
+            return static_cast<uint64_t>((width + 3u) / 4u) * ((height + 3u) / 4u) * bytes_per_block;
+        }
+
+        return static_cast<uint64_t>(width) * height * texture_creation_desc.bytes_per_pixel;
+    }
+
+    // Offset (in bytes) of a mip level into the data of a non array texture (i.e the size of all more detailed mip
+    // levels).
+    inline uint64_t get_mip_offset_in_bytes(const TextureCreationDesc &texture_creation_desc, const uint32_t mip_level)
+    {
+        auto offset = uint64_t{0u};
+        for (const auto level : std::views::iota(0u, mip_level))
+        {
+            offset += get_mip_size_in_bytes(texture_creation_desc, level);
+        }
+
+        return offset;
+    }
+
+    // Creation desc of the texture with only the mip levels from most_detailed_mip onwards resident (most_detailed_mip
+    // must be less than the mip count).
+    inline TextureCreationDesc get_resident_texture_creation_desc(const TextureCreationDesc &texture_creation_desc,
+                                                                  const uint32_t most_detailed_mip)
+    {
+        auto resident_texture_creation_desc = texture_creation_desc;
+        resident_texture_creation_desc.mip_levels = texture_creation_desc.mip_levels - most_detailed_mip;
+        resident_texture_creation_desc.dimension = {
+            std::max(texture_creation_desc.dimension.x >> most_detailed_mip, 1u),
+            std::max(texture_creation_desc.dimension.y >> most_detailed_mip, 1u),
+        };
+
+        return resident_texture_creation_desc;
+    }
+
     struct Texture
     {
         comptr<ID3D12Resource> resource{};
@@ -66,4 +146,18 @@ namespace serenity::renderer::rhi
         uint32_t rtv_index{};
         uint32_t dsv_index{};
     };
+
+    // Texture resource whose data is being uploaded on the copy queue, without the CPU waiting for the upload (see
+    // Device::upload_texture_resident_mips).
+    struct TextureUpload
+    {
+        comptr<ID3D12Resource> resource{};
+        comptr<ID3D12Resource> upload_buffer{};
+
+        // Creation desc of the resource (i.e with only the resident mip levels).
+        TextureCreationDesc texture_creation_desc{};
+
+        // The upload has completed once the fence of the copy queue has reached this value.
+        uint64_t fence_value{};
+    };
 } // namespace serenity::renderer::rhi
\ No newline at end of file
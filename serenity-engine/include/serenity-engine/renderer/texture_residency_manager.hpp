@@ -0,0 +1,102 @@
+#pragma once
+
+namespace serenity::renderer
+{
+    struct TextureResidencyChange
+    {
+        uint32_t texture_index{};
+
+        // Most detailed mip level that is resident after the change. Mip levels before it are evicted, and if it is
+        // equal to the mip count the texture is evicted entirely.
+        uint32_t most_detailed_mip{};
+    };
+
+    // Bookkeeping for the memory used by textures, and the policy that keeps them within a memory budget.
+    // The residency manager is independent of the graphics API : it only decides which mip levels of which textures
+    // should be resident, the renderer is responsible for (re)creating the textures.
+    // If the resident size exceeds the budget, the least recently used textures are evicted one mip level at a time
+    // (most detailed mip first, as it is the largest), until the resident size is within the budget again.
+    // Evictable textures can also be streamed : each use of a texture requests a desired (most detailed) mip level.
+    // Textures that are used with a more detailed desired mip than what is resident are streamed in (up to
+    // max_streamed_size_per_frame bytes per frame, coarsest textures first), and mip levels more detailed than the
+    // desired mip are dropped once they have not been requested for protected_frame_count frames.
+    // Textures used in the last protected_frame_count frames are never evicted, so the budget can be exceeded if the
+    // textures in use do not fit.
+    class TextureResidencyManager
+    {
+      public:
+        // protected_frame_count must be at least 1, as the textures used in the current frame must be resident. At
+        // least one texture is streamed in per frame, even if it exceeds max_streamed_size_per_frame.
+        explicit TextureResidencyManager(const uint64_t budget, const uint32_t protected_frame_count,
+                                         const uint64_t max_streamed_size_per_frame);
+
+        uint64_t get_budget() const { return m_budget; }
+
+        void set_budget(const uint64_t budget) { m_budget = budget; }
+
+        uint64_t get_max_streamed_size_per_frame() const { return m_max_streamed_size_per_frame; }
+
+        void set_max_streamed_size_per_frame(const uint64_t max_streamed_size_per_frame)
+        {
+            m_max_streamed_size_per_frame = max_streamed_size_per_frame;
+        }
+
+        // Size (in bytes) of the resident mip levels of all textures.
+        uint64_t get_resident_size() const { return m_resident_size; }
+
+        uint32_t get_most_detailed_resident_mip(const uint32_t texture_index) const;
+
+        // mip_sizes has the size (in bytes) of each mip level, most detailed mip first. The mip levels from
+        // most_detailed_mip onwards are resident when the texture is added (streamed textures start with only their
+        // smallest mip levels resident), and the texture counts as used in the given frame. Non evictable textures
+        // count towards the resident size, but are never evicted (and must be added with all mip levels resident).
+        void add_texture(const uint32_t texture_index, const std::span<const uint64_t> mip_sizes,
+                         const bool evictable, const uint64_t frame, const uint32_t most_detailed_mip = 0u);
+
+        void remove_texture(const uint32_t texture_index);
+
+        // If a texture is marked as used multiple times in a frame, the most detailed of the desired mips is used. The
+        // desired mip is ignored for non evictable textures.
+        void mark_texture_as_used(const uint32_t texture_index, const uint64_t frame, const uint32_t desired_mip = 0u);
+
+        // Returns the textures whose residency has to be changed in this frame (at most one change per texture). The
+        // bookkeeping assumes that all changes are applied.
+        [[nodiscard]] std::vector<TextureResidencyChange> update(const uint64_t frame);
+
+      private:
+        struct TextureEntry
+        {
+            std::vector<uint64_t> mip_sizes{};
+            uint32_t most_detailed_mip{};
+            uint64_t last_used_frame{};
+
+            // Most detailed mip requested in last_used_frame.
+            uint32_t desired_mip{};
+
+            // Last frame in which all resident mip levels were requested (mip levels more detailed than the desired
+            // mip are only dropped once they have not been requested for protected_frame_count frames).
+            uint64_t last_detail_requested_frame{};
+
+            bool evictable{};
+            bool valid{};
+        };
+
+        uint64_t get_resident_size(const TextureEntry &texture, const uint32_t most_detailed_mip) const;
+
+        // Stream in mip levels of the textures used in this frame, up to m_max_streamed_size_per_frame bytes.
+        void stream_in_textures(const uint64_t frame, std::vector<TextureResidencyChange> &changes);
+
+        // Drop the resident mip levels that are more detailed than the desired mip, and have not been requested in the
+        // protected frames.
+        void stream_out_textures(const uint64_t frame, std::vector<TextureResidencyChange> &changes);
+
+      private:
+        uint64_t m_budget{};
+        uint64_t m_resident_size{};
+        uint32_t m_protected_frame_count{};
+        uint64_t m_max_streamed_size_per_frame{};
+
+        // Indexed by texture index.
+        std::vector<TextureEntry> m_textures{};
+    };
+} // namespace serenity::renderer
\ No newline at end of file
@@ -29,15 +29,16 @@ namespace serenity::scene
     {
         uint32_t game_object_index{};
         std::string game_object_name{};
+        std::string model_path{};
 
         uint32_t script_index{INVALID_INDEX_U32};
         Transform transform_component{};
 
         uint32_t mesh_buffer_offset{};
-        uint32_t material_buffer_offset{};
-
         uint32_t mesh_count{};
-        uint32_t material_count{};
+
+        // Indices into the scene material buffers (shared with other game objects that use identical materials).
+        std::vector<uint32_t> material_indices{};
 
         void update(const float delta_time, const uint32_t frame_count);
     };
@@ -4,6 +4,9 @@
 #include "game_object.hpp"
 #include "lights.hpp"
 
+#include "serenity-engine/asset/model_loader.hpp"
+#include "serenity-engine/renderer/rhi/buffer.hpp"
+
 #include "shaders/interop/constant_buffers.hlsli"
 
 namespace serenity::scene
@@ -13,6 +16,8 @@ namespace serenity::scene
     // Since gpu driven rendering is done, scene will contain a large position / normal / material etc buffers
     // which are internally arrays.
     // The GameObject's can index into these 'global' buffers and access their respective elements.
+    // Models are loaded asynchronously, so the scene is usable while they are being loaded. Until its model is loaded,
+    // a game object is rendered with a placeholder model (a unit cube).
 
     // Struct of all the scene - global resources (scene mesh buffer, material buffer, position buffer, etc).
     struct SceneResources
@@ -29,9 +34,44 @@ namespace serenity::scene
         uint32_t texture_coord_buffer_index{};
         std::vector<math::XMFLOAT2> texture_coords{};
 
+        // Quantized vertex streams, used by meshes whose model was loaded with quantized vertices. These buffers are
+        // only created if the scene has quantized meshes.
+        uint32_t quantized_position_buffer_index{};
+        std::vector<asset::QuantizedPosition> quantized_positions{};
+
+        uint32_t quantized_normal_buffer_index{};
+        std::vector<uint32_t> quantized_normals{};
+
+        uint32_t quantized_texture_coord_buffer_index{};
+        std::vector<uint32_t> quantized_texture_coords{};
+
+        // Each mesh (and its levels of detail) is in the 16 bit or the 32 bit index buffer, depending on the index
+        // format of the mesh. The 32 bit index buffer is only created if the scene has meshes that use it.
         uint32_t index_buffer_index{};
         std::vector<uint16_t> indices{};
 
+        uint32_t index_32_buffer_index{};
+        std::vector<uint32_t> indices_32{};
+
+        // Meshlet streams (used for fine grained culling). These buffers are only created if the scene has meshlets.
+        uint32_t meshlet_buffer_index{};
+        std::vector<interop::MeshletBuffer> meshlets{};
+
+        uint32_t meshlet_vertex_buffer_index{};
+        std::vector<uint32_t> meshlet_vertices{};
+
+        uint32_t meshlet_triangle_buffer_index{};
+        std::vector<uint32_t> meshlet_triangles{};
+
+        // Levels of detail of the scene meshes (the LOD indices are part of the index buffer of their mesh).
+        // selected_mesh_lods has the LOD used to render each mesh buffer and is updated every frame : 0 is the full
+        // detail mesh, and i refers to mesh_lods[lod_offset + i - 1].
+        uint32_t mesh_lod_buffer_index{};
+        std::vector<interop::MeshLodBuffer> mesh_lods{};
+        std::vector<uint32_t> selected_mesh_lods{};
+
+        // Materials are interned : identical materials (same factors and textures) share a single entry, even across
+        // models.
         uint32_t materal_buffer_index{};
         std::vector<interop::MaterialBuffer> material_buffers{};
 
@@ -42,6 +82,98 @@ namespace serenity::scene
         std::vector<interop::GameObjectBuffer> game_object_buffers{};
     };
 
+    // A model (i.e the meshes and materials of a single gltf / cooked model file) that has been uploaded into the
+    // scene resources. All game objects that use the same model share its vertex / index ranges and its materials
+    // (including the GPU textures), so scene resources scale with the number of unique models rather than the number
+    // of game objects.
+    struct SceneModel
+    {
+        std::variant<std::shared_ptr<const asset::ModelData>, std::shared_ptr<const asset::CookedModel>> model{};
+
+        // Mesh buffers with offsets into the scene resources. The mesh index and game object index are set per game
+        // object. Empty if the model's geometry is not (yet) present in the scene resources.
+        std::vector<interop::MeshBuffer> mesh_buffers{};
+
+        // Materials (with the GPU textures already created). These are retained across scene reloads so the textures
+        // are not created again.
+        std::vector<interop::MaterialBuffer> material_buffers{};
+
+        // Index of each material into the (interned) scene material buffers. Empty if the model's materials are not
+        // (yet) present in the scene resources.
+        std::vector<uint32_t> material_indices{};
+
+        // Indices of the GPU textures (in the renderer) of the model, in the order of the model's textures.
+        std::vector<uint32_t> texture_indices{};
+
+        // Indices of the GPU textures of each material (indexed by asset::MaterialTextureType), or INVALID_INDEX_U32.
+        // The textures of the materials used by visible meshes are marked as used every frame (so that they are not
+        // evicted, and their mip levels are streamed in).
+        std::vector<std::array<uint32_t, asset::MATERIAL_TEXTURE_TYPE_COUNT>> material_texture_indices{};
+
+        // Number of game objects that use this model.
+        uint32_t reference_count{};
+    };
+
+    struct SceneMeshLodView
+    {
+        asset::IndicesView indices{};
+        float error{};
+    };
+
+    // Non owning view over the data of a single mesh, either from loaded model data or from a (memory mapped) cooked
+    // model.
+    struct SceneMeshView
+    {
+        std::span<const math::XMFLOAT3> positions{};
+        std::span<const math::XMFLOAT3> normals{};
+        std::span<const math::XMFLOAT2> texture_coords{};
+
+        // The LOD indices have the same index format as the mesh indices.
+        asset::IndicesView indices{};
+        asset::IndexFormat index_format{};
+
+        std::span<const asset::Meshlet> meshlets{};
+        std::span<const uint32_t> meshlet_vertices{};
+        std::span<const uint32_t> meshlet_triangles{};
+
+        std::vector<SceneMeshLodView> lods{};
+        math::XMFLOAT4 bounding_sphere{};
+        math::XMFLOAT3 bounding_box_min{};
+        math::XMFLOAT3 bounding_box_max{};
+
+        // If set, the quantized vertex streams are added to the scene instead of the float streams.
+        const asset::QuantizedVertexData *quantized_vertex_data{};
+
+        math::XMMATRIX mesh_local_transform_matrix{};
+        math::XMMATRIX inverse_mesh_local_transform_matrix{};
+
+        uint32_t material_index{};
+    };
+
+    struct SceneTextureView
+    {
+        Uint2 dimension{};
+        uint32_t mip_levels{1u};
+        asset::TextureCompression compression{};
+
+        // The data source only holds a weak reference to the model (see renderer::Renderer::create_texture).
+        renderer::TextureDataSource data_source{};
+    };
+
+    // View over the data of a single material, either from loaded model data or from a cooked model.
+    struct SceneMaterialView
+    {
+        math::XMFLOAT4 base_color{};
+        math::XMFLOAT2 metallic_roughness_factor{};
+        math::XMFLOAT3 emissive_factor{};
+        float normal_scale{1.0f};
+        float occlusion_strength{1.0f};
+        math::XMFLOAT4 texture_coord_transform{};
+
+        // Indices into the textures of the model (indexed by asset::MaterialTextureType), or INVALID_INDEX_U32.
+        std::array<uint32_t, asset::MATERIAL_TEXTURE_TYPE_COUNT> texture_indices{};
+    };
+
     class Scene
     {
       public:
@@ -65,7 +197,13 @@ namespace serenity::scene
 
         void reload();
 
-        // Update the transform component of all game objects in the scene, as well as the scene buffer and camera.
+        // Replace a material of the scene (for ex. when edited via the editor). As materials are interned, the change
+        // applies to all game objects that use the material. The change is lost when the scene resources are rebuilt.
+        void update_material_buffer(const uint32_t material_index, const interop::MaterialBuffer &material_buffer);
+
+        // Update the transform component of all game objects in the scene, as well as the scene buffer and camera. The
+        // textures of the models used by the game objects are marked as used for this frame. The material buffer is
+        // only uploaded if materials have changed since the last upload.
         void update(const math::XMMATRIX projection_matrix, const float delta_time, const uint32_t frame_count,
                     const core::Input &input);
 
@@ -73,13 +211,83 @@ namespace serenity::scene
         // note(rtarun9) : Assumes that scene init script index has a value.
         void load_scene_from_script();
 
+        // Create the scene buffers, destroying the buffers created by the previous call.
         void create_scene_buffers();
 
-        GameObject create_game_object(const std::string_view game_object_name, const std::string_view gltf_scene_path);
+        // Create a GPU buffer that is destroyed when the scene buffers are recreated.
+        template <typename T>
+        uint32_t create_scene_buffer(const renderer::rhi::BufferCreationDesc &buffer_creation_desc,
+                                     const std::span<const T> data = {});
+
+        // Add the geometry / materials of the models used by the game objects to the scene resources (from scratch),
+        // and create the scene buffers. Game objects whose model is not loaded yet use the placeholder model.
+        void rebuild_scene_resources();
+
+        GameObject create_game_object(const std::string_view game_object_name, const std::string_view model_path);
+
+        void add_game_object_to_scene_resources(GameObject &game_object);
+
+        // Start loading the model (asynchronously) if it is not loaded / being loaded already. Paths with the .smesh
+        // extension are loaded as cooked models.
+        void request_scene_model(const std::string_view model_path);
+
+        // Add the models that have finished loading to the scene models (within the per frame time budget). Returns
+        // true if any model was integrated, in which case the scene resources have to be rebuilt.
+        bool integrate_loaded_models();
+
+        void add_loaded_scene_model(const std::string_view model_path,
+                                    const core::AsyncHandle<asset::ModelData> &model_handle);
+
+        // Returns the scene model for the given path, or the placeholder model if the model is not loaded (yet).
+        SceneModel &get_scene_model(const std::string_view model_path);
+
+        // Add the (loaded) model to the scene models and create its GPU textures, unless the same model is already
+        // used by the scene.
+        void add_scene_model(const std::string_view model_path, decltype(SceneModel::model) model);
+
+        void create_scene_model_materials(const std::string_view model_path, SceneModel &scene_model);
+
+        // Append the geometry and materials of the scene model to the scene resources.
+        void add_scene_model_to_scene_resources(SceneModel &scene_model);
+
+        void add_mesh_to_scene_resources(SceneModel &scene_model, const SceneMeshView &mesh);
+
+        // Returns the index of the material in the scene material buffers, adding the material (and the indices of its
+        // GPU textures) if there is no identical material yet.
+        uint32_t intern_material_buffer(
+            const interop::MaterialBuffer &material_buffer,
+            const std::array<uint32_t, asset::MATERIAL_TEXTURE_TYPE_COUNT> &material_texture_indices);
+
+        // Select the level of detail of each mesh buffer based on the projected (screen space) error of the LODs.
+        void select_mesh_lods(const math::XMMATRIX projection_matrix);
+
+        // Mark the textures of the mesh buffers' materials as used, with the resolution required for the projected
+        // (screen space) size of the mesh bounds (which determines the mip levels that are streamed in).
+        void request_texture_mips(const math::XMMATRIX projection_matrix);
+
+        // Create the GPU texture (the index of which is appended to texture_indices) and return its SRV index.
+        uint32_t create_texture(const std::wstring_view texture_name, const SceneTextureView &texture,
+                                const bool is_srgb, std::vector<uint32_t> &texture_indices);
+
+        // Update the texture SRV indices of the material buffer from the GPU textures of the material, as the SRV index
+        // of a streamed texture changes when its resident mip levels change. Returns true if any SRV index changed.
+        bool update_texture_srv_indices(
+            interop::MaterialBuffer &material_buffer,
+            const std::array<uint32_t, asset::MATERIAL_TEXTURE_TYPE_COUNT> &material_texture_indices);
+
+        // texture_srv_indices has the SRV index of each texture of the model.
+        interop::MaterialBuffer create_material_buffer(const SceneMaterialView &material,
+                                                       const std::span<const uint32_t> texture_srv_indices);
 
       public:
         static constexpr uint32_t MAX_GAME_OBJECTS = 100u;
 
+        // Maximum error (as a fraction of the screen height) of the LOD selected for rendering a mesh.
+        static constexpr float LOD_SCREEN_SPACE_ERROR_THRESHOLD = 1.0f / 1080.0f;
+
+        // Time (in ms) spent per frame on adding models that have finished loading to the scene.
+        static constexpr float MAX_MODEL_INTEGRATION_TIME_PER_FRAME = 4.0f;
+
       private:
         SceneResources m_scene_resources{};
 
@@ -89,8 +297,37 @@ namespace serenity::scene
 
         std::unordered_map<std::string, GameObject> m_game_objects{};
 
+        // Models used by the game objects of this scene, keyed by the address of the shared model.
+        std::unordered_map<const void *, SceneModel> m_scene_models{};
+
+        // Key (into m_scene_models) of the loaded models, by model path.
+        std::unordered_map<std::string, const void *> m_scene_model_keys{};
+
+        // Models that are still being loaded, by model path.
+        std::unordered_map<std::string, core::AsyncHandle<asset::ModelData>> m_pending_models{};
+
+        // Used by game objects whose model is still being loaded.
+        SceneModel m_placeholder_scene_model{};
+
+        // Indices into the scene material buffers, keyed by the hash of the material buffer (hashes can collide, so the
+        // material buffers themselves are compared as well).
+        std::unordered_multimap<uint64_t, uint32_t> m_material_buffer_indices{};
+
+        // Indices of the GPU textures of each scene material (see SceneModel::material_texture_indices).
+        std::vector<std::array<uint32_t, asset::MATERIAL_TEXTURE_TYPE_COUNT>> m_material_texture_indices{};
+
+        // Indices (into the renderer's buffers) of the buffers created by create_scene_buffers.
+        std::vector<uint32_t> m_scene_buffer_indices{};
+
+        // Set if the material buffers have changed since they were last uploaded to the GPU.
+        bool m_material_buffers_dirty{};
+
         uint32_t m_scene_init_script_index{};
 
+        // Set by the scene init script (quantize_vertices = true). If set, the models of the scene are loaded with
+        // quantized vertex streams.
+        bool m_quantize_vertices{};
+
         std::string m_scene_name{};
     };
 } // namespace serenity::scene
\ No newline at end of file
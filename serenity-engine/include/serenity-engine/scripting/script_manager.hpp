@@ -5,10 +5,27 @@
 
 namespace serenity::scripting
 {
+    // A script is compiled only once (when created, or when the file on disk is modified) and executed in its own
+    // environment, so that multiple scripts defining functions with the same name (for ex. update_transform) do not
+    // overwrite each other.
     struct Script
     {
         std::string script_name{};
         std::string script_path{};
+
+        // Scripts are executed when they are (re)loaded, so that the functions they define are available. Scripts
+        // that are only executed on demand (for ex. scene init scripts, see Scene::load_scene_from_script) set this
+        // to false, so that they are not executed twice.
+        bool execute_on_load{true};
+
+        // Cached compiled chunk and the environment the chunk was executed in.
+        sol::protected_function chunk{};
+        sol::environment environment{};
+
+        // Cached reference to the 'update_transform' function defined in the script (if any).
+        sol::protected_function update_function{};
+
+        std::filesystem::file_time_type last_write_time{};
     };
 
     // Light weight abstraction for script management over sol2.
@@ -22,13 +39,33 @@ namespace serenity::scripting
 
         sol::state &get_state() { return m_lua; }
 
-        sol::state &call_function() { return m_lua; }
+        sol::environment &get_environment(const uint32_t script_index)
+        {
+            return m_scripts.at(script_index).environment;
+        }
+
+        // Returns the cached update function of the script. The returned function is invalid if the script does not
+        // define an update_transform function. Cheap enough to be called per game object per frame.
+        sol::protected_function &get_update_function(const uint32_t script_index)
+        {
+            return m_scripts.at(script_index).update_function;
+        }
 
         // Returns a script_index, which can be used to index into the scripts vector and access the script.
         uint32_t create_script(const Script &script);
 
+        // Executes the (cached) compiled chunk of the script in the script's environment.
         void execute_script(const uint32_t script_index);
 
+        // Recompile all scripts whose file on disk has been modified since they were last loaded.
+        // Should be called once per frame.
+        void reload_modified_scripts();
+
+      private:
+        // Compile the script file into a chunk, create a fresh environment and execute the chunk in it (if
+        // execute_on_load is set).
+        void load_script(Script &script);
+
       private:
         sol::state m_lua{};
 
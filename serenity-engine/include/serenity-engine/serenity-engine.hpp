@@ -4,14 +4,26 @@
 // Prevents the need to manually include selected engine header files in the game / applications.
 
 // Asset
+#include "asset/asset_packer.hpp"
+#include "asset/cooked_model.hpp"
+#include "asset/float_conversion.hpp"
+#include "asset/mesh_optimizer.hpp"
+#include "asset/model_cooker.hpp"
 #include "asset/model_loader.hpp"
+#include "asset/texture_compressor.hpp"
 #include "asset/texture_loader.hpp"
+#include "asset/vertex_quantization.hpp"
 
 // Core
 #include "core/application.hpp"
+#include "core/asset_archive.hpp"
+#include "core/async_file_loader.hpp"
 #include "core/file_system.hpp"
 #include "core/input.hpp"
+#include "core/job_system.hpp"
 #include "core/log.hpp"
+#include "core/lz4.hpp"
+#include "core/memory_mapped_file.hpp"
 #include "core/singleton_instance.hpp"
 
 // Editor
@@ -23,6 +35,7 @@
 #include "renderer/renderer.hpp"
 #include "renderer/shader_compiler.hpp"
 #include "renderer/shader.hpp"
+#include "renderer/texture_residency_manager.hpp"
 
 // Renderer RHI
 #include "renderer/rhi/rhi.hpp"
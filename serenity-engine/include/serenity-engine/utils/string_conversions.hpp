@@ -6,8 +6,11 @@ namespace serenity
     // Reference :
     // https://github.com/turanszkij/WickedEngine/blob/bb519474cad797af78f53bbee622520efbb725f7/WickedEngine/wiHelper.cpp#L1520
 
+    // On platforms other than windows (where only the asset pipeline is built), the conversion is done by
+    // std::filesystem::path.
     inline std::wstring string_to_wstring(const std::string_view input_string)
     {
+#ifdef _WIN32
         auto result = std::wstring{};
         const auto input = std::string(input_string);
 
@@ -18,10 +21,14 @@ namespace serenity
         }
 
         return std::move(result);
+#else
+        return std::filesystem::path(input_string).wstring();
+#endif
     }
 
     inline std::string wstring_to_string(const std::wstring_view input_string)
     {
+#ifdef _WIN32
         auto result = std::string{};
         const auto input = std::wstring(input_string);
 
@@ -32,5 +39,8 @@ namespace serenity
         }
 
         return std::move(result);
+#else
+        return std::filesystem::path(input_string).string();
+#endif
     }
 } // namespace serenity
\ No newline at end of file
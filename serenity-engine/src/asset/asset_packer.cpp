@@ -0,0 +1,170 @@
+#include "serenity-engine/asset/asset_packer.hpp"
+
+#include "serenity-engine/core/file_system.hpp"
+#include "serenity-engine/core/job_system.hpp"
+#include "serenity-engine/core/lz4.hpp"
+
+namespace serenity::asset::AssetPacker
+{
+    void pack_assets(const std::string_view archive_path, const std::span<const PackedFile> files)
+    {
+        const auto start_time = std::chrono::high_resolution_clock::now();
+
+        const auto align = [](const uint64_t offset) {
+            return (offset + core::ASSET_ARCHIVE_DATA_ALIGNMENT - 1u) / core::ASSET_ARCHIVE_DATA_ALIGNMENT *
+                   core::ASSET_ARCHIVE_DATA_ALIGNMENT;
+        };
+
+        // The entries are sorted by path, so that files can be found with a binary search at runtime.
+        auto sorted_files = std::vector<const PackedFile *>{};
+        for (const auto &file : files)
+        {
+            sorted_files.emplace_back(&file);
+        }
+
+        std::sort(sorted_files.begin(), sorted_files.end(),
+                  [](const PackedFile *a, const PackedFile *b) { return a->path < b->path; });
+
+        if (const auto itr =
+                std::adjacent_find(sorted_files.begin(), sorted_files.end(),
+                                   [](const PackedFile *a, const PackedFile *b) { return a->path == b->path; });
+            itr != sorted_files.end())
+        {
+            core::Log::instance().critical(std::format("Duplicate path {} in asset archive", (*itr)->path));
+        }
+
+        // Compress the files in parallel. The compressed data is kept in memory until the archive is written,
+        // uncompressed files are read again when they are written to the archive.
+        auto entries = std::vector<core::AssetArchiveEntry>(sorted_files.size());
+        auto compressed_data = std::vector<std::vector<std::byte>>(sorted_files.size());
+
+        core::JobSystem::instance().parallel_for(
+            std::span{sorted_files},
+            [&](const PackedFile *file, const size_t index) {
+                const auto source_path = core::FileSystem::instance().get_absolute_path(file->source_path);
+
+                // Empty files cannot be memory mapped (and have no data to store).
+                if (std::filesystem::is_regular_file(source_path) && std::filesystem::file_size(source_path) == 0u)
+                {
+                    return;
+                }
+
+                const auto source_file = core::MemoryMappedFile(source_path);
+                if (!source_file.is_valid())
+                {
+                    core::Log::instance().critical(
+                        std::format("Failed to read file {} for packing into asset archive", file->source_path));
+                }
+
+                entries[index].size = source_file.get_size();
+                entries[index].stored_size = source_file.get_size();
+
+                if (!file->allow_compression)
+                {
+                    return;
+                }
+
+                auto data = core::Lz4::compress(source_file.get_span());
+                if (data.size() <= source_file.get_size() - source_file.get_size() / 8u)
+                {
+                    entries[index].compression = core::ArchiveCompression::Lz4;
+                    entries[index].stored_size = data.size();
+
+                    compressed_data[index] = std::move(data);
+                }
+            },
+            1u);
+
+        // Setup the layout of the archive.
+        auto header = core::AssetArchiveHeader{
+            .entry_count = static_cast<uint32_t>(entries.size()),
+            .entries_offset = sizeof(core::AssetArchiveHeader),
+        };
+
+        auto paths = std::string{};
+        for (const auto i : std::views::iota(size_t{0u}, entries.size()))
+        {
+            entries[i].path_offset = paths.size();
+            entries[i].path_size = static_cast<uint32_t>(sorted_files[i]->path.size());
+
+            paths += sorted_files[i]->path;
+        }
+
+        header.paths_offset = header.entries_offset + sizeof(core::AssetArchiveEntry) * entries.size();
+        header.paths_size = paths.size();
+
+        auto archive_size = header.paths_offset + header.paths_size;
+        for (auto &entry : entries)
+        {
+            entry.data_offset = align(archive_size);
+            archive_size = entry.data_offset + entry.stored_size;
+        }
+
+        // The archive is written to a temporary file first and then renamed, so that a failed pack never leaves a
+        // partially written archive behind.
+        const auto path = core::FileSystem::instance().get_absolute_path(archive_path);
+        const auto temporary_path = path + ".tmp";
+
+        {
+            auto file = std::ofstream(temporary_path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                core::Log::instance().critical(
+                    std::format("Failed to open file {} for writing asset archive", temporary_path));
+            }
+
+            const auto write = [&](const void *data, const size_t size) {
+                file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+            };
+
+            const auto padding = std::array<char, core::ASSET_ARCHIVE_DATA_ALIGNMENT>{};
+
+            write(&header, sizeof(header));
+            write(entries.data(), sizeof(core::AssetArchiveEntry) * entries.size());
+            write(paths.data(), paths.size());
+
+            auto offset = header.paths_offset + header.paths_size;
+            for (const auto i : std::views::iota(size_t{0u}, entries.size()))
+            {
+                write(padding.data(), entries[i].data_offset - offset);
+
+                if (entries[i].compression == core::ArchiveCompression::None && entries[i].size != 0u)
+                {
+                    const auto source_file = core::MemoryMappedFile(
+                        core::FileSystem::instance().get_absolute_path(sorted_files[i]->source_path));
+
+                    if (source_file.get_size() != entries[i].size)
+                    {
+                        core::Log::instance().critical(
+                            std::format("File {} changed while packing asset archive", sorted_files[i]->source_path));
+                    }
+
+                    write(source_file.get_data(), source_file.get_size());
+                }
+                else if (entries[i].compression == core::ArchiveCompression::Lz4)
+                {
+                    write(compressed_data[i].data(), compressed_data[i].size());
+                }
+
+                offset = entries[i].data_offset + entries[i].stored_size;
+            }
+
+            if (!file)
+            {
+                core::Log::instance().critical(std::format("Failed to write asset archive {}", temporary_path));
+            }
+        }
+
+        std::filesystem::rename(temporary_path, path);
+
+        const auto uncompressed_size = std::accumulate(
+            entries.begin(), entries.end(), uint64_t{0u},
+            [](const uint64_t size, const core::AssetArchiveEntry &entry) { return size + entry.size; });
+
+        const auto end_time = std::chrono::high_resolution_clock::now();
+
+        core::Log::instance().info(std::format(
+            "Packed {} files ({} bytes) into asset archive {} ({} bytes) in {} ms", entries.size(), uncompressed_size,
+            archive_path, archive_size, std::chrono::duration<float, std::milli>(end_time - start_time).count()));
+    }
+} // namespace serenity::asset::AssetPacker
\ No newline at end of file
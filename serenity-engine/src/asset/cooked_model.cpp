@@ -0,0 +1,138 @@
+#include "serenity-engine/asset/cooked_model.hpp"
+#include "serenity-engine/asset/texture_compressor.hpp"
+
+#include "serenity-engine/core/file_system.hpp"
+
+namespace serenity::asset
+{
+    CookedModel::CookedModel(const std::string_view cooked_model_path)
+    {
+        const auto start_time = std::chrono::high_resolution_clock::now();
+
+        m_file = core::FileSystem::instance().map_file(cooked_model_path);
+
+        if (!m_file.is_valid() || m_file.get_size() < sizeof(CookedModelHeader))
+        {
+            core::Log::instance().critical(
+                std::format("Failed to load cooked model with path : {}", cooked_model_path));
+        }
+
+        const auto &header = get_header();
+        if (header.magic != COOKED_MODEL_MAGIC || header.version != COOKED_MODEL_VERSION)
+        {
+            core::Log::instance().critical(
+                std::format("Cooked model {} has invalid magic / version (version : {}, expected version : {}). The "
+                            "model has to be cooked again",
+                            cooked_model_path, header.version, COOKED_MODEL_VERSION));
+        }
+
+        // Validate that all sections lie within the file, so the spans handed out never point past the mapping.
+        const auto is_section_valid = [&](const uint64_t offset, const uint64_t size) {
+            return offset % COOKED_MODEL_SECTION_ALIGNMENT == 0u && offset <= m_file.get_size() &&
+                   size <= m_file.get_size() - offset;
+        };
+
+        const auto sections_valid =
+            is_section_valid(header.meshes_offset, header.mesh_count * sizeof(CookedMesh)) &&
+            is_section_valid(header.lods_offset, header.lod_count * sizeof(CookedMeshLod)) &&
+            is_section_valid(header.materials_offset, header.material_count * sizeof(CookedMaterial)) &&
+            is_section_valid(header.textures_offset, header.texture_count * sizeof(CookedTexture)) &&
+            is_section_valid(header.positions_offset, header.vertex_count * sizeof(math::XMFLOAT3)) &&
+            is_section_valid(header.normals_offset, header.vertex_count * sizeof(math::XMFLOAT3)) &&
+            is_section_valid(header.texture_coords_offset, header.vertex_count * sizeof(math::XMFLOAT2)) &&
+            is_section_valid(header.indices_offset, header.index_count * sizeof(uint16_t)) &&
+            is_section_valid(header.indices_32_offset, header.index_32_count * sizeof(uint32_t)) &&
+            is_section_valid(header.meshlets_offset, header.meshlet_count * sizeof(Meshlet)) &&
+            is_section_valid(header.meshlet_vertices_offset, header.meshlet_vertex_count * sizeof(uint32_t)) &&
+            is_section_valid(header.meshlet_triangles_offset, header.meshlet_triangle_count * sizeof(uint32_t)) &&
+            is_section_valid(header.texture_data_offset, header.texture_data_size);
+
+        if (!sections_valid)
+        {
+            core::Log::instance().critical(std::format("Cooked model {} is truncated / corrupt", cooked_model_path));
+        }
+
+        for (const auto &mesh : get_meshes())
+        {
+            // Each mesh indexes into the index stream of its index format.
+            const auto index_count =
+                mesh.index_format == IndexFormat::Uint32 ? header.index_32_count : header.index_count;
+
+            if (static_cast<uint64_t>(mesh.vertex_offset) + mesh.vertex_count > header.vertex_count ||
+                static_cast<uint64_t>(mesh.index_offset) + mesh.index_count > index_count ||
+                mesh.index_format > IndexFormat::Uint32 ||
+                static_cast<uint64_t>(mesh.lod_offset) + mesh.lod_count > header.lod_count ||
+                static_cast<uint64_t>(mesh.meshlet_offset) + mesh.meshlet_count > header.meshlet_count ||
+                static_cast<uint64_t>(mesh.meshlet_vertex_offset) + mesh.meshlet_vertex_count >
+                    header.meshlet_vertex_count ||
+                static_cast<uint64_t>(mesh.meshlet_triangle_offset) + mesh.meshlet_triangle_count >
+                    header.meshlet_triangle_count ||
+                (mesh.material_index >= header.material_count && header.material_count != 0u))
+            {
+                core::Log::instance().critical(std::format("Cooked model {} has invalid mesh data", cooked_model_path));
+            }
+
+            for (const auto &lod : get_lods(mesh))
+            {
+                if (static_cast<uint64_t>(lod.index_offset) + lod.index_count > index_count)
+                {
+                    core::Log::instance().critical(
+                        std::format("Cooked model {} has invalid LOD data", cooked_model_path));
+                }
+            }
+
+            for (const auto &meshlet : get_meshlets(mesh))
+            {
+                if (static_cast<uint64_t>(meshlet.vertex_offset) + meshlet.vertex_count > mesh.meshlet_vertex_count ||
+                    static_cast<uint64_t>(meshlet.triangle_offset) + meshlet.triangle_count >
+                        mesh.meshlet_triangle_count)
+                {
+                    core::Log::instance().critical(
+                        std::format("Cooked model {} has invalid meshlet data", cooked_model_path));
+                }
+            }
+        }
+
+        for (const auto &material : get_materials())
+        {
+            for (const auto texture_index : material.texture_indices)
+            {
+                if (texture_index != INVALID_INDEX_U32 && texture_index >= header.texture_count)
+                {
+                    core::Log::instance().critical(
+                        std::format("Cooked model {} has invalid material data", cooked_model_path));
+                }
+            }
+        }
+
+        for (const auto &texture : get_textures())
+        {
+            const auto &dimension = texture.dimension;
+            const auto mip_levels = texture.mip_levels;
+
+            // The texture data must contain exactly mip_levels R8G8B8A8 (or block compressed) levels.
+            const auto compression = texture.compression;
+            const auto expected_size = compression == TextureCompression::None
+                                           ? TextureLoader::get_mip_chain_texel_count(dimension, mip_levels) * 4u
+                                           : TextureCompressor::get_compressed_size(dimension, mip_levels, compression);
+
+            const auto has_valid_mip_chain =
+                dimension.x != 0u && dimension.y != 0u && mip_levels != 0u &&
+                mip_levels <= TextureLoader::get_mip_level_count(dimension) &&
+                compression <= TextureCompression::BC7 && texture.size == expected_size;
+
+            if (texture.offset > header.texture_data_size || texture.size > header.texture_data_size - texture.offset ||
+                !has_valid_mip_chain)
+            {
+                core::Log::instance().critical(
+                    std::format("Cooked model {} has invalid texture data", cooked_model_path));
+            }
+        }
+
+        const auto end_time = std::chrono::high_resolution_clock::now();
+
+        core::Log::instance().info(
+            std::format("Loaded cooked model from path : {} in {} ms", cooked_model_path,
+                        std::chrono::duration<float, std::milli>(end_time - start_time).count()));
+    }
+} // namespace serenity::asset
\ No newline at end of file
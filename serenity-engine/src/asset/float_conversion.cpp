@@ -0,0 +1,236 @@
+#include "serenity-engine/asset/float_conversion.hpp"
+
+namespace serenity::asset::FloatConversion
+{
+    namespace
+    {
+        // Convert a positive (non NaN) float into an unsigned float with 5 exponent bits and mantissa_bits mantissa
+        // bits (the channels of R11G11B10), clamped to the largest finite value.
+        uint32_t convert_float_to_unsigned_small_float(const float value, const uint32_t mantissa_bits)
+        {
+            const auto mantissa_mask = (1u << mantissa_bits) - 1u;
+            const auto max_value = (30u << mantissa_bits) | mantissa_mask;
+
+            // Negative values, zero and NaN.
+            if (!(value > 0.0f))
+            {
+                return 0u;
+            }
+
+            auto bits = std::bit_cast<uint32_t>(value);
+            const auto shift = 23u - mantissa_bits;
+
+            if (bits < (127u - 14u) << 23u)
+            {
+                // Denormal, value / 2^-14 scaled to the mantissa (rounding up into the smallest normal value produces
+                // the correct encoding as well).
+                return static_cast<uint32_t>(
+                    std::nearbyint(value * std::bit_cast<float>((127u + 14u + mantissa_bits) << 23u)));
+            }
+
+            // Rebias the exponent and round to nearest even (a carry out of the mantissa increments the exponent).
+            bits = std::min(bits, 0x7f000000u);
+            const auto mantissa_odd = (bits >> shift) & 1u;
+            bits += (static_cast<uint32_t>(15 - 127) << 23u) + ((1u << (shift - 1u)) - 1u) + mantissa_odd;
+
+            return std::min(bits >> shift, max_value);
+        }
+
+#if defined(_XM_SSE_INTRINSICS_) && !defined(_XM_F16C_INTRINSICS_)
+        // SSE2 version of convert_float_to_half for 4 floats (the halves are returned in the lower 16 bits of each
+        // 32 bit lane, sign extended).
+        __m128i convert_float_to_half(const __m128 value)
+        {
+            const auto sign_mask = _mm_set1_ps(-0.0f);
+
+            const auto sign = _mm_and_ps(sign_mask, value);
+            const auto absolute = _mm_xor_ps(value, sign);
+            const auto absolute_bits = _mm_castps_si128(absolute);
+
+            const auto is_nan = _mm_castps_si128(_mm_cmpunord_ps(absolute, absolute));
+            const auto is_regular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), absolute_bits);
+            const auto is_denormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), absolute_bits);
+
+            const auto infinity_or_nan =
+                _mm_or_si128(_mm_and_si128(is_nan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7c00));
+
+            const auto denormal_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+            const auto denormal = _mm_sub_epi32(
+                _mm_castps_si128(_mm_add_ps(absolute, _mm_castsi128_ps(denormal_magic))), denormal_magic);
+
+            const auto mantissa_odd = _mm_srai_epi32(_mm_slli_epi32(absolute_bits, 31 - 13), 31);
+            const auto normal = _mm_srli_epi32(
+                _mm_sub_epi32(_mm_add_epi32(absolute_bits, _mm_set1_epi32(0xfff - ((127 - 15) << 23))), mantissa_odd),
+                13);
+
+            const auto finite =
+                _mm_or_si128(_mm_and_si128(is_denormal, denormal), _mm_andnot_si128(is_denormal, normal));
+            const auto half =
+                _mm_or_si128(_mm_and_si128(is_regular, finite), _mm_andnot_si128(is_regular, infinity_or_nan));
+
+            return _mm_or_si128(half, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+        }
+#endif
+
+#if defined(_XM_SSE_INTRINSICS_)
+        // SSE2 version of convert_float_to_unsigned_small_float for 4 floats. Since all valid (positive) inputs have
+        // the sign bit cleared, signed integer comparisons can be used for clamping.
+        template <uint32_t MANTISSA_BITS> __m128i convert_float_to_unsigned_small_float(const __m128 value)
+        {
+            constexpr auto shift = 23 - static_cast<int>(MANTISSA_BITS);
+            constexpr auto max_value = static_cast<int>((30u << MANTISSA_BITS) | ((1u << MANTISSA_BITS) - 1u));
+
+            const auto select = [](const __m128i mask, const __m128i a, const __m128i b) {
+                return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+            };
+
+            const auto is_positive = _mm_castps_si128(_mm_cmpgt_ps(value, _mm_setzero_ps()));
+
+            auto bits = _mm_castps_si128(value);
+            bits = select(_mm_cmpgt_epi32(bits, _mm_set1_epi32(0x7f000000)), _mm_set1_epi32(0x7f000000), bits);
+
+            const auto is_denormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), bits);
+            const auto denormal_scale =
+                _mm_castsi128_ps(_mm_set1_epi32((127 + 14 + static_cast<int>(MANTISSA_BITS)) << 23));
+            const auto denormal = _mm_cvtps_epi32(_mm_mul_ps(value, denormal_scale));
+
+            const auto mantissa_odd = _mm_and_si128(_mm_srli_epi32(bits, shift), _mm_set1_epi32(1));
+            auto normal = _mm_srli_epi32(
+                _mm_add_epi32(_mm_add_epi32(bits, _mm_set1_epi32(((15 - 127) << 23) + (1 << (shift - 1)) - 1)),
+                              mantissa_odd),
+                shift);
+            normal = select(_mm_cmpgt_epi32(normal, _mm_set1_epi32(max_value)), _mm_set1_epi32(max_value), normal);
+
+            return _mm_and_si128(is_positive, select(is_denormal, denormal, normal));
+        }
+#endif
+    } // namespace
+
+    // Reference : https://gist.github.com/rygorous/2156668 (float_to_half_fast3_rtne).
+    uint16_t convert_float_to_half(const float value)
+    {
+        auto bits = std::bit_cast<uint32_t>(value);
+
+        const auto sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        auto half = uint32_t{};
+        if (bits >= (127u + 16u) << 23u)
+        {
+            // Overflows to infinity (or is NaN).
+            half = bits > 0x7f800000u ? 0x7e00u : 0x7c00u;
+        }
+        else if (bits < (127u - 14u) << 23u)
+        {
+            // Denormal half, the float addition rounds the mantissa.
+            half = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) + 0.5f) - std::bit_cast<uint32_t>(0.5f);
+        }
+        else
+        {
+            // Rebias the exponent and round to nearest even.
+            const auto mantissa_odd = (bits >> 13u) & 1u;
+            bits += (static_cast<uint32_t>(15 - 127) << 23u) + 0xfffu + mantissa_odd;
+            half = bits >> 13u;
+        }
+
+        return static_cast<uint16_t>(half | (sign >> 16u));
+    }
+
+    // Reference : https://gist.github.com/rygorous/2144712 (half_to_float_fast4).
+    float convert_half_to_float(const uint16_t value)
+    {
+        const auto shifted_exponent = 0x7c00u << 13u;
+
+        auto bits = (value & 0x7fffu) << 13u;
+        const auto exponent = bits & shifted_exponent;
+
+        // Rebias the exponent.
+        bits += (127u - 15u) << 23u;
+
+        if (exponent == shifted_exponent)
+        {
+            // Infinity or NaN, the exponent needs an extra adjustment.
+            bits += (128u - 16u) << 23u;
+        }
+        else if (exponent == 0u)
+        {
+            // Zero or denormal, renormalized with a float subtraction.
+            bits += 1u << 23u;
+            bits = std::bit_cast<uint32_t>(std::bit_cast<float>(bits) - std::bit_cast<float>(113u << 23u));
+        }
+
+        return std::bit_cast<float>(bits | ((value & 0x8000u) << 16u));
+    }
+
+    void convert_floats_to_halves(const std::span<const float> source, const std::span<uint16_t> destination)
+    {
+        auto i = size_t{0u};
+
+#if defined(_XM_F16C_INTRINSICS_)
+        // Converts 8 floats per iteration.
+        for (; i + 8u <= source.size(); i += 8u)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination.data() + i),
+                             _mm256_cvtps_ph(_mm256_loadu_ps(source.data() + i), _MM_FROUND_TO_NEAREST_INT));
+        }
+#elif defined(_XM_SSE_INTRINSICS_)
+        // Converts 8 floats per iteration. Since the halves are sign extended, the signed saturating pack keeps them as
+        // is.
+        for (; i + 8u <= source.size(); i += 8u)
+        {
+            const auto low = convert_float_to_half(_mm_loadu_ps(source.data() + i));
+            const auto high = convert_float_to_half(_mm_loadu_ps(source.data() + i + 4u));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination.data() + i), _mm_packs_epi32(low, high));
+        }
+#endif
+
+        for (; i < source.size(); ++i)
+        {
+            destination[i] = convert_float_to_half(source[i]);
+        }
+    }
+
+    uint32_t pack_r11g11b10(const float r, const float g, const float b)
+    {
+        return convert_float_to_unsigned_small_float(r, 6u) | (convert_float_to_unsigned_small_float(g, 6u) << 11u) |
+               (convert_float_to_unsigned_small_float(b, 5u) << 22u);
+    }
+
+    void convert_texels_to_r11g11b10(const std::span<const float> source, const uint32_t num_channels,
+                                     const std::span<uint32_t> destination)
+    {
+        const auto texel_count = source.size() / num_channels;
+
+        auto i = size_t{0u};
+
+#if defined(_XM_SSE_INTRINSICS_)
+        // Converts 4 texels (of 4 channels) per iteration, transposed so that each vector holds one channel.
+        if (num_channels == 4u)
+        {
+            for (; i + 4u <= texel_count; i += 4u)
+            {
+                auto r = _mm_loadu_ps(source.data() + i * 4u);
+                auto g = _mm_loadu_ps(source.data() + i * 4u + 4u);
+                auto b = _mm_loadu_ps(source.data() + i * 4u + 8u);
+                auto a = _mm_loadu_ps(source.data() + i * 4u + 12u);
+
+                _MM_TRANSPOSE4_PS(r, g, b, a);
+
+                const auto packed = _mm_or_si128(
+                    _mm_or_si128(convert_float_to_unsigned_small_float<6u>(r),
+                                 _mm_slli_epi32(convert_float_to_unsigned_small_float<6u>(g), 11)),
+                    _mm_slli_epi32(convert_float_to_unsigned_small_float<5u>(b), 22));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(destination.data() + i), packed);
+            }
+        }
+#endif
+
+        for (; i < texel_count; ++i)
+        {
+            const auto *texel = source.data() + i * num_channels;
+            destination[i] = pack_r11g11b10(texel[0], texel[1], texel[2]);
+        }
+    }
+} // namespace serenity::asset::FloatConversion
\ No newline at end of file
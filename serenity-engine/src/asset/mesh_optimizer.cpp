@@ -0,0 +1,1008 @@
+#include "serenity-engine/asset/mesh_optimizer.hpp"
+
+#include "serenity-engine/asset/model_loader.hpp"
+
+using namespace math;
+
+namespace serenity::asset::MeshOptimizer
+{
+    namespace
+    {
+        // For each vertex, the list of triangles that reference it (stored as offsets into a single vector).
+        struct VertexTriangleAdjacency
+        {
+            std::vector<uint32_t> triangle_counts{};
+            std::vector<uint32_t> offsets{};
+            std::vector<uint32_t> triangles{};
+        };
+
+        VertexTriangleAdjacency get_vertex_triangle_adjacency(const std::span<const uint32_t> indices,
+                                                              const size_t vertex_count)
+        {
+            auto adjacency = VertexTriangleAdjacency{
+                .triangle_counts = std::vector<uint32_t>(vertex_count),
+                .offsets = std::vector<uint32_t>(vertex_count),
+                .triangles = std::vector<uint32_t>(indices.size()),
+            };
+
+            for (const auto index : indices)
+            {
+                ++adjacency.triangle_counts[index];
+            }
+
+            auto offset = 0u;
+            for (const auto i : std::views::iota(size_t{0u}, vertex_count))
+            {
+                adjacency.offsets[i] = offset;
+                offset += adjacency.triangle_counts[i];
+            }
+
+            auto write_offsets = adjacency.offsets;
+            for (const auto i : std::views::iota(size_t{0u}, indices.size()))
+            {
+                adjacency.triangles[write_offsets[indices[i]]++] = static_cast<uint32_t>(i / 3u);
+            }
+
+            return adjacency;
+        }
+    } // namespace
+
+    VertexCacheStatistics get_vertex_cache_statistics(const std::span<const uint32_t> indices,
+                                                      const size_t vertex_count)
+    {
+        if (indices.size() < 3u || vertex_count == 0u)
+        {
+            return VertexCacheStatistics{};
+        }
+
+        // Simulate a FIFO cache : a vertex is in the cache if less than VERTEX_CACHE_SIZE vertices were transformed
+        // since it was last transformed.
+        auto cache_timestamps = std::vector<uint32_t>(vertex_count, 0u);
+        auto timestamp = VERTEX_CACHE_SIZE + 1u;
+
+        auto transformed_vertex_count = 0u;
+        for (const auto index : indices)
+        {
+            if (timestamp - cache_timestamps[index] > VERTEX_CACHE_SIZE)
+            {
+                cache_timestamps[index] = timestamp++;
+                ++transformed_vertex_count;
+            }
+        }
+
+        return VertexCacheStatistics{
+            .acmr = static_cast<float>(transformed_vertex_count) / static_cast<float>(indices.size() / 3u),
+            .atvr = static_cast<float>(transformed_vertex_count) / static_cast<float>(vertex_count),
+        };
+    }
+
+    void optimize_vertex_cache(std::span<uint32_t> indices, const size_t vertex_count)
+    {
+        const auto triangle_count = indices.size() / 3u;
+        if (triangle_count == 0u || vertex_count == 0u)
+        {
+            return;
+        }
+
+        const auto adjacency = get_vertex_triangle_adjacency(indices, vertex_count);
+
+        // Number of triangles referencing each vertex that are yet to be emitted.
+        auto live_triangle_counts = adjacency.triangle_counts;
+
+        auto cache_timestamps = std::vector<uint32_t>(vertex_count, 0u);
+        auto timestamp = VERTEX_CACHE_SIZE + 1u;
+
+        auto emitted_triangles = std::vector<bool>(triangle_count, false);
+        auto output_indices = std::vector<uint32_t>{};
+        output_indices.reserve(indices.size());
+
+        // Recently used vertices, used to find a new fanning vertex when the current one has no candidates.
+        auto dead_end_stack = std::vector<uint32_t>{};
+        auto candidates = std::vector<uint32_t>{};
+
+        // Cursor for the sequential search of vertices with live triangles (used when the dead end stack is empty).
+        auto next_vertex_cursor = size_t{0u};
+
+        const auto skip_dead_end = [&]() -> uint32_t {
+            while (!dead_end_stack.empty())
+            {
+                const auto vertex = dead_end_stack.back();
+                dead_end_stack.pop_back();
+
+                if (live_triangle_counts[vertex] > 0u)
+                {
+                    return vertex;
+                }
+            }
+
+            for (; next_vertex_cursor < vertex_count; ++next_vertex_cursor)
+            {
+                if (live_triangle_counts[next_vertex_cursor] > 0u)
+                {
+                    return static_cast<uint32_t>(next_vertex_cursor);
+                }
+            }
+
+            return INVALID_INDEX_U32;
+        };
+
+        auto fanning_vertex = skip_dead_end();
+        while (fanning_vertex != INVALID_INDEX_U32)
+        {
+            candidates.clear();
+
+            // Emit all the remaining triangles of the fanning vertex.
+            const auto triangles_begin = adjacency.triangles.begin() + adjacency.offsets[fanning_vertex];
+            for (const auto triangle :
+                 std::span(triangles_begin, triangles_begin + adjacency.triangle_counts[fanning_vertex]))
+            {
+                if (emitted_triangles[triangle])
+                {
+                    continue;
+                }
+
+                for (const auto vertex : indices.subspan(triangle * 3u, 3u))
+                {
+                    output_indices.push_back(vertex);
+
+                    dead_end_stack.push_back(vertex);
+                    candidates.push_back(vertex);
+
+                    --live_triangle_counts[vertex];
+
+                    if (timestamp - cache_timestamps[vertex] > VERTEX_CACHE_SIZE)
+                    {
+                        cache_timestamps[vertex] = timestamp++;
+                    }
+                }
+
+                emitted_triangles[triangle] = true;
+            }
+
+            // Pick the candidate that will still be in the cache after all its live triangles are emitted, and that
+            // entered the cache the earliest.
+            auto next_fanning_vertex = INVALID_INDEX_U32;
+            auto highest_priority = -1;
+            for (const auto vertex : candidates)
+            {
+                if (live_triangle_counts[vertex] == 0u)
+                {
+                    continue;
+                }
+
+                auto priority = 0;
+                if (const auto cache_position = static_cast<int32_t>(timestamp - cache_timestamps[vertex]);
+                    cache_position + 2 * static_cast<int32_t>(live_triangle_counts[vertex]) <=
+                    static_cast<int32_t>(VERTEX_CACHE_SIZE))
+                {
+                    priority = cache_position;
+                }
+
+                if (priority > highest_priority)
+                {
+                    highest_priority = priority;
+                    next_fanning_vertex = vertex;
+                }
+            }
+
+            fanning_vertex = next_fanning_vertex != INVALID_INDEX_U32 ? next_fanning_vertex : skip_dead_end();
+        }
+
+        std::copy(output_indices.begin(), output_indices.end(), indices.begin());
+    }
+
+    void optimize_overdraw(std::span<uint32_t> indices, const std::span<const math::XMFLOAT3> positions)
+    {
+        const auto triangle_count = indices.size() / 3u;
+        if (triangle_count == 0u)
+        {
+            return;
+        }
+
+        // Split the triangles into clusters. A new cluster starts at triangles where all three vertices miss the
+        // cache, as these are the points where the vertex cache optimization had to jump to a new region of the mesh.
+        auto cluster_offsets = std::vector<size_t>{};
+
+        auto cache_timestamps = std::vector<uint32_t>(positions.size(), 0u);
+        auto timestamp = VERTEX_CACHE_SIZE + 1u;
+
+        for (const auto triangle : std::views::iota(size_t{0u}, triangle_count))
+        {
+            auto cache_miss_count = 0u;
+            for (const auto vertex : indices.subspan(triangle * 3u, 3u))
+            {
+                if (timestamp - cache_timestamps[vertex] > VERTEX_CACHE_SIZE)
+                {
+                    cache_timestamps[vertex] = timestamp++;
+                    ++cache_miss_count;
+                }
+            }
+
+            if (triangle == 0u || cache_miss_count == 3u)
+            {
+                cluster_offsets.push_back(triangle);
+            }
+        }
+
+        if (cluster_offsets.size() == 1u)
+        {
+            return;
+        }
+
+        cluster_offsets.push_back(triangle_count);
+
+        // The sort key of a cluster is how far out the cluster lies along its own normal, relative to the mesh
+        // centroid. Clusters that are far out and face outward are likely to occlude other clusters.
+        auto mesh_centroid = math::XMVectorZero();
+        for (const auto &position : positions)
+        {
+            mesh_centroid += math::XMLoadFloat3(&position);
+        }
+        mesh_centroid /= static_cast<float>(std::max(positions.size(), size_t{1u}));
+
+        const auto cluster_count = cluster_offsets.size() - 1u;
+
+        auto cluster_sort_keys = std::vector<float>(cluster_count);
+        for (const auto cluster : std::views::iota(size_t{0u}, cluster_count))
+        {
+            auto cluster_centroid = math::XMVectorZero();
+            auto cluster_normal = math::XMVectorZero();
+            auto cluster_area = 0.0f;
+
+            for (const auto triangle : std::views::iota(cluster_offsets[cluster], cluster_offsets[cluster + 1u]))
+            {
+                const auto a = math::XMLoadFloat3(&positions[indices[triangle * 3u + 0u]]);
+                const auto b = math::XMLoadFloat3(&positions[indices[triangle * 3u + 1u]]);
+                const auto c = math::XMLoadFloat3(&positions[indices[triangle * 3u + 2u]]);
+
+                // The length of the cross product is twice the area of the triangle, so the sum of cross products is
+                // an area weighted normal.
+                const auto normal = math::XMVector3Cross(b - a, c - a);
+                const auto area = math::XMVectorGetX(math::XMVector3Length(normal)) * 0.5f;
+
+                cluster_centroid += (a + b + c) * (area / 3.0f);
+                cluster_normal += normal;
+                cluster_area += area;
+            }
+
+            if (cluster_area > 0.0f)
+            {
+                cluster_centroid /= cluster_area;
+            }
+
+            cluster_sort_keys[cluster] = math::XMVectorGetX(
+                math::XMVector3Dot(cluster_centroid - mesh_centroid, math::XMVector3Normalize(cluster_normal)));
+        }
+
+        auto sorted_clusters = std::vector<size_t>(cluster_count);
+        std::iota(sorted_clusters.begin(), sorted_clusters.end(), size_t{0u});
+        std::stable_sort(sorted_clusters.begin(), sorted_clusters.end(), [&](const size_t a, const size_t b) {
+            return cluster_sort_keys[a] > cluster_sort_keys[b];
+        });
+
+        auto output_indices = std::vector<uint32_t>{};
+        output_indices.reserve(indices.size());
+
+        for (const auto cluster : sorted_clusters)
+        {
+            output_indices.insert(output_indices.end(), indices.begin() + cluster_offsets[cluster] * 3u,
+                                  indices.begin() + cluster_offsets[cluster + 1u] * 3u);
+        }
+
+        std::copy(output_indices.begin(), output_indices.end(), indices.begin());
+    }
+
+    namespace
+    {
+        // Compute the bounding sphere and normal cone of the meshlet.
+        // Reference : https://github.com/zeux/meshoptimizer (meshopt_computeMeshletBounds).
+        void compute_meshlet_bounds(Meshlet &meshlet, const MeshletData &meshlet_data,
+                                    const std::span<const math::XMFLOAT3> positions)
+        {
+            const auto meshlet_vertices =
+                std::span(meshlet_data.vertices).subspan(meshlet.vertex_offset, meshlet.vertex_count);
+            const auto meshlet_triangles =
+                std::span(meshlet_data.triangles).subspan(meshlet.triangle_offset, meshlet.triangle_count);
+
+            // Bounding sphere : center of the bounding box, and the distance to the farthest vertex as radius.
+            auto min_position = math::XMVectorReplicate(std::numeric_limits<float>::max());
+            auto max_position = math::XMVectorReplicate(std::numeric_limits<float>::lowest());
+            for (const auto vertex : meshlet_vertices)
+            {
+                min_position = math::XMVectorMin(min_position, math::XMLoadFloat3(&positions[vertex]));
+                max_position = math::XMVectorMax(max_position, math::XMLoadFloat3(&positions[vertex]));
+            }
+
+            const auto center = (min_position + max_position) * 0.5f;
+
+            auto radius = 0.0f;
+            for (const auto vertex : meshlet_vertices)
+            {
+                radius = std::max(radius, math::XMVectorGetX(math::XMVector3Length(
+                                              math::XMLoadFloat3(&positions[vertex]) - center)));
+            }
+
+            math::XMStoreFloat3(&meshlet.center, center);
+            meshlet.radius = radius;
+
+            // Normal cone : the axis is the average of the (normalized) triangle normals, and the cone angle is
+            // determined by the normal that deviates the most from the axis.
+            auto triangle_positions = std::vector<std::array<math::XMVECTOR, 3>>{};
+            auto triangle_normals = std::vector<math::XMVECTOR>{};
+            triangle_positions.reserve(meshlet_triangles.size());
+            triangle_normals.reserve(meshlet_triangles.size());
+
+            auto cone_axis = math::XMVectorZero();
+            for (const auto triangle : meshlet_triangles)
+            {
+                const auto a = math::XMLoadFloat3(&positions[meshlet_vertices[triangle & 0xffu]]);
+                const auto b = math::XMLoadFloat3(&positions[meshlet_vertices[(triangle >> 8u) & 0xffu]]);
+                const auto c = math::XMLoadFloat3(&positions[meshlet_vertices[(triangle >> 16u) & 0xffu]]);
+
+                const auto normal = math::XMVector3Cross(b - a, c - a);
+                if (math::XMVectorGetX(math::XMVector3LengthSq(normal)) == 0.0f)
+                {
+                    // Degenerate triangles do not affect the cone.
+                    continue;
+                }
+
+                triangle_positions.push_back({a, b, c});
+                triangle_normals.push_back(math::XMVector3Normalize(normal));
+                cone_axis += triangle_normals.back();
+            }
+
+            meshlet.cone_apex = meshlet.center;
+            meshlet.cone_cutoff = 1.0f;
+
+            if (triangle_normals.empty() || math::XMVectorGetX(math::XMVector3LengthSq(cone_axis)) == 0.0f)
+            {
+                return;
+            }
+
+            cone_axis = math::XMVector3Normalize(cone_axis);
+
+            auto min_normal_dot = 1.0f;
+            for (const auto &normal : triangle_normals)
+            {
+                min_normal_dot = std::min(min_normal_dot, math::XMVectorGetX(math::XMVector3Dot(normal, cone_axis)));
+            }
+
+            // If the normals span a hemisphere or more, there is no view point from which all triangles are back
+            // facing.
+            if (min_normal_dot <= 0.0f)
+            {
+                return;
+            }
+
+            // The apex is placed such that the planes of all triangles are in front of it along the axis.
+            auto max_t = 0.0f;
+            for (const auto i : std::views::iota(size_t{0u}, triangle_normals.size()))
+            {
+                const auto dc = math::XMVectorGetX(
+                    math::XMVector3Dot(center - triangle_positions[i][0], triangle_normals[i]));
+                const auto dn = math::XMVectorGetX(math::XMVector3Dot(cone_axis, triangle_normals[i]));
+
+                max_t = std::max(max_t, dc / dn);
+            }
+
+            math::XMStoreFloat3(&meshlet.cone_apex, center - cone_axis * max_t);
+            math::XMStoreFloat3(&meshlet.cone_axis, cone_axis);
+
+            // The normal cone has angle acos(min_normal_dot). The cone of view directions from which all triangles
+            // are back facing is the normal cone widened by 90 degrees on each side, which gives
+            // cutoff = -cos(angle + 90) = sin(angle).
+            meshlet.cone_cutoff = std::clamp(std::sqrt(1.0f - min_normal_dot * min_normal_dot), 0.0f, 1.0f);
+        }
+    } // namespace
+
+    MeshletData build_meshlets(const std::span<const uint32_t> indices, const std::span<const math::XMFLOAT3> positions,
+                               const uint32_t max_vertices, const uint32_t max_triangles)
+    {
+        // Local meshlet vertex indices are stored in 8 bits.
+        const auto meshlet_max_vertices = std::clamp(max_vertices, 3u, 256u);
+        const auto meshlet_max_triangles = std::max(max_triangles, 1u);
+
+        auto meshlet_data = MeshletData{};
+        meshlet_data.vertices.reserve(indices.size());
+        meshlet_data.triangles.reserve(indices.size() / 3u);
+
+        // Local index (within the current meshlet) of each vertex, or INVALID_INDEX_U32 if the vertex is not yet part
+        // of the current meshlet.
+        auto local_vertex_indices = std::vector<uint32_t>(positions.size(), INVALID_INDEX_U32);
+
+        auto meshlet = Meshlet{};
+
+        const auto finish_meshlet = [&]() {
+            if (meshlet.triangle_count == 0u)
+            {
+                return;
+            }
+
+            for (const auto vertex :
+                 std::span(meshlet_data.vertices).subspan(meshlet.vertex_offset, meshlet.vertex_count))
+            {
+                local_vertex_indices[vertex] = INVALID_INDEX_U32;
+            }
+
+            meshlet_data.meshlets.push_back(meshlet);
+
+            meshlet = Meshlet{
+                .vertex_offset = static_cast<uint32_t>(meshlet_data.vertices.size()),
+                .triangle_offset = static_cast<uint32_t>(meshlet_data.triangles.size()),
+            };
+        };
+
+        for (const auto triangle : std::views::iota(size_t{0u}, indices.size() / 3u))
+        {
+            const auto triangle_indices = indices.subspan(triangle * 3u, 3u);
+
+            auto new_vertex_count = 0u;
+            for (const auto vertex : triangle_indices)
+            {
+                new_vertex_count += local_vertex_indices[vertex] == INVALID_INDEX_U32 ? 1u : 0u;
+            }
+
+            // Duplicate indices within a triangle are counted twice above, which only makes the check conservative.
+            if (meshlet.vertex_count + new_vertex_count > meshlet_max_vertices ||
+                meshlet.triangle_count + 1u > meshlet_max_triangles)
+            {
+                finish_meshlet();
+            }
+
+            auto packed_triangle = 0u;
+            for (const auto i : std::views::iota(0u, 3u))
+            {
+                const auto vertex = triangle_indices[i];
+                if (local_vertex_indices[vertex] == INVALID_INDEX_U32)
+                {
+                    local_vertex_indices[vertex] = meshlet.vertex_count++;
+                    meshlet_data.vertices.push_back(vertex);
+                }
+
+                packed_triangle |= local_vertex_indices[vertex] << (i * 8u);
+            }
+
+            meshlet_data.triangles.push_back(packed_triangle);
+            ++meshlet.triangle_count;
+        }
+
+        finish_meshlet();
+
+        for (auto &built_meshlet : meshlet_data.meshlets)
+        {
+            compute_meshlet_bounds(built_meshlet, meshlet_data, positions);
+        }
+
+        return meshlet_data;
+    }
+
+    namespace
+    {
+        // Symmetric 4x4 matrix representing the sum of squared distances to a set of planes (weighted by area).
+        // Reference : Surface Simplification Using Quadric Error Metrics (Garland et.al).
+        struct Quadric
+        {
+            double a00{}, a01{}, a02{}, a11{}, a12{}, a22{};
+            double b0{}, b1{}, b2{};
+            double c{};
+            double weight{};
+
+            void add_plane(const math::XMVECTOR normal, const double distance, const double plane_weight)
+            {
+                const auto x = static_cast<double>(math::XMVectorGetX(normal));
+                const auto y = static_cast<double>(math::XMVectorGetY(normal));
+                const auto z = static_cast<double>(math::XMVectorGetZ(normal));
+
+                a00 += plane_weight * x * x;
+                a01 += plane_weight * x * y;
+                a02 += plane_weight * x * z;
+                a11 += plane_weight * y * y;
+                a12 += plane_weight * y * z;
+                a22 += plane_weight * z * z;
+
+                b0 += plane_weight * x * distance;
+                b1 += plane_weight * y * distance;
+                b2 += plane_weight * z * distance;
+
+                c += plane_weight * distance * distance;
+                weight += plane_weight;
+            }
+
+            Quadric &operator+=(const Quadric &other)
+            {
+                a00 += other.a00;
+                a01 += other.a01;
+                a02 += other.a02;
+                a11 += other.a11;
+                a12 += other.a12;
+                a22 += other.a22;
+
+                b0 += other.b0;
+                b1 += other.b1;
+                b2 += other.b2;
+
+                c += other.c;
+                weight += other.weight;
+
+                return *this;
+            }
+
+            // Returns the (area weighted) average squared distance of the point to the planes of the quadric.
+            double get_error(const math::XMFLOAT3 &position) const
+            {
+                const auto x = static_cast<double>(position.x);
+                const auto y = static_cast<double>(position.y);
+                const auto z = static_cast<double>(position.z);
+
+                const auto error = a00 * x * x + a11 * y * y + a22 * z * z +
+                                   2.0 * (a01 * x * y + a02 * x * z + a12 * y * z) +
+                                   2.0 * (b0 * x + b1 * y + b2 * z) + c;
+
+                return weight > 0.0 ? std::max(error, 0.0) / weight : 0.0;
+            }
+        };
+
+        struct EdgeCollapse
+        {
+            uint32_t source_vertex{};
+            uint32_t target_vertex{};
+
+            double cost{};
+            double geometric_error{};
+        };
+
+        // Length of the largest side of the bounding box of the positions.
+        float get_mesh_extent(const std::span<const math::XMFLOAT3> positions)
+        {
+            if (positions.empty())
+            {
+                return 0.0f;
+            }
+
+            auto min_position = math::XMLoadFloat3(&positions[0]);
+            auto max_position = min_position;
+            for (const auto &position : positions)
+            {
+                min_position = math::XMVectorMin(min_position, math::XMLoadFloat3(&position));
+                max_position = math::XMVectorMax(max_position, math::XMLoadFloat3(&position));
+            }
+
+            auto extent = math::XMFLOAT3{};
+            math::XMStoreFloat3(&extent, max_position - min_position);
+
+            return std::max({extent.x, extent.y, extent.z});
+        }
+
+        // Weight of the attribute (normal and texture coord) difference in the cost of an edge collapse, relative to
+        // the mesh extent. An attribute difference of 1 costs as much as moving the surface by 1% of the extent.
+        static constexpr auto ATTRIBUTE_ERROR_WEIGHT = 0.01f;
+    } // namespace
+
+    MeshLod simplify(const std::span<const uint32_t> indices, const std::span<const math::XMFLOAT3> positions,
+                     const std::span<const math::XMFLOAT3> normals,
+                     const std::span<const math::XMFLOAT2> texture_coords, const size_t target_index_count,
+                     const float max_error)
+    {
+        auto lod = MeshLod{
+            .indices = std::vector<uint32_t>(indices.begin(), indices.end()),
+        };
+
+        const auto vertex_count = positions.size();
+        if (indices.size() <= target_index_count || vertex_count == 0u)
+        {
+            return lod;
+        }
+
+        const auto has_normals = normals.size() == vertex_count;
+        const auto has_texture_coords = texture_coords.size() == vertex_count;
+
+        // Vertices sharing a position (for ex. at texture / normal seams) are welded, so that the topology (borders)
+        // can be determined. Vertices that share their position with other vertices are locked (moving only one of
+        // them would create cracks).
+        auto sorted_vertices = std::vector<uint32_t>(vertex_count);
+        std::iota(sorted_vertices.begin(), sorted_vertices.end(), 0u);
+
+        const auto position_less = [&](const uint32_t a, const uint32_t b) {
+            return std::tie(positions[a].x, positions[a].y, positions[a].z) <
+                   std::tie(positions[b].x, positions[b].y, positions[b].z);
+        };
+        std::sort(sorted_vertices.begin(), sorted_vertices.end(), position_less);
+
+        auto position_ids = std::vector<uint32_t>(vertex_count);
+        auto locked_vertices = std::vector<bool>(vertex_count, false);
+
+        for (auto i = size_t{0u}; i < vertex_count;)
+        {
+            auto j = i + 1u;
+            while (j < vertex_count && !position_less(sorted_vertices[i], sorted_vertices[j]))
+            {
+                ++j;
+            }
+
+            for (const auto k : std::views::iota(i, j))
+            {
+                position_ids[sorted_vertices[k]] = sorted_vertices[i];
+                locked_vertices[sorted_vertices[k]] = j - i > 1u;
+            }
+
+            i = j;
+        }
+
+        // Lock vertices on borders (edges used by a single triangle) and non manifold edges (edges used by more than
+        // two triangles).
+        auto edge_counts = std::unordered_map<uint64_t, uint32_t>{};
+        edge_counts.reserve(indices.size());
+
+        const auto get_edge_key = [&](const uint32_t a, const uint32_t b) {
+            return (static_cast<uint64_t>(position_ids[a]) << 32u) | static_cast<uint64_t>(position_ids[b]);
+        };
+
+        for (const auto triangle : std::views::iota(size_t{0u}, indices.size() / 3u))
+        {
+            for (const auto edge : std::views::iota(size_t{0u}, size_t{3u}))
+            {
+                ++edge_counts[get_edge_key(indices[triangle * 3u + edge], indices[triangle * 3u + (edge + 1u) % 3u])];
+            }
+        }
+
+        for (const auto triangle : std::views::iota(size_t{0u}, indices.size() / 3u))
+        {
+            for (const auto edge : std::views::iota(size_t{0u}, size_t{3u}))
+            {
+                const auto a = indices[triangle * 3u + edge];
+                const auto b = indices[triangle * 3u + (edge + 1u) % 3u];
+
+                const auto opposite_edge = edge_counts.find(get_edge_key(b, a));
+                if (edge_counts[get_edge_key(a, b)] != 1u || opposite_edge == edge_counts.end() ||
+                    opposite_edge->second != 1u)
+                {
+                    locked_vertices[a] = true;
+                    locked_vertices[b] = true;
+                }
+            }
+        }
+
+        // Setup the quadrics (the planes of all triangles around each vertex).
+        auto quadrics = std::vector<Quadric>(vertex_count);
+        for (const auto triangle : std::views::iota(size_t{0u}, indices.size() / 3u))
+        {
+            const auto a = math::XMLoadFloat3(&positions[indices[triangle * 3u + 0u]]);
+            const auto b = math::XMLoadFloat3(&positions[indices[triangle * 3u + 1u]]);
+            const auto c = math::XMLoadFloat3(&positions[indices[triangle * 3u + 2u]]);
+
+            const auto cross = math::XMVector3Cross(b - a, c - a);
+            const auto area = math::XMVectorGetX(math::XMVector3Length(cross)) * 0.5f;
+            if (area == 0.0f)
+            {
+                continue;
+            }
+
+            const auto normal = math::XMVector3Normalize(cross);
+            const auto distance = -static_cast<double>(math::XMVectorGetX(math::XMVector3Dot(normal, a)));
+
+            for (const auto vertex : indices.subspan(triangle * 3u, 3u))
+            {
+                quadrics[vertex].add_plane(normal, distance, area);
+            }
+        }
+
+        const auto mesh_extent = get_mesh_extent(positions);
+        const auto max_error_squared = static_cast<double>(max_error) * max_error;
+        const auto attribute_error_scale =
+            static_cast<double>(mesh_extent * ATTRIBUTE_ERROR_WEIGHT) * (mesh_extent * ATTRIBUTE_ERROR_WEIGHT);
+
+        const auto get_attribute_error = [&](const uint32_t a, const uint32_t b) {
+            auto error = 0.0f;
+            if (has_normals)
+            {
+                error += math::XMVectorGetX(math::XMVector3LengthSq(math::XMLoadFloat3(&normals[a]) -
+                                                                    math::XMLoadFloat3(&normals[b])));
+            }
+
+            if (has_texture_coords)
+            {
+                const auto du = texture_coords[a].x - texture_coords[b].x;
+                const auto dv = texture_coords[a].y - texture_coords[b].y;
+                error += du * du + dv * dv;
+            }
+
+            return static_cast<double>(error) * attribute_error_scale;
+        };
+
+        // Returns true if moving the source vertex onto the target vertex flips (or degenerates) any of the triangles
+        // around the source vertex that are not removed by the collapse.
+        const auto does_collapse_flip_triangles = [&](const std::span<const uint32_t> source_vertex_triangles,
+                                                      const uint32_t source_vertex, const uint32_t target_vertex) {
+            const auto target_position = math::XMLoadFloat3(&positions[target_vertex]);
+
+            for (const auto triangle : source_vertex_triangles)
+            {
+                const auto triangle_indices = std::span(lod.indices).subspan(triangle * 3u, 3u);
+                if (std::ranges::find(triangle_indices, target_vertex) != triangle_indices.end())
+                {
+                    continue;
+                }
+
+                auto old_positions = std::array<math::XMVECTOR, 3>{};
+                auto new_positions = std::array<math::XMVECTOR, 3>{};
+                for (const auto i : std::views::iota(0u, 3u))
+                {
+                    old_positions[i] = math::XMLoadFloat3(&positions[triangle_indices[i]]);
+                    new_positions[i] = triangle_indices[i] == source_vertex ? target_position : old_positions[i];
+                }
+
+                const auto old_normal = math::XMVector3Cross(old_positions[1] - old_positions[0],
+                                                             old_positions[2] - old_positions[0]);
+                const auto new_normal = math::XMVector3Cross(new_positions[1] - new_positions[0],
+                                                             new_positions[2] - new_positions[0]);
+
+                if (math::XMVectorGetX(math::XMVector3Dot(old_normal, new_normal)) <= 0.0f)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        };
+
+        auto result_error_squared = 0.0;
+
+        // Each pass collapses the cheapest edges (at most one collapse per neighborhood), until the target index count
+        // or error limit is reached.
+        while (lod.indices.size() > target_index_count)
+        {
+            const auto triangle_count = lod.indices.size() / 3u;
+
+            // Triangles around each vertex.
+            auto triangle_counts = std::vector<uint32_t>(vertex_count + 1u, 0u);
+            for (const auto index : lod.indices)
+            {
+                ++triangle_counts[index + 1u];
+            }
+
+            std::partial_sum(triangle_counts.begin(), triangle_counts.end(), triangle_counts.begin());
+
+            auto vertex_triangles = std::vector<uint32_t>(lod.indices.size());
+            auto write_offsets = triangle_counts;
+            for (const auto i : std::views::iota(size_t{0u}, lod.indices.size()))
+            {
+                vertex_triangles[write_offsets[lod.indices[i]]++] = static_cast<uint32_t>(i / 3u);
+            }
+
+            const auto get_vertex_triangles = [&](const uint32_t vertex) {
+                return std::span(vertex_triangles)
+                    .subspan(triangle_counts[vertex], triangle_counts[vertex + 1u] - triangle_counts[vertex]);
+            };
+
+            // Gather and sort the candidate collapses.
+            auto edge_collapses = std::vector<EdgeCollapse>{};
+            edge_collapses.reserve(lod.indices.size());
+
+            for (const auto triangle : std::views::iota(size_t{0u}, triangle_count))
+            {
+                for (const auto edge : std::views::iota(size_t{0u}, size_t{3u}))
+                {
+                    const auto source_vertex = static_cast<uint32_t>(lod.indices[triangle * 3u + edge]);
+                    const auto target_vertex = static_cast<uint32_t>(lod.indices[triangle * 3u + (edge + 1u) % 3u]);
+
+                    for (const auto &[from, to] : {std::pair{source_vertex, target_vertex},
+                                                  std::pair{target_vertex, source_vertex}})
+                    {
+                        if (locked_vertices[from] || from == to)
+                        {
+                            continue;
+                        }
+
+                        auto collapse_quadric = quadrics[from];
+                        collapse_quadric += quadrics[to];
+
+                        const auto geometric_error = collapse_quadric.get_error(positions[to]);
+
+                        edge_collapses.emplace_back(EdgeCollapse{
+                            .source_vertex = from,
+                            .target_vertex = to,
+                            .cost = geometric_error + get_attribute_error(from, to),
+                            .geometric_error = geometric_error,
+                        });
+                    }
+                }
+            }
+
+            std::sort(edge_collapses.begin(), edge_collapses.end(),
+                      [](const EdgeCollapse &a, const EdgeCollapse &b) { return a.cost < b.cost; });
+
+            // Apply the collapses. Vertices around a collapsed vertex are not touched again in this pass, so that the
+            // flip checks remain valid.
+            auto remap = std::vector<uint32_t>(vertex_count);
+            std::iota(remap.begin(), remap.end(), 0u);
+
+            auto touched_vertices = std::vector<bool>(vertex_count, false);
+
+            const auto triangles_to_remove = (lod.indices.size() - target_index_count + 2u) / 3u;
+            auto removed_triangle_count = size_t{0u};
+
+            for (const auto &edge_collapse : edge_collapses)
+            {
+                if (edge_collapse.cost > max_error_squared || removed_triangle_count >= triangles_to_remove)
+                {
+                    break;
+                }
+
+                const auto source_vertex = edge_collapse.source_vertex;
+                const auto target_vertex = edge_collapse.target_vertex;
+
+                if (touched_vertices[source_vertex] || touched_vertices[target_vertex])
+                {
+                    continue;
+                }
+
+                const auto source_vertex_triangles = get_vertex_triangles(source_vertex);
+                if (does_collapse_flip_triangles(source_vertex_triangles, source_vertex, target_vertex))
+                {
+                    continue;
+                }
+
+                remap[source_vertex] = target_vertex;
+                quadrics[target_vertex] += quadrics[source_vertex];
+
+                for (const auto triangle : source_vertex_triangles)
+                {
+                    const auto triangle_indices = std::span(lod.indices).subspan(triangle * 3u, 3u);
+
+                    for (const auto vertex : triangle_indices)
+                    {
+                        touched_vertices[vertex] = true;
+                    }
+
+                    if (std::ranges::find(triangle_indices, target_vertex) != triangle_indices.end())
+                    {
+                        ++removed_triangle_count;
+                    }
+                }
+
+                result_error_squared = std::max(result_error_squared, edge_collapse.geometric_error);
+            }
+
+            if (removed_triangle_count == 0u)
+            {
+                break;
+            }
+
+            // Rewrite the index buffer and remove the triangles that became degenerate.
+            auto write_index = size_t{0u};
+            for (const auto triangle : std::views::iota(size_t{0u}, triangle_count))
+            {
+                const auto a = remap[lod.indices[triangle * 3u + 0u]];
+                const auto b = remap[lod.indices[triangle * 3u + 1u]];
+                const auto c = remap[lod.indices[triangle * 3u + 2u]];
+
+                if (a != b && b != c && a != c)
+                {
+                    lod.indices[write_index++] = a;
+                    lod.indices[write_index++] = b;
+                    lod.indices[write_index++] = c;
+                }
+            }
+
+            lod.indices.resize(write_index);
+        }
+
+        lod.error = static_cast<float>(std::sqrt(result_error_squared));
+
+        return lod;
+    }
+
+    std::vector<MeshLod> generate_lods(const std::span<const uint32_t> indices,
+                                       const std::span<const math::XMFLOAT3> positions,
+                                       const std::span<const math::XMFLOAT3> normals,
+                                       const std::span<const math::XMFLOAT2> texture_coords,
+                                       const uint32_t max_lod_count, const float triangle_ratio, const float max_error)
+    {
+        auto lods = std::vector<MeshLod>{};
+
+        const auto max_lod_error = max_error * get_mesh_extent(positions);
+
+        // Each level is simplified from the previous one, so the errors add up.
+        auto previous_lod_indices = std::span(indices);
+        auto previous_lod_error = 0.0f;
+
+        for ([[maybe_unused]] const auto i : std::views::iota(0u, max_lod_count))
+        {
+            const auto target_index_count =
+                static_cast<size_t>(static_cast<float>(previous_lod_indices.size() / 3u) * triangle_ratio) * 3u;
+
+            auto lod = simplify(previous_lod_indices, positions, normals, texture_coords, target_index_count,
+                                max_lod_error - previous_lod_error);
+
+            // Stop once simplification is no longer able to reduce the triangle count significantly.
+            if (lod.indices.empty() ||
+                static_cast<float>(lod.indices.size()) > static_cast<float>(previous_lod_indices.size()) * 0.9f)
+            {
+                break;
+            }
+
+            optimize_vertex_cache(lod.indices, positions.size());
+
+            lod.error += previous_lod_error;
+            previous_lod_error = lod.error;
+
+            lods.emplace_back(std::move(lod));
+            previous_lod_indices = lods.back().indices;
+        }
+
+        return lods;
+    }
+
+    bool is_meshlet_back_facing(const Meshlet &meshlet, const math::XMFLOAT3 camera_position)
+    {
+        if (meshlet.cone_cutoff >= 1.0f)
+        {
+            return false;
+        }
+
+        const auto view_direction =
+            math::XMVector3Normalize(math::XMLoadFloat3(&meshlet.cone_apex) - math::XMLoadFloat3(&camera_position));
+
+        return math::XMVectorGetX(math::XMVector3Dot(view_direction, math::XMLoadFloat3(&meshlet.cone_axis))) >=
+               meshlet.cone_cutoff;
+    }
+
+    bool is_meshlet_outside_planes(const Meshlet &meshlet, const std::span<const math::XMFLOAT4> planes)
+    {
+        const auto center = math::XMLoadFloat3(&meshlet.center);
+
+        return std::ranges::any_of(planes, [&](const math::XMFLOAT4 &plane) {
+            return math::XMVectorGetX(math::XMVector3Dot(center, math::XMLoadFloat4(&plane))) + plane.w <
+                   -meshlet.radius;
+        });
+    }
+
+    void optimize_vertex_fetch(MeshData &mesh_data)
+    {
+        const auto vertex_count = mesh_data.positions.size();
+
+        auto remap = std::vector<uint32_t>(vertex_count, INVALID_INDEX_U32);
+        auto new_vertex_count = 0u;
+
+        for (auto &index : mesh_data.indices)
+        {
+            if (remap[index] == INVALID_INDEX_U32)
+            {
+                remap[index] = new_vertex_count++;
+            }
+
+            index = remap[index];
+        }
+
+        // Streams can have multiple elements per vertex (for ex. 16 bit snorm quantized normals).
+        const auto remap_vertex_stream = [&]<typename T>(std::vector<T> &vertex_stream,
+                                                         const size_t elements_per_vertex = 1u) {
+            if (vertex_stream.size() != vertex_count * elements_per_vertex)
+            {
+                return;
+            }
+
+            auto remapped_vertex_stream = std::vector<T>(new_vertex_count * elements_per_vertex);
+            for (const auto i : std::views::iota(size_t{0u}, vertex_count))
+            {
+                if (remap[i] != INVALID_INDEX_U32)
+                {
+                    std::copy_n(vertex_stream.begin() + i * elements_per_vertex, elements_per_vertex,
+                                remapped_vertex_stream.begin() + remap[i] * elements_per_vertex);
+                }
+            }
+
+            vertex_stream = std::move(remapped_vertex_stream);
+        };
+
+        remap_vertex_stream(mesh_data.positions);
+        remap_vertex_stream(mesh_data.normals);
+        remap_vertex_stream(mesh_data.texture_coords);
+
+        auto &quantized_vertex_data = mesh_data.quantized_vertex_data;
+        remap_vertex_stream(quantized_vertex_data.positions);
+        remap_vertex_stream(quantized_vertex_data.normals,
+                            VertexQuantization::get_normal_stride(quantized_vertex_data.normal_encoding));
+        remap_vertex_stream(quantized_vertex_data.texture_coords);
+    }
+} // namespace serenity::asset::MeshOptimizer
\ No newline at end of file
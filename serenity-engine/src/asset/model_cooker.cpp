@@ -0,0 +1,230 @@
+#include "serenity-engine/asset/model_cooker.hpp"
+
+#include "serenity-engine/core/file_system.hpp"
+
+namespace serenity::asset::ModelCooker
+{
+    void cook_model(const std::string_view model_path, const std::string_view cooked_model_path,
+                    const ModelImportConfig &import_config)
+    {
+        write_cooked_model(ModelLoader::load_model(model_path, import_config), cooked_model_path);
+    }
+
+    void write_cooked_model(const ModelData &model_data, const std::string_view cooked_model_path)
+    {
+        const auto align = [](const uint64_t offset) {
+            return (offset + COOKED_MODEL_SECTION_ALIGNMENT - 1u) / COOKED_MODEL_SECTION_ALIGNMENT *
+                   COOKED_MODEL_SECTION_ALIGNMENT;
+        };
+
+        auto header = CookedModelHeader{
+            .mesh_count = static_cast<uint32_t>(model_data.mesh_data.size()),
+            .material_count = static_cast<uint32_t>(model_data.material_data.size()),
+            .texture_count = static_cast<uint32_t>(model_data.textures.size()),
+        };
+
+        // Each mesh is placed in the 16 bit or 32 bit index stream, depending on its index format.
+        const auto get_index_count = [&](const IndexFormat index_format) -> uint64_t & {
+            return index_format == IndexFormat::Uint32 ? header.index_32_count : header.index_count;
+        };
+
+        // Setup the mesh, material and texture tables (the offsets of each mesh into the streams are computed here as
+        // well).
+        auto meshes = std::vector<CookedMesh>{};
+        meshes.reserve(model_data.mesh_data.size());
+
+        for (const auto &mesh_data : model_data.mesh_data)
+        {
+            auto &mesh = meshes.emplace_back(CookedMesh{
+                .vertex_offset = static_cast<uint32_t>(header.vertex_count),
+                .vertex_count = static_cast<uint32_t>(mesh_data.positions.size()),
+                .index_offset = static_cast<uint32_t>(get_index_count(mesh_data.index_format)),
+                .index_count = static_cast<uint32_t>(mesh_data.indices.size()),
+                .material_index = mesh_data.material_index,
+
+                .meshlet_offset = static_cast<uint32_t>(header.meshlet_count),
+                .meshlet_count = static_cast<uint32_t>(mesh_data.meshlet_data.meshlets.size()),
+                .meshlet_vertex_offset = static_cast<uint32_t>(header.meshlet_vertex_count),
+                .meshlet_vertex_count = static_cast<uint32_t>(mesh_data.meshlet_data.vertices.size()),
+                .meshlet_triangle_offset = static_cast<uint32_t>(header.meshlet_triangle_count),
+                .meshlet_triangle_count = static_cast<uint32_t>(mesh_data.meshlet_data.triangles.size()),
+
+                .lod_offset = static_cast<uint32_t>(header.lod_count),
+                .lod_count = static_cast<uint32_t>(mesh_data.lods.size()),
+
+                .index_format = mesh_data.index_format,
+
+                .bounding_sphere = mesh_data.bounding_sphere,
+                .bounding_box_min = mesh_data.bounding_box_min,
+                .bounding_box_max = mesh_data.bounding_box_max,
+            });
+
+            math::XMStoreFloat4x4(&mesh.mesh_local_transform_matrix, mesh_data.mesh_local_transform_matrix);
+            math::XMStoreFloat4x4(&mesh.inverse_mesh_local_transform_matrix,
+                                  mesh_data.inverse_mesh_local_transform_matrix);
+
+            if (mesh_data.normals.size() != mesh_data.positions.size() ||
+                mesh_data.texture_coords.size() != mesh_data.positions.size())
+            {
+                core::Log::instance().critical(
+                    std::format("Cannot cook model {} : vertex attribute counts do not match", cooked_model_path));
+            }
+
+            header.vertex_count += mesh_data.positions.size();
+            get_index_count(mesh_data.index_format) += mesh_data.indices.size();
+
+            header.meshlet_count += mesh_data.meshlet_data.meshlets.size();
+            header.meshlet_vertex_count += mesh_data.meshlet_data.vertices.size();
+            header.meshlet_triangle_count += mesh_data.meshlet_data.triangles.size();
+
+            header.lod_count += static_cast<uint32_t>(mesh_data.lods.size());
+        }
+
+        // The LOD indices are placed after the indices of all meshes (in the index stream of their mesh), so the full
+        // detail indices remain contiguous.
+        auto lods = std::vector<CookedMeshLod>{};
+        lods.reserve(header.lod_count);
+
+        for (const auto &mesh_data : model_data.mesh_data)
+        {
+            for (const auto &lod : mesh_data.lods)
+            {
+                lods.emplace_back(CookedMeshLod{
+                    .index_offset = static_cast<uint32_t>(get_index_count(mesh_data.index_format)),
+                    .index_count = static_cast<uint32_t>(lod.indices.size()),
+                    .error = lod.error,
+                });
+
+                get_index_count(mesh_data.index_format) += lod.indices.size();
+            }
+        }
+
+        auto materials = std::vector<CookedMaterial>{};
+        materials.reserve(model_data.material_data.size());
+
+        for (const auto &material_data : model_data.material_data)
+        {
+            materials.emplace_back(CookedMaterial{
+                .base_color = material_data.base_color,
+                .metallic_roughness_factor = material_data.metallic_roughness_factor,
+                .normal_scale = material_data.normal_scale,
+                .occlusion_strength = material_data.occlusion_strength,
+                .emissive_factor = material_data.emissive_factor,
+                .texture_coord_transform = material_data.texture_coord_transform,
+                .texture_indices = material_data.texture_indices,
+            });
+        }
+
+        auto textures = std::vector<CookedTexture>{};
+        textures.reserve(model_data.textures.size());
+
+        for (const auto &texture : model_data.textures)
+        {
+            const auto texture_data = std::get_if<std::vector<uint8_t>>(&texture.data);
+            if (texture_data == nullptr)
+            {
+                core::Log::instance().critical(
+                    std::format("Only 8 bit textures can be cooked (cooked model : {})", cooked_model_path));
+            }
+
+            const auto &cooked_texture = textures.emplace_back(CookedTexture{
+                .dimension = texture.dimension,
+                .offset = align(header.texture_data_size),
+                .size = texture_data->size(),
+                .mip_levels = texture.mip_levels,
+                .compression = texture.compression,
+            });
+
+            header.texture_data_size = cooked_texture.offset + cooked_texture.size;
+        }
+
+        // Compute the section offsets.
+        header.meshes_offset = align(sizeof(CookedModelHeader));
+        header.lods_offset = align(header.meshes_offset + sizeof(CookedMesh) * header.mesh_count);
+        header.materials_offset = align(header.lods_offset + sizeof(CookedMeshLod) * header.lod_count);
+        header.textures_offset = align(header.materials_offset + sizeof(CookedMaterial) * header.material_count);
+        header.positions_offset = align(header.textures_offset + sizeof(CookedTexture) * header.texture_count);
+        header.normals_offset = align(header.positions_offset + sizeof(math::XMFLOAT3) * header.vertex_count);
+        header.texture_coords_offset = align(header.normals_offset + sizeof(math::XMFLOAT3) * header.vertex_count);
+        header.indices_offset = align(header.texture_coords_offset + sizeof(math::XMFLOAT2) * header.vertex_count);
+        header.indices_32_offset = align(header.indices_offset + sizeof(uint16_t) * header.index_count);
+        header.meshlets_offset = align(header.indices_32_offset + sizeof(uint32_t) * header.index_32_count);
+        header.meshlet_vertices_offset = align(header.meshlets_offset + sizeof(Meshlet) * header.meshlet_count);
+        header.meshlet_triangles_offset =
+            align(header.meshlet_vertices_offset + sizeof(uint32_t) * header.meshlet_vertex_count);
+        header.texture_data_offset =
+            align(header.meshlet_triangles_offset + sizeof(uint32_t) * header.meshlet_triangle_count);
+
+        auto file_data = std::vector<std::byte>(header.texture_data_offset + header.texture_data_size);
+
+        const auto write = [&](const uint64_t offset, const auto &data) {
+            std::memcpy(file_data.data() + offset, data.data(), data.size() * sizeof(data[0]));
+        };
+
+        // Indices are narrowed to 16 bits for meshes that use the 16 bit index stream.
+        const auto write_indices = [&](const IndexFormat index_format, const uint32_t index_offset,
+                                       const std::span<const uint32_t> indices) {
+            if (index_format == IndexFormat::Uint32)
+            {
+                write(header.indices_32_offset + sizeof(uint32_t) * index_offset, indices);
+                return;
+            }
+
+            auto *destination = file_data.data() + header.indices_offset + sizeof(uint16_t) * index_offset;
+            for (const auto index : indices)
+            {
+                const auto narrowed_index = static_cast<uint16_t>(index);
+                std::memcpy(destination, &narrowed_index, sizeof(uint16_t));
+                destination += sizeof(uint16_t);
+            }
+        };
+
+        std::memcpy(file_data.data(), &header, sizeof(CookedModelHeader));
+        write(header.meshes_offset, meshes);
+        write(header.lods_offset, lods);
+        write(header.materials_offset, materials);
+        write(header.textures_offset, textures);
+
+        for (const auto i : std::views::iota(0u, header.mesh_count))
+        {
+            const auto &mesh = meshes[i];
+            const auto &mesh_data = model_data.mesh_data[i];
+
+            write(header.positions_offset + sizeof(math::XMFLOAT3) * mesh.vertex_offset, mesh_data.positions);
+            write(header.normals_offset + sizeof(math::XMFLOAT3) * mesh.vertex_offset, mesh_data.normals);
+            write(header.texture_coords_offset + sizeof(math::XMFLOAT2) * mesh.vertex_offset, mesh_data.texture_coords);
+            write_indices(mesh.index_format, mesh.index_offset, mesh_data.indices);
+
+            write(header.meshlets_offset + sizeof(Meshlet) * mesh.meshlet_offset, mesh_data.meshlet_data.meshlets);
+            write(header.meshlet_vertices_offset + sizeof(uint32_t) * mesh.meshlet_vertex_offset,
+                  mesh_data.meshlet_data.vertices);
+            write(header.meshlet_triangles_offset + sizeof(uint32_t) * mesh.meshlet_triangle_offset,
+                  mesh_data.meshlet_data.triangles);
+
+            for (const auto j : std::views::iota(0u, mesh.lod_count))
+            {
+                write_indices(mesh.index_format, lods[mesh.lod_offset + j].index_offset, mesh_data.lods[j].indices);
+            }
+        }
+
+        for (const auto i : std::views::iota(0u, header.texture_count))
+        {
+            write(header.texture_data_offset + textures[i].offset,
+                  std::get<std::vector<uint8_t>>(model_data.textures[i].data));
+        }
+
+        const auto path = core::FileSystem::instance().get_absolute_path(cooked_model_path);
+
+        auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            core::Log::instance().critical(std::format("Failed to open file {} for writing cooked model", path));
+        }
+
+        file.write(reinterpret_cast<const char *>(file_data.data()), static_cast<std::streamsize>(file_data.size()));
+
+        core::Log::instance().info(std::format("Cooked model with path : {} ({} meshes, {} vertices, {} indices)",
+                                               cooked_model_path, header.mesh_count, header.vertex_count,
+                                               header.index_count + header.index_32_count));
+    }
+} // namespace serenity::asset::ModelCooker
\ No newline at end of file
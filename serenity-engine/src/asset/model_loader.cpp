@@ -1,6 +1,11 @@
 #include "serenity-engine/asset/model_loader.hpp"
 
+#include "serenity-engine/asset/texture_atlas.hpp"
+#include "serenity-engine/asset/texture_compressor.hpp"
+
+#include "serenity-engine/core/async_file_loader.hpp"
 #include "serenity-engine/core/file_system.hpp"
+#include "serenity-engine/core/job_system.hpp"
 
 #include <fastgltf/parser.hpp>
 #include <fastgltf/tools.hpp>
@@ -15,14 +20,14 @@
 namespace fastgltf
 {
     template <>
-    struct fastgltf::ElementTraits<math::XMFLOAT3>
-        : fastgltf::ElementTraitsBase<math::XMFLOAT3, fastgltf::AccessorType::Vec3, float>
+    struct ElementTraits<math::XMFLOAT3>
+        : ElementTraitsBase<math::XMFLOAT3, AccessorType::Vec3, float>
     {
     };
 
     template <>
-    struct fastgltf::ElementTraits<math::XMFLOAT2>
-        : fastgltf::ElementTraitsBase<math::XMFLOAT2, fastgltf::AccessorType::Vec2, float>
+    struct ElementTraits<math::XMFLOAT2>
+        : ElementTraitsBase<math::XMFLOAT2, AccessorType::Vec2, float>
     {
     };
 } // namespace fastgltf
@@ -31,18 +36,474 @@ using namespace math;
 
 namespace serenity::asset::ModelLoader
 {
+    // Raw view into the bytes of the buffer an accessor points to.
+    struct AccessorDataView
+    {
+        const std::byte *data{};
+        size_t byte_stride{};
+        size_t element_byte_size{};
+    };
+
+    // Views of the data of each buffer of the gltf asset (indexed by buffer index). The binary chunk of glb files and
+    // external buffers are used directly from the memory mapped files, so the buffer data is never copied.
+    using BufferDataViews = std::vector<std::span<const std::byte>>;
+
+    // Returns a view into the accessor data if the accessor is not sparse (i.e the data can be read directly without
+    // going through fastgltf's per element iteration).
+    std::optional<AccessorDataView> get_accessor_data_view(const fastgltf::Asset &asset,
+                                                           const BufferDataViews &buffers,
+                                                           const fastgltf::Accessor &accessor)
+    {
+        if (accessor.sparse.has_value() || !accessor.bufferViewIndex.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const auto &buffer_view = asset.bufferViews.at(accessor.bufferViewIndex.value());
+        const auto &buffer_data = buffers.at(buffer_view.bufferIndex);
+
+        const auto element_byte_size =
+            fastgltf::getNumComponents(accessor.type) * fastgltf::getComponentBitSize(accessor.componentType) / 8u;
+        const auto byte_stride = buffer_view.byteStride.value_or(element_byte_size);
+        const auto byte_offset = buffer_view.byteOffset + accessor.byteOffset;
+
+        if (element_byte_size == 0u || byte_stride < element_byte_size ||
+            (accessor.count != 0u &&
+             byte_offset + (accessor.count - 1u) * byte_stride + element_byte_size > buffer_data.size()))
+        {
+            return std::nullopt;
+        }
+
+        return AccessorDataView{
+            .data = buffer_data.data() + byte_offset,
+            .byte_stride = byte_stride,
+            .element_byte_size = element_byte_size,
+        };
+    }
+
+    // Convert integer components to floats. Normalized components are mapped to [0, 1] (unsigned) or [-1, 1] (signed)
+    // as per the gltf spec.
+    template <typename Component>
+    void convert_components_to_float(const Component *source, float *destination, const size_t count,
+                                     const bool normalized)
+    {
+        static_assert(std::is_integral_v<Component> && sizeof(Component) <= 2u);
+
+        const auto scale = normalized ? 1.0f / static_cast<float>(std::numeric_limits<Component>::max()) : 1.0f;
+        const auto min_value = normalized && std::is_signed_v<Component> ? -1.0f : std::numeric_limits<float>::lowest();
+
+        auto i = size_t{0u};
+
+#if defined(_XM_SSE_INTRINSICS_)
+        // Converts 8 16 bit integers (sign / zero extended from the source) per iteration.
+        const auto scale_vector = _mm_set1_ps(scale);
+        const auto min_vector = _mm_set1_ps(min_value);
+
+        const auto store_converted = [&](const __m128i low, const __m128i high, float *output) {
+            _mm_storeu_ps(output, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(low), scale_vector), min_vector));
+            _mm_storeu_ps(output + 4u, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(high), scale_vector), min_vector));
+        };
+
+        const auto widen_16_bit = [&](const __m128i values, float *output) {
+            if constexpr (std::is_signed_v<Component>)
+            {
+                store_converted(_mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16),
+                                _mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16), output);
+            }
+            else
+            {
+                const auto zero = _mm_setzero_si128();
+                store_converted(_mm_unpacklo_epi16(values, zero), _mm_unpackhi_epi16(values, zero), output);
+            }
+        };
+
+        if constexpr (sizeof(Component) == 1u)
+        {
+            for (; i + 16u <= count; i += 16u)
+            {
+                const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+
+                if constexpr (std::is_signed_v<Component>)
+                {
+                    widen_16_bit(_mm_srai_epi16(_mm_unpacklo_epi8(values, values), 8), destination + i);
+                    widen_16_bit(_mm_srai_epi16(_mm_unpackhi_epi8(values, values), 8), destination + i + 8u);
+                }
+                else
+                {
+                    const auto zero = _mm_setzero_si128();
+                    widen_16_bit(_mm_unpacklo_epi8(values, zero), destination + i);
+                    widen_16_bit(_mm_unpackhi_epi8(values, zero), destination + i + 8u);
+                }
+            }
+        }
+        else
+        {
+            for (; i + 8u <= count; i += 8u)
+            {
+                widen_16_bit(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i)), destination + i);
+            }
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            destination[i] = std::max(static_cast<float>(source[i]) * scale, min_value);
+        }
+    }
+
+    // Converts (or copies) the accessor data into destination. Each element of the accessor (of byte size
+    // element_byte_size) is converted separately if the elements are not tightly packed.
+    template <typename Component, typename SourceComponent>
+    void convert_accessor_data(const AccessorDataView &data_view, std::span<Component> destination,
+                               const size_t component_count, const bool normalized)
+    {
+        const auto convert = [&](const std::byte *source, Component *output, const size_t count) {
+            if constexpr (std::is_same_v<Component, SourceComponent>)
+            {
+                std::memcpy(output, source, count * sizeof(Component));
+            }
+            else if constexpr (std::is_same_v<Component, float> && sizeof(SourceComponent) <= 2u)
+            {
+                convert_components_to_float(reinterpret_cast<const SourceComponent *>(source), output, count,
+                                            normalized);
+            }
+            else
+            {
+                for (const auto i : std::views::iota(size_t{0u}, count))
+                {
+                    auto value = SourceComponent{};
+                    std::memcpy(&value, source + i * sizeof(SourceComponent), sizeof(SourceComponent));
+                    output[i] = static_cast<Component>(value);
+                }
+            }
+        };
+
+        if (data_view.byte_stride == data_view.element_byte_size)
+        {
+            convert(data_view.data, destination.data(), destination.size());
+            return;
+        }
+
+        const auto element_count = destination.size() / component_count;
+        for (const auto i : std::views::iota(size_t{0u}, element_count))
+        {
+            convert(data_view.data + i * data_view.byte_stride, destination.data() + i * component_count,
+                    component_count);
+        }
+    }
+
+    // Fast path for get_data_from_accessor : copies the accessor data in bulk (or converts it, for normalized /
+    // quantized attributes) instead of going through fastgltf's per element iteration. Returns false if the fast path
+    // cannot be used for the accessor.
+    template <typename T>
+    bool copy_accessor_data(const fastgltf::Asset &asset, const BufferDataViews &buffers,
+                            const fastgltf::Accessor &accessor, std::span<T> destination)
+    {
+        using Component = typename fastgltf::ElementTraits<T>::component_type;
+        constexpr auto component_count = sizeof(T) / sizeof(Component);
+
+        static_assert(sizeof(T) == component_count * sizeof(Component));
+
+        if (accessor.type != fastgltf::ElementTraits<T>::type)
+        {
+            return false;
+        }
+
+        const auto data_view = get_accessor_data_view(asset, buffers, accessor);
+        if (!data_view.has_value())
+        {
+            return false;
+        }
+
+        const auto components = std::span<Component>(reinterpret_cast<Component *>(destination.data()),
+                                                     destination.size() * component_count);
+
+        switch (accessor.componentType)
+        {
+        case fastgltf::ComponentType::Byte: {
+            convert_accessor_data<Component, int8_t>(data_view.value(), components, component_count,
+                                                     accessor.normalized);
+        }
+        break;
+
+        case fastgltf::ComponentType::UnsignedByte: {
+            convert_accessor_data<Component, uint8_t>(data_view.value(), components, component_count,
+                                                      accessor.normalized);
+        }
+        break;
+
+        case fastgltf::ComponentType::Short: {
+            convert_accessor_data<Component, int16_t>(data_view.value(), components, component_count,
+                                                      accessor.normalized);
+        }
+        break;
+
+        case fastgltf::ComponentType::UnsignedShort: {
+            convert_accessor_data<Component, uint16_t>(data_view.value(), components, component_count,
+                                                       accessor.normalized);
+        }
+        break;
+
+        case fastgltf::ComponentType::UnsignedInt: {
+            // Copied as is for (32 bit) indices, converted element by element otherwise.
+            convert_accessor_data<Component, uint32_t>(data_view.value(), components, component_count, false);
+        }
+        break;
+
+        case fastgltf::ComponentType::Float: {
+            if constexpr (std::is_same_v<Component, float>)
+            {
+                convert_accessor_data<Component, float>(data_view.value(), components, component_count, false);
+            }
+            else
+            {
+                return false;
+            }
+        }
+        break;
+
+        default: {
+            // Component types that are not allowed for the vertex attributes / indices the loader uses go through the
+            // slow path.
+            return false;
+        }
+        break;
+        }
+
+        return true;
+    }
+
+    // Returns true if the accessor data can only be read with fastgltf's per element iteration (see
+    // copy_accessor_data).
+    bool requires_accessor_iteration(const fastgltf::Accessor &accessor)
+    {
+        switch (accessor.componentType)
+        {
+        case fastgltf::ComponentType::Byte:
+        case fastgltf::ComponentType::UnsignedByte:
+        case fastgltf::ComponentType::Short:
+        case fastgltf::ComponentType::UnsignedShort:
+        case fastgltf::ComponentType::UnsignedInt:
+        case fastgltf::ComponentType::Float: {
+            return accessor.sparse.has_value();
+        }
+        break;
+
+        default: {
+            return true;
+        }
+        break;
+        }
+    }
+
     // Helper function to get data given the asset and accessor.
     template <typename T>
-    std::vector<T> get_data_from_accessor(const fastgltf::Asset &asset, const fastgltf::Accessor &accessor)
+    std::vector<T> get_data_from_accessor(const fastgltf::Asset &asset, const BufferDataViews &buffers,
+                                          const fastgltf::Accessor &accessor)
     {
         auto attribute_data = std::vector<T>(accessor.count);
 
+        if (copy_accessor_data(asset, buffers, accessor, std::span(attribute_data)))
+        {
+            return attribute_data;
+        }
+
         fastgltf::iterateAccessorWithIndex<T>(asset, accessor,
                                               [&](T attribute, size_t index) { attribute_data[index] = attribute; });
 
         return attribute_data;
     }
 
+    // KHR_mesh_quantization allows vertex attributes to be stored as (normalized) 8 / 16 bit integers. Integer
+    // components map exactly onto 16 bit unsigned integers (8 bit values are scaled by 257), so positions and texture
+    // coords are kept in their source precision and only the dequantization offset / scale have to be computed.
+    template <typename Component>
+    struct Unorm16Mapping
+    {
+        static_assert(std::is_integral_v<Component> && sizeof(Component) <= 2u);
+
+        static constexpr auto MIN_VALUE = static_cast<int32_t>(std::numeric_limits<Component>::min());
+        static constexpr auto MULTIPLIER =
+            65535 / (static_cast<int32_t>(std::numeric_limits<Component>::max()) - MIN_VALUE);
+
+        static uint16_t map(const Component value)
+        {
+            return static_cast<uint16_t>((static_cast<int32_t>(value) - MIN_VALUE) * MULTIPLIER);
+        }
+
+        // value = offset + mapped value * scale.
+        static std::pair<float, float> get_dequantization(const bool normalized)
+        {
+            const auto component_scale =
+                normalized ? 1.0f / static_cast<float>(std::numeric_limits<Component>::max()) : 1.0f;
+
+            return {MIN_VALUE * component_scale, component_scale / MULTIPLIER};
+        }
+    };
+
+    template <typename Component>
+    std::array<Component, 3u> read_components(const AccessorDataView &data_view, const size_t index)
+    {
+        auto components = std::array<Component, 3u>{};
+        std::memcpy(components.data(), data_view.data + index * data_view.byte_stride,
+                    std::min(sizeof(components), data_view.element_byte_size));
+
+        return components;
+    }
+
+    template <typename Component>
+    void get_quantized_positions(const AccessorDataView &data_view, const size_t count, const bool normalized,
+                                 QuantizedVertexData &quantized_vertex_data)
+    {
+        const auto [offset, scale] = Unorm16Mapping<Component>::get_dequantization(normalized);
+
+        quantized_vertex_data.position_dequantization_offset = math::XMFLOAT3{offset, offset, offset};
+        quantized_vertex_data.position_dequantization_scale = math::XMFLOAT3{scale, scale, scale};
+
+        quantized_vertex_data.positions.resize(count);
+        for (const auto i : std::views::iota(size_t{0u}, count))
+        {
+            const auto components = read_components<Component>(data_view, i);
+
+            quantized_vertex_data.positions[i] = QuantizedPosition{
+                .x = Unorm16Mapping<Component>::map(components[0]),
+                .y = Unorm16Mapping<Component>::map(components[1]),
+                .z = Unorm16Mapping<Component>::map(components[2]),
+            };
+        }
+    }
+
+    template <typename Component>
+    void get_quantized_texture_coords(const AccessorDataView &data_view, const size_t count, const bool normalized,
+                                      QuantizedVertexData &quantized_vertex_data)
+    {
+        const auto [offset, scale] = Unorm16Mapping<Component>::get_dequantization(normalized);
+
+        quantized_vertex_data.texture_coord_encoding = TextureCoordEncoding::Unorm16;
+        quantized_vertex_data.texture_coord_dequantization_offset = math::XMFLOAT2{offset, offset};
+        quantized_vertex_data.texture_coord_dequantization_scale = math::XMFLOAT2{scale, scale};
+
+        quantized_vertex_data.texture_coords.resize(count);
+        for (const auto i : std::views::iota(size_t{0u}, count))
+        {
+            const auto components = read_components<Component>(data_view, i);
+
+            const auto u = static_cast<uint32_t>(Unorm16Mapping<Component>::map(components[0]));
+            const auto v = static_cast<uint32_t>(Unorm16Mapping<Component>::map(components[1]));
+
+            quantized_vertex_data.texture_coords[i] = u | (v << 16u);
+        }
+    }
+
+    // Normalized 8 / 16 bit normals are copied as is (see NormalEncoding).
+    template <typename Component>
+    void get_quantized_normals(const AccessorDataView &data_view, const size_t count,
+                               QuantizedVertexData &quantized_vertex_data)
+    {
+        using UnsignedComponent = std::make_unsigned_t<Component>;
+        constexpr auto component_bit_size = sizeof(Component) * 8u;
+
+        const auto to_bits = [](const Component value) {
+            return static_cast<uint32_t>(static_cast<UnsignedComponent>(value));
+        };
+
+        quantized_vertex_data.normal_encoding =
+            sizeof(Component) == 1u ? NormalEncoding::Snorm8 : NormalEncoding::Snorm16;
+
+        const auto stride = VertexQuantization::get_normal_stride(quantized_vertex_data.normal_encoding);
+        quantized_vertex_data.normals.resize(count * stride);
+
+        for (const auto i : std::views::iota(size_t{0u}, count))
+        {
+            const auto components = read_components<Component>(data_view, i);
+
+            if constexpr (sizeof(Component) == 1u)
+            {
+                quantized_vertex_data.normals[i] = to_bits(components[0]) | (to_bits(components[1]) << 8u) |
+                                                   (to_bits(components[2]) << 16u);
+            }
+            else
+            {
+                quantized_vertex_data.normals[i * 2u] =
+                    to_bits(components[0]) | (to_bits(components[1]) << component_bit_size);
+                quantized_vertex_data.normals[i * 2u + 1u] = to_bits(components[2]);
+            }
+        }
+    }
+
+    // Invokes function with a value of the component type, if the accessor uses 8 / 16 bit integer components.
+    template <typename Function>
+    void visit_integer_component_type(const fastgltf::ComponentType component_type, Function &&function)
+    {
+        switch (component_type)
+        {
+        case fastgltf::ComponentType::Byte: {
+            function(int8_t{});
+        }
+        break;
+
+        case fastgltf::ComponentType::UnsignedByte: {
+            function(uint8_t{});
+        }
+        break;
+
+        case fastgltf::ComponentType::Short: {
+            function(int16_t{});
+        }
+        break;
+
+        case fastgltf::ComponentType::UnsignedShort: {
+            function(uint16_t{});
+        }
+        break;
+
+        default: {
+        }
+        break;
+        }
+    }
+
+    // Reads the vertex attributes that use integer components into the quantized vertex streams. The streams of
+    // attributes that use float components are left empty (they are quantized from the float streams after the mesh
+    // has been optimized).
+    void get_quantized_vertex_data_from_accessors(const fastgltf::Asset &asset, const BufferDataViews &buffers,
+                                                  const fastgltf::Accessor &position_accessor,
+                                                  const fastgltf::Accessor &normal_accessor,
+                                                  const fastgltf::Accessor &texture_coord_accessor,
+                                                  QuantizedVertexData &quantized_vertex_data)
+    {
+        if (const auto data_view = get_accessor_data_view(asset, buffers, position_accessor);
+            data_view.has_value() && position_accessor.type == fastgltf::AccessorType::Vec3)
+        {
+            visit_integer_component_type(position_accessor.componentType, [&]<typename Component>(Component) {
+                get_quantized_positions<Component>(data_view.value(), position_accessor.count,
+                                                   position_accessor.normalized, quantized_vertex_data);
+            });
+        }
+
+        // Only normalized signed components are valid for normals.
+        if (const auto data_view = get_accessor_data_view(asset, buffers, normal_accessor);
+            data_view.has_value() && normal_accessor.type == fastgltf::AccessorType::Vec3 &&
+            normal_accessor.normalized)
+        {
+            visit_integer_component_type(normal_accessor.componentType, [&]<typename Component>(Component) {
+                if constexpr (std::is_signed_v<Component>)
+                {
+                    get_quantized_normals<Component>(data_view.value(), normal_accessor.count, quantized_vertex_data);
+                }
+            });
+        }
+
+        if (const auto data_view = get_accessor_data_view(asset, buffers, texture_coord_accessor);
+            data_view.has_value() && texture_coord_accessor.type == fastgltf::AccessorType::Vec2)
+        {
+            visit_integer_component_type(texture_coord_accessor.componentType, [&]<typename Component>(Component) {
+                get_quantized_texture_coords<Component>(data_view.value(), texture_coord_accessor.count,
+                                                        texture_coord_accessor.normalized, quantized_vertex_data);
+            });
+        }
+    }
+
     // Helper function to get transform matrix from node.
     // Reference :
     // https://github.com/spnda/fastgltf/blob/ee5dd8948f2b8191cda01556c7daab5d2799840f/examples/gl_viewer/gl_viewer.cpp#L261
@@ -70,19 +531,25 @@ namespace serenity::asset::ModelLoader
         return transform;
     }
 
-    // Function to get mesh data.
-    std::vector<MeshData> get_mesh_data_from_node(const fastgltf::Asset &asset, const fastgltf::Node &node,
-                                                  const math::XMMATRIX base_transform)
+    // A primitive along with the world transform of the node it belongs to. Primitives are gathered by walking the
+    // node hierarchy, and the actual extraction of their attributes is done in parallel.
+    struct PrimitiveTask
     {
-        auto result_mesh_data = std::vector<MeshData>{};
+        const fastgltf::Primitive *primitive{};
+        math::XMMATRIX transform{};
+    };
 
+    // Recursively collect the primitives of a node and its children. The order (child nodes first, then the primitives
+    // of the node's own mesh) determines the order of the meshes in the loaded model.
+    void get_primitive_tasks_from_node(const fastgltf::Asset &asset, const fastgltf::Node &node,
+                                       const math::XMMATRIX base_transform, std::vector<PrimitiveTask> &primitive_tasks)
+    {
         const auto node_transform = get_transform_matrix_from_node(node) * base_transform;
 
         // Load all child nodes.
         for (const auto &child_node : node.children)
         {
-            const auto child_mesh_data = get_mesh_data_from_node(asset, asset.nodes.at(child_node), node_transform);
-            result_mesh_data.insert(result_mesh_data.end(), child_mesh_data.begin(), child_mesh_data.end());
+            get_primitive_tasks_from_node(asset, asset.nodes.at(child_node), node_transform, primitive_tasks);
         }
 
         // Get GLTF mesh data.
@@ -90,130 +557,756 @@ namespace serenity::asset::ModelLoader
         {
             const auto &mesh = asset.meshes.at(node.meshIndex.value());
 
-            for (auto &primitive : mesh.primitives)
+            for (const auto &primitive : mesh.primitives)
             {
-                auto mesh_data = MeshData{};
-                // Load attributes.
+                primitive_tasks.emplace_back(PrimitiveTask{
+                    .primitive = &primitive,
+                    .transform = node_transform,
+                });
+            }
+        }
+    }
+
+    // Loads 4 consecutive positions, transposed so that each vector has one coordinate of all 4 positions.
+    std::array<math::XMVECTOR, 3u> load_transposed_positions(const math::XMFLOAT3 *positions)
+    {
+        const auto data = reinterpret_cast<const math::XMFLOAT4 *>(positions);
+
+        // a = (x0, y0, z0, x1), b = (y1, z1, x2, y2), c = (z2, x3, y3, z3).
+        const auto a = math::XMLoadFloat4(data);
+        const auto b = math::XMLoadFloat4(data + 1u);
+        const auto c = math::XMLoadFloat4(data + 2u);
+
+        return {
+            math::XMVectorPermute<0, 1, 2, 5>(math::XMVectorPermute<0, 3, 6, 0>(a, b), c),
+            math::XMVectorPermute<0, 1, 2, 6>(math::XMVectorPermute<1, 4, 7, 0>(a, b), c),
+            math::XMVectorPermute<0, 1, 4, 7>(math::XMVectorPermute<2, 5, 0, 0>(a, b), c),
+        };
+    }
 
-                // Load positions.
-                const auto &position_accessor = asset.accessors[primitive.findAttribute("POSITION")->second];
-                mesh_data.positions = get_data_from_accessor<math::XMFLOAT3>(asset, position_accessor);
+    // Reduce the 4 lanes of the vector into a single value (replicated into all lanes).
+    template <typename Reduction> math::XMVECTOR reduce_lanes(const math::XMVECTOR value, const Reduction reduction)
+    {
+        const auto partial = reduction(value, math::XMVectorSwizzle<1, 0, 3, 2>(value));
+        return reduction(partial, math::XMVectorSwizzle<2, 3, 0, 1>(partial));
+    }
 
-                mesh_data.mesh_local_transform_matrix = node_transform;
-                mesh_data.inverse_mesh_local_transform_matrix = math::XMMatrixInverse(nullptr, node_transform);
+    // Axis aligned bounding box (in mesh local space).
+    struct BoundingBox
+    {
+        math::XMFLOAT3 min{};
+        math::XMFLOAT3 max{};
+    };
 
-                // Load normals.
-                const auto &normal_accessor = asset.accessors[primitive.findAttribute("NORMAL")->second];
-                mesh_data.normals = get_data_from_accessor<math::XMFLOAT3>(asset, normal_accessor);
+    // Min / max reduction over all positions, 4 positions (transposed) at a time.
+    BoundingBox get_bounding_box(const std::span<const math::XMFLOAT3> positions)
+    {
+        if (positions.empty())
+        {
+            return BoundingBox{};
+        }
 
-                // Load texture coords.
-                const auto &texture_coord_accessor = asset.accessors[primitive.findAttribute("TEXCOORD_0")->second];
-                mesh_data.texture_coords = get_data_from_accessor<math::XMFLOAT2>(asset, texture_coord_accessor);
+        auto min_position = math::XMLoadFloat3(&positions[0]);
+        auto max_position = min_position;
 
-                // Load index buffer.
-                const auto &index_accessor = asset.accessors[primitive.indicesAccessor.value()];
-                mesh_data.indices = get_data_from_accessor<uint16_t>(asset, index_accessor);
+        auto i = size_t{0u};
+        if (positions.size() >= 4u)
+        {
+            auto [min_x, min_y, min_z] = load_transposed_positions(positions.data());
+            auto [max_x, max_y, max_z] = std::array{min_x, min_y, min_z};
 
-                if (primitive.materialIndex.has_value())
-                {
-                    mesh_data.material_index = primitive.materialIndex.value();
-                }
-                else
-                {
-                    mesh_data.material_index = 0;
-                }
+            for (i = 4u; i + 4u <= positions.size(); i += 4u)
+            {
+                const auto [x, y, z] = load_transposed_positions(positions.data() + i);
 
-                result_mesh_data.emplace_back(std::move(mesh_data));
+                min_x = math::XMVectorMin(min_x, x);
+                min_y = math::XMVectorMin(min_y, y);
+                min_z = math::XMVectorMin(min_z, z);
+                max_x = math::XMVectorMax(max_x, x);
+                max_y = math::XMVectorMax(max_y, y);
+                max_z = math::XMVectorMax(max_z, z);
             }
+
+            const auto merge = [](const math::XMVECTOR x, const math::XMVECTOR y, const math::XMVECTOR z,
+                                  const auto reduction) {
+                return math::XMVectorSet(math::XMVectorGetX(reduce_lanes(x, reduction)),
+                                         math::XMVectorGetX(reduce_lanes(y, reduction)),
+                                         math::XMVectorGetX(reduce_lanes(z, reduction)), 0.0f);
+            };
+
+            min_position = merge(min_x, min_y, min_z, math::XMVectorMin);
+            max_position = merge(max_x, max_y, max_z, math::XMVectorMax);
+        }
+
+        for (; i < positions.size(); ++i)
+        {
+            min_position = math::XMVectorMin(min_position, math::XMLoadFloat3(&positions[i]));
+            max_position = math::XMVectorMax(max_position, math::XMLoadFloat3(&positions[i]));
         }
 
-        return result_mesh_data;
+        auto bounding_box = BoundingBox{};
+        math::XMStoreFloat3(&bounding_box.min, min_position);
+        math::XMStoreFloat3(&bounding_box.max, max_position);
+
+        return bounding_box;
     }
 
-    // Main reference : https://github.com/spnda/fastgltf/blob/main/examples/gl_viewer/gl_viewer.cpp.
-    std::vector<MaterialData> get_material_data_from_asset(const fastgltf::Asset &asset, const std::string path)
+    // The gltf spec requires position accessors to have min / max, in which case the positions do not have to be
+    // scanned for the bounding box. Only used for float positions, as the bounds of quantized positions are not
+    // normalized. Returns std::nullopt if the bounds are missing or invalid.
+    std::optional<BoundingBox> get_bounding_box_from_accessor(const fastgltf::Accessor &accessor)
     {
-        auto result_material_data = std::vector<MaterialData>{};
+        if (accessor.componentType != fastgltf::ComponentType::Float || accessor.type != fastgltf::AccessorType::Vec3)
+        {
+            return std::nullopt;
+        }
 
-        for (const auto &material : asset.materials)
+        const auto get_bounds = [](const auto &bounds) {
+            return std::visit(
+                [](const auto &values) -> std::optional<math::XMFLOAT3> {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(values)>, std::monostate>)
+                    {
+                        return std::nullopt;
+                    }
+                    else
+                    {
+                        if (values.size() != 3u)
+                        {
+                            return std::nullopt;
+                        }
+
+                        return math::XMFLOAT3{static_cast<float>(values[0]), static_cast<float>(values[1]),
+                                              static_cast<float>(values[2])};
+                    }
+                },
+                bounds);
+        };
+
+        const auto min = get_bounds(accessor.min);
+        const auto max = get_bounds(accessor.max);
+
+        // Also rejects NaN's and infinities.
+        const auto is_valid = [](const float min_value, const float max_value) {
+            return std::isfinite(min_value) && std::isfinite(max_value) && min_value <= max_value;
+        };
+
+        if (!min.has_value() || !max.has_value() || !is_valid(min->x, max->x) || !is_valid(min->y, max->y) ||
+            !is_valid(min->z, max->z))
         {
-            auto material_data = MaterialData{};
+            return std::nullopt;
+        }
 
-            material_data.base_color = math::XMFLOAT4{
-                material.pbrData.baseColorFactor[0],
-                material.pbrData.baseColorFactor[1],
-                material.pbrData.baseColorFactor[2],
-                material.pbrData.baseColorFactor[3],
-            };
+        return BoundingBox{
+            .min = min.value(),
+            .max = max.value(),
+        };
+    }
 
-            material_data.metallic_roughness_factor = math::XMFLOAT2{
-                material.pbrData.metallicFactor,
-                material.pbrData.roughnessFactor,
-            };
+    // Bounding sphere (center of the bounding box, and distance to the farthest vertex as radius).
+    math::XMFLOAT4 get_bounding_sphere(const std::span<const math::XMFLOAT3> positions, const BoundingBox &bounding_box)
+    {
+        if (positions.empty())
+        {
+            return math::XMFLOAT4{};
+        }
 
-            if (material.pbrData.baseColorTexture.has_value())
-            {
-                const auto &base_color_texture_info = material.pbrData.baseColorTexture.value();
-                auto &base_color_texture = asset.textures.at(base_color_texture_info.textureIndex);
+        const auto center =
+            (math::XMLoadFloat3(&bounding_box.min) + math::XMLoadFloat3(&bounding_box.max)) * 0.5f;
 
-                const auto base_image_index = base_color_texture.imageIndex.has_value()
-                                                  ? base_color_texture.imageIndex.value()
-                                                  : base_color_texture.fallbackImageIndex.value();
+        // Max reduction of the squared distances, 4 positions (transposed) at a time.
+        auto max_distance_squared = math::XMVectorZero();
 
-                const auto &base_color_image = asset.images.at(base_image_index);
+        auto i = size_t{0u};
+        for (; i + 4u <= positions.size(); i += 4u)
+        {
+            const auto [x, y, z] = load_transposed_positions(positions.data() + i);
 
-                if (const auto &texture_path = std::get_if<fastgltf::sources::URI>(&base_color_image.data))
-                {
-                    material_data.base_color_texture =
-                        TextureLoader::load_texture(path + "/"s + texture_path->uri.path().data(), 4u);
-                }
-                else if (const auto &texture_data = std::get_if<fastgltf::sources::Vector>(&base_color_image.data))
-                {
-                    material_data.base_color_texture = TextureLoader::load_texture(
-                        reinterpret_cast<const std::byte *>(texture_data->bytes.data()), texture_data->bytes.size());
-                }
-            }
+            const auto offset_x = x - math::XMVectorSplatX(center);
+            const auto offset_y = y - math::XMVectorSplatY(center);
+            const auto offset_z = z - math::XMVectorSplatZ(center);
+
+            const auto distance_squared = math::XMVectorMultiplyAdd(
+                offset_z, offset_z, math::XMVectorMultiplyAdd(offset_y, offset_y, offset_x * offset_x));
+
+            max_distance_squared = math::XMVectorMax(max_distance_squared, distance_squared);
+        }
+
+        max_distance_squared = reduce_lanes(max_distance_squared, math::XMVectorMax);
 
-            result_material_data.emplace_back(material_data);
+        for (; i < positions.size(); ++i)
+        {
+            max_distance_squared = math::XMVectorMax(
+                max_distance_squared, math::XMVector3LengthSq(math::XMLoadFloat3(&positions[i]) - center));
         }
 
-        return result_material_data;
+        return math::XMFLOAT4{math::XMVectorGetX(center), math::XMVectorGetY(center), math::XMVectorGetZ(center),
+                              std::sqrt(math::XMVectorGetX(max_distance_squared))};
     }
 
-    ModelData load_model(const std::string_view model_path)
+    // Function to get mesh data of a single primitive.
+    MeshData get_mesh_data_from_primitive(const fastgltf::Asset &asset, const BufferDataViews &buffers,
+                                          const fastgltf::Primitive &primitive, const math::XMMATRIX transform,
+                                          const ModelImportConfig &import_config)
     {
-        auto model = ModelData{};
+        auto mesh_data = MeshData{};
+        // Load attributes.
 
-        auto data = fastgltf::GltfDataBuffer();
-        const auto path = std::filesystem::path(core::FileSystem::instance().get_absolute_path(model_path));
+        // Load positions.
+        const auto &position_accessor = asset.accessors[primitive.findAttribute("POSITION")->second];
+        mesh_data.positions = get_data_from_accessor<math::XMFLOAT3>(asset, buffers, position_accessor);
 
-        if (!data.loadFromFile(path))
+        // Bounding volumes (in mesh local space). The bounding box is read from the accessor if possible. The bounds
+        // stay valid (if not tight) when optimize_vertex_fetch drops unused vertices.
+        auto bounding_box = get_bounding_box_from_accessor(position_accessor);
+        if (!bounding_box.has_value())
         {
-            core::Log::instance().critical(std::format("Failed to load GLTF data from model with path : ", model_path));
+            bounding_box = get_bounding_box(mesh_data.positions);
         }
 
-        // These options tell fastgltf that we want it to load all external buffers, images, and GLB buffers into CPU
-        // memory.
-        constexpr auto options = fastgltf::Options::LoadExternalBuffers | fastgltf::Options::LoadGLBBuffers |
-                                 fastgltf::Options::LoadExternalImages;
+        mesh_data.bounding_box_min = bounding_box->min;
+        mesh_data.bounding_box_max = bounding_box->max;
+        mesh_data.bounding_sphere = get_bounding_sphere(mesh_data.positions, bounding_box.value());
 
-        // Create a parser and parse the GLTF.
-        auto parser = fastgltf::Parser();
-        auto gltf = fastgltf::Expected<fastgltf::Asset>(fastgltf::Asset{});
+        mesh_data.mesh_local_transform_matrix = transform;
+        mesh_data.inverse_mesh_local_transform_matrix = math::XMMatrixInverse(nullptr, transform);
 
-        if (path.extension() == ".gltf")
+        // Load normals.
+        const auto &normal_accessor = asset.accessors[primitive.findAttribute("NORMAL")->second];
+        mesh_data.normals = get_data_from_accessor<math::XMFLOAT3>(asset, buffers, normal_accessor);
+
+        // Load texture coords.
+        const auto &texture_coord_accessor = asset.accessors[primitive.findAttribute("TEXCOORD_0")->second];
+        mesh_data.texture_coords = get_data_from_accessor<math::XMFLOAT2>(asset, buffers, texture_coord_accessor);
+
+        // Vertex attributes that are already quantized in the gltf file are read into the quantized vertex streams.
+        if (import_config.quantize_vertices)
         {
-            gltf = parser.loadGLTF(&data, path.parent_path(), options);
+            get_quantized_vertex_data_from_accessors(asset, buffers, position_accessor, normal_accessor,
+                                                     texture_coord_accessor, mesh_data.quantized_vertex_data);
         }
-        else if (path.extension() == ".glb")
+
+        // Load index buffer.
+        const auto &index_accessor = asset.accessors[primitive.indicesAccessor.value()];
+        mesh_data.indices = get_data_from_accessor<uint32_t>(asset, buffers, index_accessor);
+
+        if (primitive.materialIndex.has_value())
         {
-            gltf = parser.loadBinaryGLTF(&data, path.parent_path(), options);
+            mesh_data.material_index = primitive.materialIndex.value();
         }
         else
         {
-            core::Log::instance().critical(
-                std::format("GLTF file extension {} is unsupported. The supported types are : GLTF and GLB",
-                            path.extension().string()));
+            mesh_data.material_index = 0;
+        }
+
+        return mesh_data;
+    }
+
+    static constexpr size_t NO_IMAGE = std::numeric_limits<size_t>::max();
+
+    // Identifies a material texture by the images it is loaded from, so that textures that are shared by materials are
+    // only loaded once. For the packed occlusion / roughness / metallic texture, image_index is the occlusion image and
+    // second_image_index the metallic roughness image (either can be NO_IMAGE). Textures that are packed into texture
+    // atlases are loaded uncompressed, so they are keyed separately.
+    struct MaterialTextureKey
+    {
+        MaterialTextureType texture_type{};
+        size_t image_index{NO_IMAGE};
+        size_t second_image_index{NO_IMAGE};
+        bool atlased{};
+
+        auto operator<=>(const MaterialTextureKey &other) const = default;
+    };
+
+    using MaterialTextureKeys = std::array<std::optional<MaterialTextureKey>, MATERIAL_TEXTURE_TYPE_COUNT>;
+
+    // Contents of an image file. External images are mapped (and file keeps them alive), embedded images are
+    // referenced directly.
+    struct ImageData
+    {
+        core::FileView file{};
+        std::span<const std::byte> data{};
+    };
+
+    size_t get_image_index(const fastgltf::Asset &asset, const std::optional<fastgltf::TextureInfo> &texture_info)
+    {
+        if (!texture_info.has_value())
+        {
+            return NO_IMAGE;
+        }
+
+        const auto &texture = asset.textures.at(texture_info->textureIndex);
+        return texture.imageIndex.has_value() ? texture.imageIndex.value() : texture.fallbackImageIndex.value();
+    }
+
+    ImageData get_image_data(const fastgltf::Asset &asset, const BufferDataViews &buffers, const size_t image_index,
+                             const std::string &path)
+    {
+        const auto &image = asset.images.at(image_index);
+
+        auto image_data = ImageData{};
+
+        if (const auto &texture_path = std::get_if<fastgltf::sources::URI>(&image.data))
+        {
+            const auto image_path = path + "/"s + texture_path->uri.path().data();
+
+            image_data.file = core::FileSystem::instance().map_file(image_path);
+            if (!image_data.file.is_valid())
+            {
+                core::Log::instance().critical(std::format("Failed to load texture from path : {}", image_path));
+            }
+
+            image_data.data = image_data.file.get_span();
+        }
+        else if (const auto &texture_data = std::get_if<fastgltf::sources::Vector>(&image.data))
+        {
+            image_data.data = std::as_bytes(std::span{texture_data->bytes});
+        }
+        else if (const auto &buffer_view_source = std::get_if<fastgltf::sources::BufferView>(&image.data))
+        {
+            // Images embedded in a buffer (usually the glb binary chunk) are decoded directly from the buffer.
+            const auto &buffer_view = asset.bufferViews.at(buffer_view_source->bufferViewIndex);
+            const auto &buffer_data = buffers.at(buffer_view.bufferIndex);
+
+            if (buffer_view.byteOffset > buffer_data.size() ||
+                buffer_view.byteLength > buffer_data.size() - buffer_view.byteOffset)
+            {
+                core::Log::instance().critical(std::format("Buffer view of image {} is out of bounds", image_index));
+            }
+
+            image_data.data = buffer_data.subspan(buffer_view.byteOffset, buffer_view.byteLength);
+        }
+
+        return image_data;
+    }
+
+    // Returns the keys of the textures of the material (indexed by MaterialTextureType).
+    MaterialTextureKeys get_material_texture_keys(const fastgltf::Asset &asset, const fastgltf::Material &material)
+    {
+        auto texture_keys = MaterialTextureKeys{};
+
+        const auto add_texture_key = [&](const MaterialTextureType texture_type, const size_t image_index,
+                                         const size_t second_image_index) {
+            if (image_index != NO_IMAGE || second_image_index != NO_IMAGE)
+            {
+                texture_keys[static_cast<uint32_t>(texture_type)] = MaterialTextureKey{
+                    .texture_type = texture_type,
+                    .image_index = image_index,
+                    .second_image_index = second_image_index,
+                };
+            }
+        };
+
+        add_texture_key(MaterialTextureType::BaseColor, get_image_index(asset, material.pbrData.baseColorTexture),
+                        NO_IMAGE);
+        add_texture_key(MaterialTextureType::Normal, get_image_index(asset, material.normalTexture), NO_IMAGE);
+        add_texture_key(MaterialTextureType::OcclusionRoughnessMetallic,
+                        get_image_index(asset, material.occlusionTexture),
+                        get_image_index(asset, material.pbrData.metallicRoughnessTexture));
+        add_texture_key(MaterialTextureType::Emissive, get_image_index(asset, material.emissiveTexture), NO_IMAGE);
+
+        return texture_keys;
+    }
+
+    // Returns the dimension of the material's rect in a texture atlas, if all textures of the material have the same
+    // dimension that is no larger than max_atlas_texture_dimension. The images are not decoded.
+    std::optional<Uint2> get_material_atlas_dimension(const fastgltf::Asset &asset, const BufferDataViews &buffers,
+                                                      const MaterialTextureKeys &texture_keys,
+                                                      const std::string &path, const ModelImportConfig &import_config)
+    {
+        auto atlas_dimension = std::optional<Uint2>{};
+
+        for (const auto &texture_key : texture_keys)
+        {
+            if (!texture_key.has_value())
+            {
+                continue;
+            }
+
+            // The packed texture has the dimension of its largest image.
+            auto dimension = Uint2{};
+            for (const auto image_index : {texture_key->image_index, texture_key->second_image_index})
+            {
+                if (image_index != NO_IMAGE)
+                {
+                    const auto image_data = get_image_data(asset, buffers, image_index, path);
+                    const auto image_dimension = TextureLoader::get_texture_dimension(
+                        image_data.data.data(), static_cast<uint32_t>(image_data.data.size()));
+
+                    dimension.x = std::max(dimension.x, image_dimension.x);
+                    dimension.y = std::max(dimension.y, image_dimension.y);
+                }
+            }
+
+            if (dimension.x == 0u || dimension.y == 0u || dimension.x > import_config.max_atlas_texture_dimension ||
+                dimension.y > import_config.max_atlas_texture_dimension ||
+                (atlas_dimension.has_value() &&
+                 (atlas_dimension->x != dimension.x || atlas_dimension->y != dimension.y)))
+            {
+                return std::nullopt;
+            }
+
+            atlas_dimension = dimension;
+        }
+
+        return atlas_dimension;
+    }
+
+    TextureCompression get_texture_compression(const MaterialTextureType texture_type,
+                                               const ModelImportConfig &import_config)
+    {
+        return texture_type == MaterialTextureType::Normal ? import_config.normal_texture_compression
+                                                           : import_config.texture_compression;
+    }
+
+    // Textures that are packed into texture atlases are loaded uncompressed (and only their base level is used).
+    TextureData load_material_texture(const fastgltf::Asset &asset, const BufferDataViews &buffers,
+                                      const MaterialTextureKey &texture_key, const std::string &path,
+                                      const ModelImportConfig &import_config)
+    {
+        const auto compression = texture_key.atlased
+                                     ? TextureCompression::None
+                                     : get_texture_compression(texture_key.texture_type, import_config);
+
+        // Exporters commonly store occlusion in the R channel of the metallic roughness texture, in which case the
+        // image is used as is. Otherwise, the occlusion (R) and metallic roughness (G / B) images are packed, with
+        // missing inputs being 1 (no occlusion and the factors used as is).
+        if (texture_key.texture_type == MaterialTextureType::OcclusionRoughnessMetallic &&
+            texture_key.image_index != texture_key.second_image_index)
+        {
+            const auto occlusion_image = texture_key.image_index != NO_IMAGE
+                                             ? get_image_data(asset, buffers, texture_key.image_index, path)
+                                             : ImageData{};
+
+            const auto metallic_roughness_image =
+                texture_key.second_image_index != NO_IMAGE
+                    ? get_image_data(asset, buffers, texture_key.second_image_index, path)
+                    : ImageData{};
+
+            const auto channel_sources = std::array{
+                TextureChannelSource{.data = occlusion_image.data, .source_channel = 0u},
+                TextureChannelSource{.data = metallic_roughness_image.data, .source_channel = 1u},
+                TextureChannelSource{.data = metallic_roughness_image.data, .source_channel = 2u},
+                TextureChannelSource{},
+            };
+
+            return TextureLoader::load_packed_texture(channel_sources, compression);
+        }
+
+        const auto image_data = get_image_data(asset, buffers, texture_key.image_index, path);
+        const auto is_srgb = is_material_texture_srgb(texture_key.texture_type);
+
+        if (texture_key.atlased)
+        {
+            return TextureLoader::load_texture(image_data.data.data(), static_cast<uint32_t>(image_data.data.size()),
+                                               4u, false, is_srgb);
+        }
+
+        return TextureLoader::load_compressed_texture(
+            image_data.data.data(), static_cast<uint32_t>(image_data.data.size()), compression, is_srgb);
+    }
+
+    // Pack the (atlased) textures of the given materials into texture atlases, with one atlas texture per page and
+    // texture type. The atlas textures are added to the model. texture_key_indices has the indices (into textures) of
+    // the textures of each material.
+    void create_texture_atlases(ModelData &model, const std::span<const uint32_t> atlased_materials,
+                                const std::span<const Uint2> dimensions,
+                                const std::span<const std::array<uint32_t, MATERIAL_TEXTURE_TYPE_COUNT>>
+                                    texture_key_indices,
+                                const std::span<const TextureData> textures, const ModelImportConfig &import_config)
+    {
+        if (atlased_materials.empty())
+        {
+            return;
+        }
+
+        const auto atlas_dimension = Uint2{
+            .x = import_config.texture_atlas_dimension,
+            .y = import_config.texture_atlas_dimension,
+        };
+
+        const auto padding = import_config.texture_atlas_padding;
+
+        const auto rects = TextureAtlas::pack_rects(dimensions, atlas_dimension, padding);
+        const auto page_count = TextureAtlas::get_page_count(rects);
+
+        auto page_textures = std::vector<const TextureData *>(rects.size());
+
+        for (const auto page_index : std::views::iota(0u, page_count))
+        {
+            for (const auto texture_type : std::views::iota(0u, MATERIAL_TEXTURE_TYPE_COUNT))
+            {
+                auto has_textures = false;
+                for (const auto i : std::views::iota(size_t{0u}, rects.size()))
+                {
+                    const auto texture_key_index = texture_key_indices[atlased_materials[i]][texture_type];
+
+                    page_textures[i] = rects[i].page_index == page_index && texture_key_index != INVALID_INDEX_U32
+                                           ? &textures[texture_key_index]
+                                           : nullptr;
+
+                    has_textures |= page_textures[i] != nullptr;
+                }
+
+                if (!has_textures)
+                {
+                    continue;
+                }
+
+                auto atlas_texture = TextureAtlas::create_atlas_texture(
+                    rects, page_textures, page_index, atlas_dimension, padding,
+                    is_material_texture_srgb(static_cast<MaterialTextureType>(texture_type)));
+
+                const auto compression =
+                    get_texture_compression(static_cast<MaterialTextureType>(texture_type), import_config);
+
+                if (compression != TextureCompression::None && TextureCompressor::can_compress(atlas_dimension))
+                {
+                    atlas_texture = TextureCompressor::compress_texture(atlas_texture, compression);
+                }
+
+                const auto atlas_texture_index = static_cast<uint32_t>(model.textures.size());
+                model.textures.emplace_back(std::move(atlas_texture));
+
+                for (const auto i : std::views::iota(size_t{0u}, rects.size()))
+                {
+                    if (page_textures[i] != nullptr)
+                    {
+                        model.material_data[atlased_materials[i]].texture_indices[texture_type] = atlas_texture_index;
+                    }
+                }
+            }
+        }
+
+        for (const auto i : std::views::iota(size_t{0u}, rects.size()))
+        {
+            const auto &rect = rects[i];
+
+            model.material_data[atlased_materials[i]].texture_coord_transform = math::XMFLOAT4{
+                static_cast<float>(rect.dimension.x) / atlas_dimension.x,
+                static_cast<float>(rect.dimension.y) / atlas_dimension.y,
+                static_cast<float>(rect.position.x) / atlas_dimension.x,
+                static_cast<float>(rect.position.y) / atlas_dimension.y,
+            };
+        }
+
+        core::Log::instance().info(
+            std::format("Packed the textures of {} materials into {} texture atlas pages", rects.size(), page_count));
+    }
+
+    // Main reference : https://github.com/spnda/fastgltf/blob/main/examples/gl_viewer/gl_viewer.cpp.
+    // The textures of the material are loaded separately (see load_material_texture).
+    MaterialData get_material_data_from_material(const fastgltf::Material &material)
+    {
+        auto material_data = MaterialData{};
+
+        material_data.base_color = math::XMFLOAT4{
+            material.pbrData.baseColorFactor[0],
+            material.pbrData.baseColorFactor[1],
+            material.pbrData.baseColorFactor[2],
+            material.pbrData.baseColorFactor[3],
+        };
+
+        material_data.metallic_roughness_factor = math::XMFLOAT2{
+            material.pbrData.metallicFactor,
+            material.pbrData.roughnessFactor,
+        };
+
+        material_data.emissive_factor = math::XMFLOAT3{
+            material.emissiveFactor[0],
+            material.emissiveFactor[1],
+            material.emissiveFactor[2],
+        };
+
+        if (material.normalTexture.has_value())
+        {
+            material_data.normal_scale = material.normalTexture->scale;
+        }
+
+        if (material.occlusionTexture.has_value())
+        {
+            material_data.occlusion_strength = material.occlusionTexture->scale;
+        }
+
+        return material_data;
+    }
+
+    // Run the import time optimizations (as well as LOD / meshlet generation and vertex quantization) on the mesh.
+    // Returns the vertex cache statistics before and after.
+    std::pair<VertexCacheStatistics, VertexCacheStatistics> optimize_mesh_data(MeshData &mesh_data,
+                                                                               const ModelImportConfig &import_config)
+    {
+        const auto statistics_before =
+            MeshOptimizer::get_vertex_cache_statistics(mesh_data.indices, mesh_data.positions.size());
+
+        if (import_config.optimize_vertex_cache)
+        {
+            MeshOptimizer::optimize_vertex_cache(mesh_data.indices, mesh_data.positions.size());
+        }
+
+        if (import_config.optimize_overdraw)
+        {
+            MeshOptimizer::optimize_overdraw(mesh_data.indices, mesh_data.positions);
+        }
+
+        if (import_config.optimize_vertex_fetch)
+        {
+            MeshOptimizer::optimize_vertex_fetch(mesh_data);
+        }
+
+        const auto statistics_after =
+            MeshOptimizer::get_vertex_cache_statistics(mesh_data.indices, mesh_data.positions.size());
+
+        // optimize_vertex_fetch drops unused vertices, so the index format is chosen after it.
+        mesh_data.index_format = get_index_format(mesh_data.positions.size());
+
+        if (import_config.generate_lods)
+        {
+            mesh_data.lods = MeshOptimizer::generate_lods(
+                mesh_data.indices, mesh_data.positions, mesh_data.normals, mesh_data.texture_coords,
+                import_config.max_lod_count, import_config.lod_triangle_ratio, import_config.max_lod_error);
+        }
+
+        if (import_config.generate_meshlets)
+        {
+            mesh_data.meshlet_data =
+                MeshOptimizer::build_meshlets(mesh_data.indices, mesh_data.positions,
+                                              import_config.max_meshlet_vertices, import_config.max_meshlet_triangles);
+        }
+
+        if (import_config.quantize_vertices)
+        {
+            auto &quantized_vertex_data = mesh_data.quantized_vertex_data;
+            const auto vertex_count = mesh_data.positions.size();
+
+            // Streams that were already quantized in the gltf file (and remapped by optimize_vertex_fetch) are kept
+            // as they are, the others are quantized from the float streams.
+            if (quantized_vertex_data.positions.size() != vertex_count)
+            {
+                const auto [offset, scale] = VertexQuantization::get_position_dequantization(mesh_data.positions);
+
+                quantized_vertex_data.positions =
+                    VertexQuantization::quantize_positions(mesh_data.positions, offset, scale);
+                quantized_vertex_data.position_dequantization_offset = offset;
+                quantized_vertex_data.position_dequantization_scale = scale;
+            }
+
+            if (quantized_vertex_data.normals.size() !=
+                vertex_count * VertexQuantization::get_normal_stride(quantized_vertex_data.normal_encoding))
+            {
+                quantized_vertex_data.normals = VertexQuantization::encode_octahedral_normals(mesh_data.normals);
+                quantized_vertex_data.normal_encoding = NormalEncoding::Octahedral;
+            }
+
+            if (quantized_vertex_data.texture_coords.size() != vertex_count)
+            {
+                quantized_vertex_data.texture_coords =
+                    VertexQuantization::encode_half_texture_coords(mesh_data.texture_coords);
+                quantized_vertex_data.texture_coord_encoding = TextureCoordEncoding::Half;
+            }
+        }
+
+        return {statistics_before, statistics_after};
+    }
+
+    // FNV-1a hash of data that is already in memory.
+    uint64_t get_content_hash(const std::span<const std::byte> data)
+    {
+        auto hash = uint64_t{14695981039346656037u};
+        for (const auto byte : data)
+        {
+            hash ^= static_cast<uint8_t>(byte);
+            hash *= uint64_t{1099511628211u};
+        }
+
+        return hash;
+    }
+
+    // Returns the binary chunk of a glb file (empty if the file is not a glb file or has no binary chunk).
+    // Reference : https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#binary-gltf-layout
+    std::span<const std::byte> get_glb_binary_chunk(const std::span<const std::byte> file_data)
+    {
+        static constexpr uint32_t GLB_MAGIC = 0x46546C67u;         // 'glTF'.
+        static constexpr uint32_t BINARY_CHUNK_TYPE = 0x004E4942u; // 'BIN'.
+
+        static constexpr size_t HEADER_SIZE = 12u;
+        static constexpr size_t CHUNK_HEADER_SIZE = 8u;
+
+        const auto read_u32 = [&](const size_t offset) {
+            auto value = uint32_t{};
+            std::memcpy(&value, file_data.data() + offset, sizeof(uint32_t));
+
+            return value;
+        };
+
+        if (file_data.size() < HEADER_SIZE + CHUNK_HEADER_SIZE || read_u32(0u) != GLB_MAGIC)
+        {
+            return {};
+        }
+
+        // The first chunk is always the json chunk.
+        const auto binary_chunk_offset = HEADER_SIZE + CHUNK_HEADER_SIZE + read_u32(HEADER_SIZE);
+        if (binary_chunk_offset + CHUNK_HEADER_SIZE > file_data.size() ||
+            read_u32(binary_chunk_offset + sizeof(uint32_t)) != BINARY_CHUNK_TYPE)
+        {
+            return {};
+        }
+
+        const auto binary_chunk_data_offset = binary_chunk_offset + CHUNK_HEADER_SIZE;
+        const auto binary_chunk_size =
+            std::min<size_t>(read_u32(binary_chunk_offset), file_data.size() - binary_chunk_data_offset);
+
+        return file_data.subspan(binary_chunk_data_offset, binary_chunk_size);
+    }
+
+    // Parse the gltf / glb file data and extract the meshes and materials. readable_size is the number of bytes that
+    // can be read starting at the file data (see core::FileView::get_readable_size). If the file data is followed by
+    // enough readable (zero) padding, the json is parsed in place, else the file data has to be copied.
+    // Buffers are never copied : the glb binary chunk is read from the file data, and external buffers are memory
+    // mapped. Accessor data is converted directly from the buffers into the mesh data, so the peak memory usage is
+    // roughly the size of the loaded model (plus the decoded images).
+    ModelData load_model_from_file_data(const std::span<const std::byte> file_data, const size_t readable_size,
+                                        const std::string_view model_path, const ModelImportConfig &import_config,
+                                        const std::chrono::high_resolution_clock::time_point start_time)
+    {
+        auto model = ModelData{};
+
+        const auto path = std::filesystem::path(core::FileSystem::instance().get_absolute_path(model_path));
+
+        auto data = fastgltf::GltfDataBuffer();
+        const auto *bytes = reinterpret_cast<const uint8_t *>(file_data.data());
+
+        const auto data_loaded = readable_size - file_data.size() >= fastgltf::getGltfBufferPadding()
+                                     ? data.fromByteView(const_cast<uint8_t *>(bytes), file_data.size(), readable_size)
+                                     : data.copyBytes(bytes, file_data.size());
+
+        if (file_data.empty() || !data_loaded)
+        {
+            core::Log::instance().critical(
+                std::format("Failed to load GLTF data from model with path : {}", model_path));
+        }
+
+        // No options are set, so fastgltf only parses the json : GLB buffers, external buffers and images are loaded
+        // by the model loader (through the file system, so that they can be loaded from mounted asset archives as
+        // well).
+        constexpr auto options = fastgltf::Options::None;
+
+        // Create a parser and parse the GLTF.
+        auto parser = fastgltf::Parser(fastgltf::Extensions::KHR_mesh_quantization);
+        auto gltf = fastgltf::Expected<fastgltf::Asset>(fastgltf::Asset{});
+
+        if (path.extension() == ".gltf")
+        {
+            gltf = parser.loadGLTF(&data, path.parent_path(), options);
+        }
+        else if (path.extension() == ".glb")
+        {
+            gltf = parser.loadBinaryGLTF(&data, path.parent_path(), options);
+        }
+        else
+        {
+            core::Log::instance().critical(
+                std::format("GLTF file extension {} is unsupported. The supported types are : GLTF and GLB",
+                            path.extension().string()));
         }
 
         // Check for errors.
@@ -223,6 +1316,69 @@ namespace serenity::asset::ModelLoader
                                                        static_cast<uint32_t>(error)));
         }
 
+        // Setup views of the data of all buffers. The mappings of external buffers are kept alive until the model is
+        // loaded. Data uris are decoded by fastgltf (into a vector) while parsing.
+        const auto glb_binary_chunk = get_glb_binary_chunk(file_data);
+
+        auto buffer_files = std::vector<core::FileView>{};
+        auto buffers = BufferDataViews(gltf.get().buffers.size());
+
+        for (const auto i : std::views::iota(size_t{0u}, buffers.size()))
+        {
+            const auto &buffer = gltf.get().buffers[i];
+
+            if (const auto vector = std::get_if<fastgltf::sources::Vector>(&buffer.data); vector)
+            {
+                buffers[i] = std::as_bytes(std::span{vector->bytes});
+            }
+            else if (const auto uri = std::get_if<fastgltf::sources::URI>(&buffer.data); uri)
+            {
+                const auto buffer_path = (path.parent_path() / uri->uri.path()).string();
+
+                auto file = core::FileSystem::instance().map_file(buffer_path);
+                if (!file.is_valid() || uri->fileByteOffset > file.get_size())
+                {
+                    core::Log::instance().critical(
+                        std::format("Failed to load buffer {} of model {}", buffer_path, model_path));
+                }
+
+                buffers[i] = file.get_span().subspan(uri->fileByteOffset);
+                buffer_files.emplace_back(std::move(file));
+            }
+            else if (i == 0u)
+            {
+                // The first buffer of a glb file (without a uri) refers to the binary chunk.
+                buffers[i] = glb_binary_chunk;
+            }
+
+            if (buffers[i].size() < buffer.byteLength)
+            {
+                core::Log::instance().critical(
+                    std::format("Buffer {} of model {} is missing or truncated", i, model_path));
+            }
+        }
+
+        // fastgltf's accessor iteration (the fallback for sparse accessors and uncommon component types, see
+        // copy_accessor_data) reads the buffers from the asset, so only in that case the buffers are copied into it.
+        if (std::any_of(gltf.get().accessors.begin(), gltf.get().accessors.end(), requires_accessor_iteration))
+        {
+            for (const auto i : std::views::iota(size_t{0u}, buffers.size()))
+            {
+                auto &buffer = gltf.get().buffers[i];
+                if (std::holds_alternative<fastgltf::sources::Vector>(buffer.data))
+                {
+                    continue;
+                }
+
+                const auto *buffer_data = reinterpret_cast<const uint8_t *>(buffers[i].data());
+
+                auto buffer_source = fastgltf::sources::Vector{};
+                buffer_source.bytes = std::vector<uint8_t>(buffer_data, buffer_data + buffers[i].size());
+
+                buffer.data = std::move(buffer_source);
+            }
+        }
+
         const auto &asset = gltf.get();
         if (asset.scenes.size() > 1)
         {
@@ -237,17 +1393,548 @@ namespace serenity::asset::ModelLoader
             scene_index = asset.defaultScene.value();
         }
 
+        auto primitive_tasks = std::vector<PrimitiveTask>{};
         for (const auto &node : asset.scenes.at(scene_index).nodeIndices)
         {
-            const auto data = get_mesh_data_from_node(asset, asset.nodes.at(node), math::XMMatrixIdentity());
-            model.mesh_data.insert(model.mesh_data.end(), data.begin(), data.end());
+            get_primitive_tasks_from_node(asset, asset.nodes.at(node), math::XMMatrixIdentity(), primitive_tasks);
+        }
+
+        // Textures that are shared by materials are only loaded once. The textures of materials whose textures are
+        // small enough are packed into texture atlases.
+        model.material_data.resize(asset.materials.size());
+        model.mesh_data.resize(primitive_tasks.size());
+
+        const auto parent_path = path.parent_path().string();
+
+        auto texture_keys = std::vector<MaterialTextureKey>{};
+        auto texture_key_map = std::map<MaterialTextureKey, uint32_t>{};
+        auto texture_key_indices =
+            std::vector<std::array<uint32_t, MATERIAL_TEXTURE_TYPE_COUNT>>(asset.materials.size());
+
+        auto atlased_materials = std::vector<uint32_t>{};
+        auto atlas_dimensions = std::vector<Uint2>{};
+
+        for (const auto i : std::views::iota(size_t{0u}, asset.materials.size()))
+        {
+            model.material_data[i] = get_material_data_from_material(asset.materials[i]);
+
+            auto material_texture_keys = get_material_texture_keys(asset, asset.materials[i]);
+
+            if (import_config.generate_texture_atlases)
+            {
+                if (const auto atlas_dimension = get_material_atlas_dimension(asset, buffers, material_texture_keys,
+                                                                              parent_path, import_config))
+                {
+                    for (auto &texture_key : material_texture_keys)
+                    {
+                        if (texture_key.has_value())
+                        {
+                            texture_key->atlased = true;
+                        }
+                    }
+
+                    atlased_materials.push_back(static_cast<uint32_t>(i));
+                    atlas_dimensions.push_back(atlas_dimension.value());
+                }
+            }
+
+            for (const auto texture_type : std::views::iota(0u, MATERIAL_TEXTURE_TYPE_COUNT))
+            {
+                const auto &texture_key = material_texture_keys[texture_type];
+                if (!texture_key.has_value())
+                {
+                    texture_key_indices[i][texture_type] = INVALID_INDEX_U32;
+                    continue;
+                }
+
+                const auto [texture_key_entry, inserted] =
+                    texture_key_map.try_emplace(texture_key.value(), static_cast<uint32_t>(texture_keys.size()));
+                if (inserted)
+                {
+                    texture_keys.push_back(texture_key.value());
+                }
+
+                texture_key_indices[i][texture_type] = texture_key_entry->second;
+            }
+        }
+
+        // Image decoding is the slowest part of loading a model, so the textures are scheduled first (one job per
+        // texture), and the primitives are extracted while the textures are being decoded. Each job writes to its
+        // own slot in the output vectors, so the order of meshes / textures is the same as when loading serially.
+        auto &job_system = core::JobSystem::instance();
+
+        auto textures = std::vector<TextureData>(texture_keys.size());
+
+        auto texture_counter = core::JobCounter{};
+        for (const auto i : std::views::iota(size_t{0u}, texture_keys.size()))
+        {
+            job_system.schedule(
+                [&, i]() {
+                    textures[i] = load_material_texture(asset, buffers, texture_keys[i], parent_path, import_config);
+                },
+                texture_counter);
+        }
+
+        auto mesh_statistics = std::vector<std::pair<VertexCacheStatistics, VertexCacheStatistics>>(
+            primitive_tasks.size());
+
+        auto exception = std::exception_ptr{};
+        try
+        {
+            job_system.parallel_for(std::span{primitive_tasks},
+                                    [&](const PrimitiveTask &primitive_task, const size_t i) {
+                                        model.mesh_data[i] = get_mesh_data_from_primitive(
+                                            asset, buffers, *primitive_task.primitive, primitive_task.transform,
+                                            import_config);
+
+                                        mesh_statistics[i] = optimize_mesh_data(model.mesh_data[i], import_config);
+                                    });
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        // The texture jobs reference local variables, so they must complete before returning (even on exception).
+        job_system.wait(texture_counter);
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        // Textures that are not in a texture atlas are used as is.
+        auto texture_indices = std::vector<uint32_t>(texture_keys.size(), INVALID_INDEX_U32);
+        for (const auto i : std::views::iota(size_t{0u}, texture_keys.size()))
+        {
+            if (!texture_keys[i].atlased)
+            {
+                texture_indices[i] = static_cast<uint32_t>(model.textures.size());
+                model.textures.emplace_back(std::move(textures[i]));
+            }
+        }
+
+        for (const auto i : std::views::iota(size_t{0u}, model.material_data.size()))
+        {
+            for (const auto texture_type : std::views::iota(0u, MATERIAL_TEXTURE_TYPE_COUNT))
+            {
+                if (const auto texture_key_index = texture_key_indices[i][texture_type];
+                    texture_key_index != INVALID_INDEX_U32 && !texture_keys[texture_key_index].atlased)
+                {
+                    model.material_data[i].texture_indices[texture_type] = texture_indices[texture_key_index];
+                }
+            }
+        }
+
+        create_texture_atlases(model, atlased_materials, atlas_dimensions, texture_key_indices, textures,
+                               import_config);
+
+        // Report the triangle weighted average of the vertex cache statistics of all meshes.
+        auto statistics_before = VertexCacheStatistics{};
+        auto statistics_after = VertexCacheStatistics{};
+        auto triangle_count = size_t{0u};
+        auto vertex_count = size_t{0u};
+
+        for (const auto i : std::views::iota(size_t{0u}, model.mesh_data.size()))
+        {
+            const auto mesh_triangle_count = static_cast<float>(model.mesh_data[i].indices.size() / 3u);
+            const auto mesh_vertex_count = static_cast<float>(model.mesh_data[i].positions.size());
+
+            statistics_before.acmr += mesh_statistics[i].first.acmr * mesh_triangle_count;
+            statistics_before.atvr += mesh_statistics[i].first.atvr * mesh_vertex_count;
+            statistics_after.acmr += mesh_statistics[i].second.acmr * mesh_triangle_count;
+            statistics_after.atvr += mesh_statistics[i].second.atvr * mesh_vertex_count;
+
+            triangle_count += model.mesh_data[i].indices.size() / 3u;
+            vertex_count += model.mesh_data[i].positions.size();
+        }
+
+        if (triangle_count != 0u && vertex_count != 0u)
+        {
+            core::Log::instance().info(std::format(
+                "Vertex cache statistics of model {} : ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}", model_path,
+                statistics_before.acmr / triangle_count, statistics_after.acmr / triangle_count,
+                statistics_before.atvr / vertex_count, statistics_after.atvr / vertex_count));
+        }
+
+        // Report the triangle count and (maximum, relative to the mesh radius) error of each level of detail.
+        auto max_lod_level = size_t{0u};
+        for (const auto &mesh : model.mesh_data)
+        {
+            max_lod_level = std::max(max_lod_level, mesh.lods.size());
+        }
+
+        for (const auto lod_level : std::views::iota(size_t{0u}, max_lod_level))
+        {
+            auto lod_triangle_count = size_t{0u};
+            auto max_relative_error = 0.0f;
+
+            for (const auto &mesh : model.mesh_data)
+            {
+                // Meshes with fewer levels are drawn at their coarsest level.
+                if (mesh.lods.empty())
+                {
+                    lod_triangle_count += mesh.indices.size() / 3u;
+                    continue;
+                }
+
+                const auto &lod = mesh.lods[std::min(lod_level, mesh.lods.size() - 1u)];
+
+                lod_triangle_count += lod.indices.size() / 3u;
+                if (mesh.bounding_sphere.w > 0.0f)
+                {
+                    max_relative_error = std::max(max_relative_error, lod.error / mesh.bounding_sphere.w);
+                }
+            }
+
+            core::Log::instance().info(std::format("LOD {} of model {} : {} triangles ({:.1f}%), max error {:.4f}",
+                                                   lod_level + 1u, model_path, lod_triangle_count,
+                                                   100.0f * lod_triangle_count / std::max(triangle_count, size_t{1u}),
+                                                   max_relative_error));
+        }
+
+        const auto end_time = std::chrono::high_resolution_clock::now();
+
+        core::Log::instance().info(
+            std::format("Loaded model from path :  {} in {} ms", model_path,
+                        std::chrono::duration<float, std::milli>(end_time - start_time).count()));
+
+        return model;
+    }
+
+    ModelData load_model(const std::string_view model_path, const ModelImportConfig &import_config)
+    {
+        const auto start_time = std::chrono::high_resolution_clock::now();
+
+        // The model is read through the file system, so that it can be loaded from mounted asset archives as well.
+        const auto file = core::FileSystem::instance().map_file(model_path);
+
+        return load_model_from_file_data(file.get_span(), file.get_readable_size(), model_path, import_config,
+                                         start_time);
+    }
+
+    ModelData load_model(const std::span<const std::byte> file_data, const std::string_view model_path,
+                         const ModelImportConfig &import_config)
+    {
+        const auto start_time = std::chrono::high_resolution_clock::now();
+
+        return load_model_from_file_data(file_data, file_data.size(), model_path, import_config, start_time);
+    }
+
+    // Cache of the models loaded with load_shared_model / load_model_async. The cache only holds weak references, the
+    // game objects / scenes using the model own it. There is a separate cache for each import config (keyed by the
+    // hash of all of its settings). Models can be loaded from any thread (the async loads complete on the job system),
+    // so access to the cache is synchronized.
+    struct SharedModelCache
+    {
+        std::mutex mutex{};
+
+        std::unordered_map<uint64_t, std::unordered_map<std::string, std::weak_ptr<const ModelData>>> models_by_path{};
+        std::unordered_map<uint64_t, std::unordered_map<uint64_t, std::weak_ptr<const ModelData>>>
+            models_by_content_hash{};
+
+        // Models that are currently being loaded asynchronously, so that requesting the same model again does not
+        // start another load.
+        std::unordered_map<uint64_t, std::unordered_map<std::string, core::AsyncHandle<ModelData>>> pending_models{};
+    };
+
+    SharedModelCache &get_shared_model_cache()
+    {
+        static auto shared_model_cache = SharedModelCache{};
+        return shared_model_cache;
+    }
+
+    // Hash of all settings of the import config, so that models loaded with different import configs are cached
+    // separately. The settings are hashed one at a time (the config has padding bytes).
+    uint64_t get_shared_model_cache_key(const ModelImportConfig &import_config)
+    {
+        // If this fails, a setting was added to (or removed from) ModelImportConfig, and the settings below must be
+        // updated.
+        static_assert(sizeof(ModelImportConfig) == 56u);
+
+        const auto settings = std::array{
+            static_cast<uint32_t>(import_config.optimize_vertex_cache),
+            static_cast<uint32_t>(import_config.optimize_overdraw),
+            static_cast<uint32_t>(import_config.optimize_vertex_fetch),
+            static_cast<uint32_t>(import_config.generate_meshlets),
+            import_config.max_meshlet_vertices,
+            import_config.max_meshlet_triangles,
+            static_cast<uint32_t>(import_config.generate_lods),
+            import_config.max_lod_count,
+            std::bit_cast<uint32_t>(import_config.lod_triangle_ratio),
+            std::bit_cast<uint32_t>(import_config.max_lod_error),
+            static_cast<uint32_t>(import_config.quantize_vertices),
+            static_cast<uint32_t>(import_config.texture_compression),
+            static_cast<uint32_t>(import_config.normal_texture_compression),
+            static_cast<uint32_t>(import_config.generate_texture_atlases),
+            import_config.max_atlas_texture_dimension,
+            import_config.texture_atlas_dimension,
+            import_config.texture_atlas_padding,
+        };
+
+        return get_content_hash(std::as_bytes(std::span{settings}));
+    }
+
+    // The functions below that take the cache require the cache mutex to be locked.
+    std::shared_ptr<const ModelData> find_shared_model(SharedModelCache &cache, const uint64_t cache_key,
+                                                       const std::string &path,
+                                                       const std::optional<uint64_t> content_hash)
+    {
+        auto &models_by_path = cache.models_by_path[cache_key];
+        if (const auto itr = models_by_path.find(path); itr != models_by_path.end())
+        {
+            if (auto model = itr->second.lock(); model)
+            {
+                return model;
+            }
+        }
+
+        if (content_hash.has_value())
+        {
+            auto &models_by_content_hash = cache.models_by_content_hash[cache_key];
+            if (const auto itr = models_by_content_hash.find(content_hash.value());
+                itr != models_by_content_hash.end())
+            {
+                if (auto model = itr->second.lock(); model)
+                {
+                    models_by_path[path] = model;
+                    return model;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    void add_shared_model(SharedModelCache &cache, const uint64_t cache_key, const std::string &path,
+                          const std::optional<uint64_t> content_hash, const std::shared_ptr<const ModelData> &model)
+    {
+        auto &models_by_path = cache.models_by_path[cache_key];
+        auto &models_by_content_hash = cache.models_by_content_hash[cache_key];
+
+        // Remove entries of models that are no longer referenced.
+        std::erase_if(models_by_path, [](const auto &entry) { return entry.second.expired(); });
+        std::erase_if(models_by_content_hash, [](const auto &entry) { return entry.second.expired(); });
+
+        models_by_path[path] = model;
+        if (content_hash.has_value())
+        {
+            models_by_content_hash[content_hash.value()] = model;
         }
+    }
 
-        // Load material data.
-        model.material_data = get_material_data_from_asset(asset, path.parent_path().string());
+    std::vector<std::string> get_model_dependencies(const std::string_view model_path)
+    {
+        const auto path = std::filesystem::path(core::FileSystem::instance().get_absolute_path(model_path));
 
-        core::Log::instance().info(std::format("Loaded model from path :  {}", model_path));
+        auto data = fastgltf::GltfDataBuffer();
+        if (!data.loadFromFile(path))
+        {
+            core::Log::instance().critical(
+                std::format("Failed to load GLTF data from model with path : {}", model_path));
+        }
+
+        // Only the json is parsed (no options are set), so the external buffers / images are left as URIs.
+        auto parser = fastgltf::Parser(fastgltf::Extensions::KHR_mesh_quantization);
+        auto gltf = fastgltf::Expected<fastgltf::Asset>(fastgltf::Asset{});
+
+        if (path.extension() == ".glb")
+        {
+            gltf = parser.loadBinaryGLTF(&data, path.parent_path(), fastgltf::Options::None);
+        }
+        else
+        {
+            gltf = parser.loadGLTF(&data, path.parent_path(), fastgltf::Options::None);
+        }
+
+        if (const auto error = gltf.error(); error != fastgltf::Error::None)
+        {
+            core::Log::instance().critical(std::format("Error while parsing model {}. GLTF error code : {}", model_path,
+                                                       static_cast<uint32_t>(error)));
+        }
+
+        auto dependencies = std::vector<std::string>{path.string()};
+
+        const auto add_dependency = [&](const auto &data_source) {
+            if (const auto uri = std::get_if<fastgltf::sources::URI>(&data_source))
+            {
+                dependencies.emplace_back((path.parent_path() / uri->uri.path()).lexically_normal().string());
+            }
+        };
+
+        for (const auto &buffer : gltf.get().buffers)
+        {
+            add_dependency(buffer.data);
+        }
+
+        for (const auto &image : gltf.get().images)
+        {
+            add_dependency(image.data);
+        }
+
+        std::sort(dependencies.begin() + 1u, dependencies.end());
+        dependencies.erase(std::unique(dependencies.begin() + 1u, dependencies.end()), dependencies.end());
+
+        return dependencies;
+    }
+
+    std::shared_ptr<const ModelData> load_shared_model(const std::string_view model_path,
+                                                       const ModelImportConfig &import_config)
+    {
+        auto &cache = get_shared_model_cache();
+        const auto cache_key = get_shared_model_cache_key(import_config);
+
+        const auto path = std::filesystem::weakly_canonical(
+            std::filesystem::path(core::FileSystem::instance().get_absolute_path(model_path)));
+
+        auto pending_model = core::AsyncHandle<ModelData>{};
+        {
+            const auto lock = std::scoped_lock(cache.mutex);
+            if (auto model = find_shared_model(cache, cache_key, path.string(), std::nullopt); model)
+            {
+                return model;
+            }
+
+            auto &pending_models = cache.pending_models[cache_key];
+            if (const auto itr = pending_models.find(path.string());
+                itr != pending_models.end() && !itr->second.is_ready())
+            {
+                pending_model = itr->second;
+            }
+        }
+
+        // If the model is already being loaded asynchronously, wait for that load rather than loading it again.
+        if (pending_model.is_valid())
+        {
+            return pending_model.get();
+        }
+
+        const auto start_time = std::chrono::high_resolution_clock::now();
+
+        // The file is mapped once, and used for both hashing and loading the model.
+        const auto file = core::FileSystem::instance().map_file(path.string());
+
+        // gltf files reference buffers / images relative to their own directory, so only glb files (which are self
+        // contained) are de-duplicated based on their contents.
+        const auto content_hash =
+            path.extension() == ".glb" ? std::optional{get_content_hash(file.get_span())} : std::nullopt;
+        if (content_hash.has_value())
+        {
+            const auto lock = std::scoped_lock(cache.mutex);
+            if (auto model = find_shared_model(cache, cache_key, path.string(), content_hash); model)
+            {
+                return model;
+            }
+        }
+
+        const auto model = std::make_shared<const ModelData>(load_model_from_file_data(
+            file.get_span(), file.get_readable_size(), path.string(), import_config, start_time));
+
+        const auto lock = std::scoped_lock(cache.mutex);
+        add_shared_model(cache, cache_key, path.string(), content_hash, model);
 
         return model;
     }
+
+    core::AsyncHandle<ModelData> load_model_async(const std::string_view model_path,
+                                                  const ModelImportConfig &import_config)
+    {
+        auto &cache = get_shared_model_cache();
+        const auto cache_key = get_shared_model_cache_key(import_config);
+
+        const auto path = std::filesystem::weakly_canonical(
+            std::filesystem::path(core::FileSystem::instance().get_absolute_path(model_path)));
+
+        const auto lock = std::scoped_lock(cache.mutex);
+        if (auto model = find_shared_model(cache, cache_key, path.string(), std::nullopt); model)
+        {
+            return core::AsyncHandle<ModelData>(std::move(model));
+        }
+
+        // Ready entries are either models that were added to the cache (which were found above), or loads that
+        // failed (which are retried).
+        auto &pending_models = cache.pending_models[cache_key];
+        std::erase_if(pending_models, [](const auto &entry) { return entry.second.is_ready(); });
+
+        if (const auto itr = pending_models.find(path.string()); itr != pending_models.end())
+        {
+            return itr->second;
+        }
+
+        // The model file is read on the IO thread, and parsed on the job system. The load only completes once the
+        // model has been added to the cache, so the pending entry can be removed as soon as the handle is ready.
+        auto handle = core::AsyncFileLoader::instance().load<ModelData>(
+            path.string(), [path, import_config, cache_key](const core::FileView &file) {
+                const auto start_time = std::chrono::high_resolution_clock::now();
+
+                auto &cache = get_shared_model_cache();
+
+                const auto content_hash =
+                    path.extension() == ".glb" ? std::optional{get_content_hash(file.get_span())} : std::nullopt;
+                if (content_hash.has_value())
+                {
+                    const auto lock = std::scoped_lock(cache.mutex);
+                    if (auto model = find_shared_model(cache, cache_key, path.string(), content_hash); model)
+                    {
+                        return model;
+                    }
+                }
+
+                const auto model = std::make_shared<const ModelData>(load_model_from_file_data(
+                    file.get_span(), file.get_readable_size(), path.string(), import_config, start_time));
+
+                const auto lock = std::scoped_lock(cache.mutex);
+                add_shared_model(cache, cache_key, path.string(), content_hash, model);
+
+                return model;
+            });
+
+        pending_models[path.string()] = handle;
+
+        return handle;
+    }
+
+    // Cache of the cooked models loaded with load_shared_cooked_model. Like SharedModelCache, the cache only holds
+    // weak references, and access to it is synchronized.
+    struct SharedCookedModelCache
+    {
+        std::mutex mutex{};
+
+        std::unordered_map<std::string, std::weak_ptr<const CookedModel>> cooked_models_by_path{};
+    };
+
+    SharedCookedModelCache &get_shared_cooked_model_cache()
+    {
+        static auto shared_cooked_model_cache = SharedCookedModelCache{};
+        return shared_cooked_model_cache;
+    }
+
+    std::shared_ptr<const CookedModel> load_shared_cooked_model(const std::string_view model_path)
+    {
+        auto &cache = get_shared_cooked_model_cache();
+        auto &cooked_models_by_path = cache.cooked_models_by_path;
+
+        const auto path = std::filesystem::weakly_canonical(
+                              std::filesystem::path(core::FileSystem::instance().get_absolute_path(model_path)))
+                              .string();
+
+        // The lock is held while the cooked model is created (which maps and validates the file), so that the same
+        // cooked model is never created twice.
+        const auto lock = std::scoped_lock(cache.mutex);
+
+        if (const auto itr = cooked_models_by_path.find(path); itr != cooked_models_by_path.end())
+        {
+            if (auto cooked_model = itr->second.lock(); cooked_model)
+            {
+                return cooked_model;
+            }
+        }
+
+        const auto cooked_model = std::make_shared<const CookedModel>(path);
+
+        std::erase_if(cooked_models_by_path, [](const auto &entry) { return entry.second.expired(); });
+        cooked_models_by_path[path] = cooked_model;
+
+        return cooked_model;
+    }
 } // namespace serenity::asset::ModelLoader
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include "serenity-engine/asset/texture_atlas.hpp"
+
+namespace serenity::asset::TextureAtlas
+{
+    namespace
+    {
+        // The skyline is the top edge of the packed rects, as a list of horizontal segments from left to right that
+        // span the whole atlas width. Rects are always placed on top of the skyline.
+        struct SkylineSegment
+        {
+            uint32_t x{};
+            uint32_t y{};
+            uint32_t width{};
+        };
+
+        // Dimension of the texture including the gutter, aligned to padding.
+        Uint2 get_padded_dimension(const Uint2 dimension, const uint32_t padding)
+        {
+            const auto align = [&](const uint32_t value) {
+                return (value + 2u * padding + padding - 1u) & ~(padding - 1u);
+            };
+
+            return Uint2{
+                .x = align(dimension.x),
+                .y = align(dimension.y),
+            };
+        }
+
+        // Returns the y coordinate at which a rect with the given dimension fits if its left edge is at the start of
+        // the skyline segment (if it fits at all).
+        std::optional<uint32_t> find_position(const std::vector<SkylineSegment> &skyline, const size_t segment_index,
+                                              const Uint2 dimension, const Uint2 atlas_dimension)
+        {
+            if (skyline[segment_index].x + dimension.x > atlas_dimension.x)
+            {
+                return std::nullopt;
+            }
+
+            // The rect rests on the highest segment below it.
+            auto y = 0u;
+            auto remaining_width = dimension.x;
+            for (auto i = segment_index; remaining_width > 0u; ++i)
+            {
+                y = std::max(y, skyline[i].y);
+                if (y + dimension.y > atlas_dimension.y)
+                {
+                    return std::nullopt;
+                }
+
+                remaining_width -= std::min(remaining_width, skyline[i].width);
+            }
+
+            return y;
+        }
+
+        void add_rect(std::vector<SkylineSegment> &skyline, const size_t segment_index, const Uint2 position,
+                      const Uint2 dimension)
+        {
+            skyline.insert(skyline.begin() + segment_index, SkylineSegment{
+                                                                .x = position.x,
+                                                                .y = position.y + dimension.y,
+                                                                .width = dimension.x,
+                                                            });
+
+            // Remove (or shrink) the segments that are now below the rect.
+            const auto rect_end = position.x + dimension.x;
+            for (auto i = segment_index + 1u; i < skyline.size() && skyline[i].x < rect_end;)
+            {
+                const auto segment_end = skyline[i].x + skyline[i].width;
+                if (segment_end > rect_end)
+                {
+                    skyline[i].x = rect_end;
+                    skyline[i].width = segment_end - rect_end;
+                    break;
+                }
+
+                skyline.erase(skyline.begin() + i);
+            }
+
+            // Merge neighbouring segments with the same height.
+            for (auto i = size_t{0u}; i + 1u < skyline.size();)
+            {
+                if (skyline[i].y == skyline[i + 1u].y)
+                {
+                    skyline[i].width += skyline[i + 1u].width;
+                    skyline.erase(skyline.begin() + i + 1u);
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+        }
+    } // namespace
+
+    std::vector<TextureAtlasRect> pack_rects(const std::span<const Uint2> dimensions, const Uint2 atlas_dimension,
+                                             const uint32_t padding)
+    {
+        if (padding < 4u || !std::has_single_bit(padding))
+        {
+            core::Log::instance().critical(
+                std::format("Texture atlas padding ({}) must be a power of 2 that is at least 4", padding));
+        }
+
+        auto padded_dimensions = std::vector<Uint2>{};
+        padded_dimensions.reserve(dimensions.size());
+
+        for (const auto &dimension : dimensions)
+        {
+            const auto padded_dimension = padded_dimensions.emplace_back(get_padded_dimension(dimension, padding));
+            if (padded_dimension.x > atlas_dimension.x || padded_dimension.y > atlas_dimension.y)
+            {
+                core::Log::instance().critical(
+                    std::format("Texture with dimension {} x {} does not fit in a texture atlas of dimension {} x {}",
+                                dimension.x, dimension.y, atlas_dimension.x, atlas_dimension.y));
+            }
+        }
+
+        // Tallest (then widest) rects first, ties are broken by index so that the packing is deterministic.
+        auto order = std::vector<uint32_t>(dimensions.size());
+        std::iota(order.begin(), order.end(), 0u);
+
+        std::sort(order.begin(), order.end(), [&](const uint32_t a, const uint32_t b) {
+            return std::tuple{padded_dimensions[b].y, padded_dimensions[b].x, a} <
+                   std::tuple{padded_dimensions[a].y, padded_dimensions[a].x, b};
+        });
+
+        auto rects = std::vector<TextureAtlasRect>(dimensions.size());
+        auto pages = std::vector<std::vector<SkylineSegment>>{};
+
+        for (const auto index : order)
+        {
+            const auto padded_dimension = padded_dimensions[index];
+
+            // Bottom left heuristic : the position where the top of the rect is lowest (then the leftmost one), on
+            // the first page where the rect fits.
+            auto page_index = static_cast<uint32_t>(pages.size());
+            auto segment_index = size_t{0u};
+            auto position = Uint2{};
+
+            for (const auto i : std::views::iota(0u, static_cast<uint32_t>(pages.size())))
+            {
+                auto best_top = std::numeric_limits<uint32_t>::max();
+                for (const auto j : std::views::iota(size_t{0u}, pages[i].size()))
+                {
+                    const auto y = find_position(pages[i], j, padded_dimension, atlas_dimension);
+                    if (y.has_value() && y.value() + padded_dimension.y < best_top)
+                    {
+                        best_top = y.value() + padded_dimension.y;
+                        page_index = i;
+                        segment_index = j;
+                        position = Uint2{.x = pages[i][j].x, .y = y.value()};
+                    }
+                }
+
+                if (page_index == i)
+                {
+                    break;
+                }
+            }
+
+            if (page_index == pages.size())
+            {
+                pages.push_back({SkylineSegment{.width = atlas_dimension.x}});
+            }
+
+            add_rect(pages[page_index], segment_index, position, padded_dimension);
+
+            rects[index] = TextureAtlasRect{
+                .page_index = page_index,
+                .position = Uint2{.x = position.x + padding, .y = position.y + padding},
+                .dimension = dimensions[index],
+            };
+        }
+
+        return rects;
+    }
+
+    uint32_t get_page_count(const std::span<const TextureAtlasRect> rects)
+    {
+        auto page_count = 0u;
+        for (const auto &rect : rects)
+        {
+            page_count = std::max(page_count, rect.page_index + 1u);
+        }
+
+        return page_count;
+    }
+
+    uint32_t get_atlas_mip_level_count(const Uint2 atlas_dimension, const uint32_t padding)
+    {
+        return std::min(static_cast<uint32_t>(std::countr_zero(padding)) + 1u,
+                        TextureLoader::get_mip_level_count(atlas_dimension));
+    }
+
+    TextureData create_atlas_texture(const std::span<const TextureAtlasRect> rects,
+                                     const std::span<const TextureData *const> textures, const uint32_t page_index,
+                                     const Uint2 atlas_dimension, const uint32_t padding, const bool is_srgb)
+    {
+        // Space for the full mip chain is reserved, so that generate_mip_chain does not have to reallocate the data.
+        auto data = std::vector<uint8_t>{};
+        data.reserve(TextureLoader::get_mip_chain_texel_count(
+                         atlas_dimension, TextureLoader::get_mip_level_count(atlas_dimension)) *
+                     4u);
+        data.resize(static_cast<size_t>(atlas_dimension.x) * atlas_dimension.y * 4u);
+
+        for (const auto i : std::views::iota(size_t{0u}, rects.size()))
+        {
+            const auto &rect = rects[i];
+            if (rect.page_index != page_index || textures[i] == nullptr)
+            {
+                continue;
+            }
+
+            const auto &texture = *textures[i];
+            const auto source_data = std::get_if<std::vector<uint8_t>>(&texture.data);
+
+            if (source_data == nullptr || texture.num_channels != 4u ||
+                texture.compression != TextureCompression::None || texture.dimension.x != rect.dimension.x ||
+                texture.dimension.y != rect.dimension.y)
+            {
+                core::Log::instance().critical("Textures of a texture atlas must be uncompressed 4 channel 8 bit "
+                                               "textures with the dimension of their rect");
+            }
+
+            // Copy the texture along with its gutter, which wraps around to the opposite edge of the texture.
+            const auto padded_dimension = get_padded_dimension(rect.dimension, padding);
+            const auto origin = Uint2{.x = rect.position.x - padding, .y = rect.position.y - padding};
+
+            const auto wrap = [&](const uint32_t coordinate, const uint32_t size) {
+                return (coordinate + size - padding % size) % size;
+            };
+
+            for (const auto y : std::views::iota(0u, padded_dimension.y))
+            {
+                const auto source_row = source_data->data() +
+                                        static_cast<size_t>(wrap(y, rect.dimension.y)) * rect.dimension.x * 4u;
+                auto destination_row =
+                    data.data() + (static_cast<size_t>(origin.y + y) * atlas_dimension.x + origin.x) * 4u;
+
+                for (const auto x : std::views::iota(0u, padded_dimension.x))
+                {
+                    std::memcpy(destination_row + x * 4u, source_row + wrap(x, rect.dimension.x) * 4u, 4u);
+                }
+            }
+        }
+
+        auto texture_data = TextureData{
+            .dimension = atlas_dimension,
+            .num_channels = 4u,
+            .data = std::move(data),
+        };
+
+        TextureLoader::generate_mip_chain(texture_data, is_srgb);
+
+        // Mip levels after get_atlas_mip_level_count would mix texels of neighbouring textures.
+        const auto mip_levels = get_atlas_mip_level_count(atlas_dimension, padding);
+
+        std::get<std::vector<uint8_t>>(texture_data.data)
+            .resize(TextureLoader::get_mip_chain_texel_count(atlas_dimension, mip_levels) * 4u);
+        texture_data.mip_levels = mip_levels;
+
+        return texture_data;
+    }
+} // namespace serenity::asset::TextureAtlas
\ No newline at end of file
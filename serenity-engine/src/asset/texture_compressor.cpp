@@ -0,0 +1,631 @@
+#include "serenity-engine/asset/texture_compressor.hpp"
+
+#include "serenity-engine/core/job_system.hpp"
+
+namespace serenity::asset::TextureCompressor
+{
+    namespace
+    {
+        // A 4x4 block of RGBA texels in row major order. Values are in the [0, 255] range.
+        using Block = std::array<std::array<float, 4u>, 16u>;
+
+        // Writes the bits of a compressed block, starting from the least significant bit of the first byte.
+        class BitWriter
+        {
+          public:
+            explicit BitWriter(uint8_t *output) : m_output(output) {}
+
+            void write(const uint32_t value, const uint32_t bit_count)
+            {
+                for (const auto i : std::views::iota(0u, bit_count))
+                {
+                    m_output[m_bit_offset / 8u] |= static_cast<uint8_t>(((value >> i) & 1u) << (m_bit_offset % 8u));
+                    ++m_bit_offset;
+                }
+            }
+
+          private:
+            uint8_t *m_output{};
+            uint32_t m_bit_offset{};
+        };
+
+        Block load_block(const uint8_t *texels, const Uint2 dimension, const uint32_t block_x, const uint32_t block_y)
+        {
+            auto block = Block{};
+
+            for (const auto y : std::views::iota(0u, 4u))
+            {
+                for (const auto x : std::views::iota(0u, 4u))
+                {
+                    const auto texel_x = std::min(block_x * 4u + x, dimension.x - 1u);
+                    const auto texel_y = std::min(block_y * 4u + y, dimension.y - 1u);
+
+                    const auto *texel = texels + (static_cast<size_t>(texel_y) * dimension.x + texel_x) * 4u;
+                    for (const auto channel : std::views::iota(0u, 4u))
+                    {
+                        block[y * 4u + x][channel] = texel[channel];
+                    }
+                }
+            }
+
+            return block;
+        }
+
+        template <size_t ChannelCount> using Color = std::array<float, ChannelCount>;
+
+        template <size_t ChannelCount> float get_squared_distance(const Color<ChannelCount> &a, const float *b)
+        {
+            auto distance = 0.0f;
+            for (const auto channel : std::views::iota(size_t{0u}, ChannelCount))
+            {
+                distance += (a[channel] - b[channel]) * (a[channel] - b[channel]);
+            }
+
+            return distance;
+        }
+
+        // Fit a line through the first ChannelCount channels of the block texels (along the principal axis, found
+        // using power iteration on the covariance matrix), and return the end points of the segment that contains the
+        // projection of all texels.
+        template <size_t ChannelCount> std::pair<Color<ChannelCount>, Color<ChannelCount>> fit_line(const Block &block)
+        {
+            auto mean = Color<ChannelCount>{};
+            for (const auto &texel : block)
+            {
+                for (const auto channel : std::views::iota(size_t{0u}, ChannelCount))
+                {
+                    mean[channel] += texel[channel] / 16.0f;
+                }
+            }
+
+            auto covariance = std::array<Color<ChannelCount>, ChannelCount>{};
+            for (const auto &texel : block)
+            {
+                for (const auto i : std::views::iota(size_t{0u}, ChannelCount))
+                {
+                    for (const auto j : std::views::iota(size_t{0u}, ChannelCount))
+                    {
+                        covariance[i][j] += (texel[i] - mean[i]) * (texel[j] - mean[j]);
+                    }
+                }
+            }
+
+            auto axis = Color<ChannelCount>{};
+            axis.fill(1.0f);
+
+            for ([[maybe_unused]] const auto iteration : std::views::iota(0u, 8u))
+            {
+                auto next_axis = Color<ChannelCount>{};
+                auto max_component = 0.0f;
+
+                for (const auto i : std::views::iota(size_t{0u}, ChannelCount))
+                {
+                    for (const auto j : std::views::iota(size_t{0u}, ChannelCount))
+                    {
+                        next_axis[i] += covariance[i][j] * axis[j];
+                    }
+
+                    max_component = std::max(max_component, std::abs(next_axis[i]));
+                }
+
+                // All texels are identical (or the axis is orthogonal to the variation, which the initial axis
+                // makes very unlikely).
+                if (max_component < 1e-6f)
+                {
+                    break;
+                }
+
+                for (const auto i : std::views::iota(size_t{0u}, ChannelCount))
+                {
+                    axis[i] = next_axis[i] / max_component;
+                }
+            }
+
+            auto axis_length_squared = 0.0f;
+            for (const auto value : axis)
+            {
+                axis_length_squared += value * value;
+            }
+
+            auto min_projection = std::numeric_limits<float>::max();
+            auto max_projection = std::numeric_limits<float>::lowest();
+
+            for (const auto &texel : block)
+            {
+                auto projection = 0.0f;
+                for (const auto channel : std::views::iota(size_t{0u}, ChannelCount))
+                {
+                    projection += (texel[channel] - mean[channel]) * axis[channel];
+                }
+
+                min_projection = std::min(min_projection, projection / axis_length_squared);
+                max_projection = std::max(max_projection, projection / axis_length_squared);
+            }
+
+            auto start = Color<ChannelCount>{};
+            auto end = Color<ChannelCount>{};
+
+            for (const auto channel : std::views::iota(size_t{0u}, ChannelCount))
+            {
+                start[channel] = std::clamp(mean[channel] + axis[channel] * min_projection, 0.0f, 255.0f);
+                end[channel] = std::clamp(mean[channel] + axis[channel] * max_projection, 0.0f, 255.0f);
+            }
+
+            return {start, end};
+        }
+
+        // Least squares fit of the end points, given the interpolation weight (of the second end point) selected for
+        // each texel. Returns std::nullopt if the system is singular (i.e all texels use the same weight).
+        template <size_t ChannelCount>
+        std::optional<std::pair<Color<ChannelCount>, Color<ChannelCount>>> refine_end_points(
+            const Block &block, const std::array<float, 16u> &weights)
+        {
+            auto alpha_alpha = 0.0f;
+            auto alpha_beta = 0.0f;
+            auto beta_beta = 0.0f;
+
+            auto alpha_texel = Color<ChannelCount>{};
+            auto beta_texel = Color<ChannelCount>{};
+
+            for (const auto i : std::views::iota(0u, 16u))
+            {
+                const auto beta = weights[i];
+                const auto alpha = 1.0f - beta;
+
+                alpha_alpha += alpha * alpha;
+                alpha_beta += alpha * beta;
+                beta_beta += beta * beta;
+
+                for (const auto channel : std::views::iota(size_t{0u}, ChannelCount))
+                {
+                    alpha_texel[channel] += alpha * block[i][channel];
+                    beta_texel[channel] += beta * block[i][channel];
+                }
+            }
+
+            const auto determinant = alpha_alpha * beta_beta - alpha_beta * alpha_beta;
+            if (std::abs(determinant) < 1e-6f)
+            {
+                return std::nullopt;
+            }
+
+            auto start = Color<ChannelCount>{};
+            auto end = Color<ChannelCount>{};
+
+            for (const auto channel : std::views::iota(size_t{0u}, ChannelCount))
+            {
+                const auto start_value =
+                    (beta_beta * alpha_texel[channel] - alpha_beta * beta_texel[channel]) / determinant;
+                const auto end_value =
+                    (alpha_alpha * beta_texel[channel] - alpha_beta * alpha_texel[channel]) / determinant;
+
+                start[channel] = std::clamp(start_value, 0.0f, 255.0f);
+                end[channel] = std::clamp(end_value, 0.0f, 255.0f);
+            }
+
+            return std::pair{start, end};
+        }
+
+        // BC1 color block (always in the 4 color mode, so that it can be used for BC3 as well).
+        uint16_t to_rgb565(const Color<3u> &color)
+        {
+            const auto r = static_cast<uint32_t>(std::round(color[0] * 31.0f / 255.0f));
+            const auto g = static_cast<uint32_t>(std::round(color[1] * 63.0f / 255.0f));
+            const auto b = static_cast<uint32_t>(std::round(color[2] * 31.0f / 255.0f));
+
+            return static_cast<uint16_t>((r << 11u) | (g << 5u) | b);
+        }
+
+        Color<3u> from_rgb565(const uint16_t color)
+        {
+            const auto r = (color >> 11u) & 31u;
+            const auto g = (color >> 5u) & 63u;
+            const auto b = color & 31u;
+
+            return Color<3u>{
+                static_cast<float>((r << 3u) | (r >> 2u)),
+                static_cast<float>((g << 2u) | (g >> 4u)),
+                static_cast<float>((b << 3u) | (b >> 2u)),
+            };
+        }
+
+        // Selects the palette entry for each texel. Returns the total squared error.
+        template <size_t ChannelCount, size_t PaletteSize>
+        float select_indices(const Block &block, const std::array<Color<ChannelCount>, PaletteSize> &palette,
+                             std::array<uint32_t, 16u> &indices)
+        {
+            auto total_error = 0.0f;
+
+            for (const auto i : std::views::iota(0u, 16u))
+            {
+                auto min_error = std::numeric_limits<float>::max();
+
+                for (const auto palette_index : std::views::iota(size_t{0u}, PaletteSize))
+                {
+                    if (const auto error = get_squared_distance<ChannelCount>(palette[palette_index], block[i].data());
+                        error < min_error)
+                    {
+                        min_error = error;
+                        indices[i] = static_cast<uint32_t>(palette_index);
+                    }
+                }
+
+                total_error += min_error;
+            }
+
+            return total_error;
+        }
+
+        void encode_bc1_block(const Block &block, uint8_t *output)
+        {
+            // Weights of the second end point, for each palette index.
+            static constexpr auto palette_weights = std::array{0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+            const auto encode = [&](const Color<3u> &start, const Color<3u> &end, std::array<uint32_t, 16u> &indices,
+                                    uint16_t &color_0, uint16_t &color_1) {
+                color_0 = to_rgb565(start);
+                color_1 = to_rgb565(end);
+
+                // The 4 color mode requires color_0 > color_1.
+                if (color_0 < color_1)
+                {
+                    std::swap(color_0, color_1);
+                }
+
+                const auto end_point_0 = from_rgb565(color_0);
+                const auto end_point_1 = from_rgb565(color_1);
+
+                auto palette = std::array<Color<3u>, 4u>{};
+                for (const auto palette_index : std::views::iota(0u, 4u))
+                {
+                    for (const auto channel : std::views::iota(0u, 3u))
+                    {
+                        palette[palette_index][channel] =
+                            end_point_0[channel] * (1.0f - palette_weights[palette_index]) +
+                            end_point_1[channel] * palette_weights[palette_index];
+                    }
+                }
+
+                // If color_0 == color_1 the block is in the 3 color mode, where index 0 still decodes to color_0.
+                if (color_0 == color_1)
+                {
+                    indices.fill(0u);
+                    return select_indices<3u, 1u>(block, std::array<Color<3u>, 1u>{palette[0]}, indices);
+                }
+
+                return select_indices<3u, 4u>(block, palette, indices);
+            };
+
+            auto indices = std::array<uint32_t, 16u>{};
+            auto color_0 = uint16_t{};
+            auto color_1 = uint16_t{};
+
+            const auto [start, end] = fit_line<3u>(block);
+            auto error = encode(start, end, indices, color_0, color_1);
+
+            auto weights = std::array<float, 16u>{};
+            for (const auto i : std::views::iota(0u, 16u))
+            {
+                weights[i] = palette_weights[indices[i]];
+            }
+
+            if (const auto refined_end_points = refine_end_points<3u>(block, weights); refined_end_points.has_value())
+            {
+                auto refined_indices = std::array<uint32_t, 16u>{};
+                auto refined_color_0 = uint16_t{};
+                auto refined_color_1 = uint16_t{};
+
+                if (const auto refined_error = encode(refined_end_points->first, refined_end_points->second,
+                                                      refined_indices, refined_color_0, refined_color_1);
+                    refined_error < error)
+                {
+                    indices = refined_indices;
+                    color_0 = refined_color_0;
+                    color_1 = refined_color_1;
+                }
+            }
+
+            auto writer = BitWriter(output);
+            writer.write(color_0, 16u);
+            writer.write(color_1, 16u);
+
+            for (const auto index : indices)
+            {
+                writer.write(index, 2u);
+            }
+        }
+
+        // BC4 single channel block (always in the 8 value mode).
+        void encode_bc4_block(const Block &block, const uint32_t channel, uint8_t *output)
+        {
+            auto min_value = 255.0f;
+            auto max_value = 0.0f;
+
+            for (const auto &texel : block)
+            {
+                min_value = std::min(min_value, texel[channel]);
+                max_value = std::max(max_value, texel[channel]);
+            }
+
+            const auto end_point_0 = static_cast<uint32_t>(max_value);
+            const auto end_point_1 = static_cast<uint32_t>(min_value);
+
+            // Palette index 0 and 1 are the end points, indices 2 to 7 interpolate from end_point_0 to end_point_1.
+            auto palette = std::array<Color<1u>, 8u>{};
+            palette[0][0] = static_cast<float>(end_point_0);
+            palette[1][0] = static_cast<float>(end_point_1);
+
+            for (const auto palette_index : std::views::iota(2u, 8u))
+            {
+                palette[palette_index][0] =
+                    static_cast<float>(((8u - palette_index) * end_point_0 + (palette_index - 1u) * end_point_1) / 7u);
+            }
+
+            auto channel_block = Block{};
+            for (const auto i : std::views::iota(0u, 16u))
+            {
+                channel_block[i][0] = block[i][channel];
+            }
+
+            auto indices = std::array<uint32_t, 16u>{};
+            select_indices<1u, 8u>(channel_block, palette, indices);
+
+            auto writer = BitWriter(output);
+            writer.write(end_point_0, 8u);
+            writer.write(end_point_1, 8u);
+
+            for (const auto index : indices)
+            {
+                writer.write(index, 3u);
+            }
+        }
+
+        // BC7 mode 6 block : RGBA end points with 7 bits per channel and a unique P bit (i.e lowest bit) per end point,
+        // and 4 bit indices.
+        void encode_bc7_block(const Block &block, uint8_t *output)
+        {
+            static constexpr auto index_weights =
+                std::array{0u, 4u, 9u, 13u, 17u, 21u, 26u, 30u, 34u, 38u, 43u, 47u, 51u, 55u, 60u, 64u};
+
+            struct EndPoint
+            {
+                std::array<uint32_t, 4u> color{};
+                uint32_t p_bit{};
+            };
+
+            // Select the P bit (and corresponding 7 bit values) that best represents the end point.
+            const auto quantize = [](const Color<4u> &color) {
+                auto best_end_point = EndPoint{};
+                auto best_error = std::numeric_limits<float>::max();
+
+                for (const auto p_bit : std::views::iota(0u, 2u))
+                {
+                    auto end_point = EndPoint{.p_bit = p_bit};
+                    auto error = 0.0f;
+
+                    for (const auto channel : std::views::iota(0u, 4u))
+                    {
+                        end_point.color[channel] = static_cast<uint32_t>(
+                            std::clamp(std::round((color[channel] - p_bit) / 2.0f), 0.0f, 127.0f));
+
+                        const auto value = static_cast<float>((end_point.color[channel] << 1u) | p_bit);
+                        error += (value - color[channel]) * (value - color[channel]);
+                    }
+
+                    if (error < best_error)
+                    {
+                        best_error = error;
+                        best_end_point = end_point;
+                    }
+                }
+
+                return best_end_point;
+            };
+
+            const auto encode = [&](const Color<4u> &start, const Color<4u> &end, std::array<uint32_t, 16u> &indices,
+                                    std::array<EndPoint, 2u> &end_points) {
+                end_points = {quantize(start), quantize(end)};
+
+                auto palette = std::array<Color<4u>, 16u>{};
+                for (const auto palette_index : std::views::iota(0u, 16u))
+                {
+                    for (const auto channel : std::views::iota(0u, 4u))
+                    {
+                        const auto value_0 = (end_points[0].color[channel] << 1u) | end_points[0].p_bit;
+                        const auto value_1 = (end_points[1].color[channel] << 1u) | end_points[1].p_bit;
+
+                        palette[palette_index][channel] = static_cast<float>(
+                            ((64u - index_weights[palette_index]) * value_0 + index_weights[palette_index] * value_1 +
+                             32u) >>
+                            6u);
+                    }
+                }
+
+                return select_indices<4u, 16u>(block, palette, indices);
+            };
+
+            auto indices = std::array<uint32_t, 16u>{};
+            auto end_points = std::array<EndPoint, 2u>{};
+
+            const auto [start, end] = fit_line<4u>(block);
+            auto error = encode(start, end, indices, end_points);
+
+            auto weights = std::array<float, 16u>{};
+            for (const auto i : std::views::iota(0u, 16u))
+            {
+                weights[i] = index_weights[indices[i]] / 64.0f;
+            }
+
+            if (const auto refined_end_points = refine_end_points<4u>(block, weights); refined_end_points.has_value())
+            {
+                auto refined_indices = std::array<uint32_t, 16u>{};
+                auto refined_end_point_values = std::array<EndPoint, 2u>{};
+
+                if (const auto refined_error = encode(refined_end_points->first, refined_end_points->second,
+                                                      refined_indices, refined_end_point_values);
+                    refined_error < error)
+                {
+                    indices = refined_indices;
+                    end_points = refined_end_point_values;
+                }
+            }
+
+            // The most significant bit of the first index (the anchor index) is implicitly zero.
+            if (indices[0] >= 8u)
+            {
+                std::swap(end_points[0], end_points[1]);
+                for (auto &index : indices)
+                {
+                    index = 15u - index;
+                }
+            }
+
+            auto writer = BitWriter(output);
+
+            // Mode 6 is encoded as 6 zero bits followed by a one bit.
+            writer.write(1u << 6u, 7u);
+
+            for (const auto channel : std::views::iota(0u, 4u))
+            {
+                writer.write(end_points[0].color[channel], 7u);
+                writer.write(end_points[1].color[channel], 7u);
+            }
+
+            writer.write(end_points[0].p_bit, 1u);
+            writer.write(end_points[1].p_bit, 1u);
+
+            writer.write(indices[0], 3u);
+            for (const auto i : std::views::iota(1u, 16u))
+            {
+                writer.write(indices[i], 4u);
+            }
+        }
+
+        void encode_block(const Block &block, const TextureCompression compression, uint8_t *output)
+        {
+            switch (compression)
+            {
+            case TextureCompression::BC1: {
+                encode_bc1_block(block, output);
+            }
+            break;
+
+            case TextureCompression::BC3: {
+                encode_bc4_block(block, 3u, output);
+                encode_bc1_block(block, output + 8u);
+            }
+            break;
+
+            case TextureCompression::BC5: {
+                encode_bc4_block(block, 0u, output);
+                encode_bc4_block(block, 1u, output + 8u);
+            }
+            break;
+
+            case TextureCompression::BC7: {
+                encode_bc7_block(block, output);
+            }
+            break;
+
+            default: {
+            }
+            break;
+            }
+        }
+
+        Uint2 get_block_count(const Uint2 dimension)
+        {
+            return Uint2{
+                .x = (dimension.x + 3u) / 4u,
+                .y = (dimension.y + 3u) / 4u,
+            };
+        }
+    } // namespace
+
+    uint32_t get_bytes_per_block(const TextureCompression compression)
+    {
+        switch (compression)
+        {
+        case TextureCompression::BC1: {
+            return 8u;
+        }
+        break;
+
+        case TextureCompression::BC3:
+        case TextureCompression::BC5:
+        case TextureCompression::BC7: {
+            return 16u;
+        }
+        break;
+
+        default: {
+            return 0u;
+        }
+        break;
+        }
+    }
+
+    bool can_compress(const Uint2 dimension)
+    {
+        return dimension.x != 0u && dimension.y != 0u && dimension.x % 4u == 0u && dimension.y % 4u == 0u;
+    }
+
+    size_t get_compressed_size(const Uint2 dimension, const uint32_t mip_levels, const TextureCompression compression)
+    {
+        auto size = size_t{0u};
+        for (const auto mip_level : std::views::iota(0u, mip_levels))
+        {
+            const auto block_count = get_block_count(TextureLoader::get_mip_dimension(dimension, mip_level));
+            size += static_cast<size_t>(block_count.x) * block_count.y * get_bytes_per_block(compression);
+        }
+
+        return size;
+    }
+
+    TextureData compress_texture(const TextureData &texture_data, const TextureCompression compression)
+    {
+        const auto source_data = std::get_if<std::vector<uint8_t>>(&texture_data.data);
+
+        if (compression == TextureCompression::None || texture_data.compression != TextureCompression::None ||
+            !source_data || texture_data.num_channels != 4u || !can_compress(texture_data.dimension))
+        {
+            return texture_data;
+        }
+
+        auto compressed_texture_data = TextureData{
+            .dimension = texture_data.dimension,
+            .num_channels = texture_data.num_channels,
+            .mip_levels = texture_data.mip_levels,
+            .compression = compression,
+        };
+
+        auto compressed_data =
+            std::vector<uint8_t>(get_compressed_size(texture_data.dimension, texture_data.mip_levels, compression));
+
+        const auto bytes_per_block = get_bytes_per_block(compression);
+
+        for (const auto mip_level : std::views::iota(0u, texture_data.mip_levels))
+        {
+            const auto dimension = TextureLoader::get_mip_dimension(texture_data.dimension, mip_level);
+            const auto block_count = get_block_count(dimension);
+
+            const auto *source =
+                source_data->data() + TextureLoader::get_mip_chain_texel_count(texture_data.dimension, mip_level) * 4u;
+            auto *destination =
+                compressed_data.data() + get_compressed_size(texture_data.dimension, mip_level, compression);
+
+            // Each row of blocks is compressed in parallel.
+            core::JobSystem::instance().parallel_for(block_count.y, [&](const size_t block_y) {
+                for (const auto block_x : std::views::iota(0u, block_count.x))
+                {
+                    encode_block(load_block(source, dimension, block_x, static_cast<uint32_t>(block_y)), compression,
+                                 destination + (block_y * block_count.x + block_x) * bytes_per_block);
+                }
+            });
+        }
+
+        compressed_texture_data.data = std::move(compressed_data);
+
+        return compressed_texture_data;
+    }
+} // namespace serenity::asset::TextureCompressor
\ No newline at end of file
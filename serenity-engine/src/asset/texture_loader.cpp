@@ -1,84 +1,1305 @@
 #include "serenity-engine/asset/texture_loader.hpp"
 
+#include "serenity-engine/asset/float_conversion.hpp"
+#include "serenity-engine/asset/texture_compressor.hpp"
 #include "serenity-engine/core/file_system.hpp"
+#include "serenity-engine/core/job_system.hpp"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
 namespace serenity::asset::TextureLoader
 {
-    TextureData load_texture(const std::string_view texture_path, const uint32_t num_channels)
+    namespace
     {
-        auto texture_data = TextureData{};
+        // Reference : https://en.wikipedia.org/wiki/SRGB.
+        float srgb_to_linear(const float value)
+        {
+            return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+
+        float linear_to_srgb(const float value)
+        {
+            return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        }
 
-        // If the texture extension is 'hdr', that means we need to load the texture as vector of floats. Else, a vector
-        // of uint8_t's is used.
+        // Lookup tables for the sRGB conversions. The linear to sRGB table is indexed by the linear value quantized to
+        // 16 bits, which is precise enough to round to the nearest 8 bit sRGB value.
+        const std::array<float, 256u> &get_srgb_to_linear_table()
+        {
+            static const auto table = []() {
+                auto srgb_to_linear_table = std::array<float, 256u>{};
+                for (const auto i : std::views::iota(0u, 256u))
+                {
+                    srgb_to_linear_table[i] = srgb_to_linear(i / 255.0f);
+                }
 
-        const auto path = core::FileSystem::instance().get_absolute_path(texture_path);
+                return srgb_to_linear_table;
+            }();
 
-        if (const auto extension = std::filesystem::path(path).extension(); extension == ".hdr")
+            return table;
+        }
+
+        const std::vector<uint8_t> &get_linear_to_srgb_table()
         {
-            core::Log::instance().critical("This function is not implemented yet!");
+            static const auto table = []() {
+                auto linear_to_srgb_table = std::vector<uint8_t>(65536u);
+                for (const auto i : std::views::iota(0u, 65536u))
+                {
+                    linear_to_srgb_table[i] = static_cast<uint8_t>(std::round(linear_to_srgb(i / 65535.0f) * 255.0f));
+                }
+
+                return linear_to_srgb_table;
+            }();
+
+            return table;
         }
-        else
+
+        // Channels other than the fourth (alpha) channel are treated as color channels.
+        bool is_color_channel(const uint32_t channel) { return channel != 3u; }
+
+        // Convert a row of 8 bit texels into linear floats.
+        void decode_row(const uint8_t *source, float *destination, const size_t texel_count,
+                        const uint32_t num_channels, const bool is_srgb)
         {
-            auto width = static_cast<int>(0);
-            auto height = static_cast<int>(0);
+            static const auto linear_table = []() {
+                auto unorm_to_float_table = std::array<float, 256u>{};
+                for (const auto i : std::views::iota(0u, 256u))
+                {
+                    unorm_to_float_table[i] = i / 255.0f;
+                }
+
+                return unorm_to_float_table;
+            }();
+
+            // Table used for each channel, selected once per row rather than per texel.
+            auto channel_tables = std::array<const float *, 4u>{};
+            for (const auto channel : std::views::iota(0u, std::min(num_channels, 4u)))
+            {
+                channel_tables[channel] =
+                    is_srgb && is_color_channel(channel) ? get_srgb_to_linear_table().data() : linear_table.data();
+            }
+
+            for (const auto i : std::views::iota(size_t{0u}, texel_count))
+            {
+                for (const auto channel : std::views::iota(0u, num_channels))
+                {
+                    destination[i * num_channels + channel] =
+                        channel_tables[channel][source[i * num_channels + channel]];
+                }
+            }
+        }
+
+        // Convert a row of linear floats into 8 bit texels.
+        void encode_row(const float *source, uint8_t *destination, const size_t texel_count,
+                        const uint32_t num_channels, const bool is_srgb)
+        {
+            const auto component_count = texel_count * num_channels;
+
+            if (!is_srgb)
+            {
+                auto i = size_t{0u};
+
+#if defined(_XM_SSE_INTRINSICS_)
+                // Converts 16 components per iteration.
+                const auto zero = _mm_setzero_ps();
+                const auto one = _mm_set1_ps(1.0f);
+                const auto scale = _mm_set1_ps(255.0f);
 
-            auto data = stbi_load(path.data(), &width, &height, nullptr, static_cast<int>(num_channels));
+                const auto convert = [&](const float *values) {
+                    const auto clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(values), zero), one);
+                    return _mm_cvtps_epi32(_mm_mul_ps(clamped, scale));
+                };
 
-            texture_data.dimension = Uint2{
-                .x = static_cast<uint32_t>(width),
-                .y = static_cast<uint32_t>(height),
+                for (; i + 16u <= component_count; i += 16u)
+                {
+                    const auto low = _mm_packs_epi32(convert(source + i), convert(source + i + 4u));
+                    const auto high = _mm_packs_epi32(convert(source + i + 8u), convert(source + i + 12u));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), _mm_packus_epi16(low, high));
+                }
+#endif
+
+                for (; i < component_count; ++i)
+                {
+                    destination[i] = static_cast<uint8_t>(std::round(std::clamp(source[i], 0.0f, 1.0f) * 255.0f));
+                }
+
+                return;
+            }
+
+            const auto &linear_to_srgb_table = get_linear_to_srgb_table();
+
+            for (const auto i : std::views::iota(size_t{0u}, texel_count))
+            {
+                for (const auto channel : std::views::iota(0u, num_channels))
+                {
+                    const auto value = std::clamp(source[i * num_channels + channel], 0.0f, 1.0f);
+                    destination[i * num_channels + channel] =
+                        is_color_channel(channel)
+                            ? linear_to_srgb_table[static_cast<uint32_t>(value * 65535.0f + 0.5f)]
+                            : static_cast<uint8_t>(value * 255.0f + 0.5f);
+                }
+            }
+        }
+
+        // Generate a row of the next mip level with a 2x2 box filter from two rows of the previous level. For odd
+        // dimensions the last row / column of the source is dropped, and for source dimensions of 1 the row / column
+        // is reused (i.e row_0 == row_1).
+        void downsample_row(const float *row_0, const float *row_1, const uint32_t source_width, float *output,
+                            const uint32_t destination_width, const uint32_t num_channels)
+        {
+            const auto column_offset = [&](const uint32_t x) {
+                return static_cast<size_t>(std::min(x, source_width - 1u)) * num_channels;
             };
 
-            if (!data || width == 0 || height == 0)
+            auto x = 0u;
+
+#if defined(_XM_SSE_INTRINSICS_)
+            // Filters a whole 4 channel texel per iteration.
+            if (num_channels == 4u)
             {
-                core::Log::instance().critical(std::format("Failed to load texture from path : {}", texture_path));
-                return {};
+                const auto quarter = _mm_set1_ps(0.25f);
+
+                for (; x < destination_width; ++x)
+                {
+                    const auto column_0 = column_offset(x * 2u);
+                    const auto column_1 = column_offset(x * 2u + 1u);
+
+                    const auto top = _mm_add_ps(_mm_loadu_ps(row_0 + column_0), _mm_loadu_ps(row_0 + column_1));
+                    const auto bottom = _mm_add_ps(_mm_loadu_ps(row_1 + column_0), _mm_loadu_ps(row_1 + column_1));
+                    const auto sum = _mm_add_ps(top, bottom);
+
+                    _mm_storeu_ps(output + x * 4u, _mm_mul_ps(sum, quarter));
+                }
             }
-            else
+#endif
+
+            for (; x < destination_width; ++x)
             {
-                auto data_vector = std::vector<uint8_t>(static_cast<size_t>(width * height * num_channels));
-                std::memcpy(data_vector.data(), data, data_vector.size());
+                const auto column_0 = column_offset(x * 2u);
+                const auto column_1 = column_offset(x * 2u + 1u);
 
-                texture_data.data = data_vector;
+                for (const auto channel : std::views::iota(0u, num_channels))
+                {
+                    output[x * num_channels + channel] =
+                        (row_0[column_0 + channel] + row_0[column_1 + channel] + row_1[column_0 + channel] +
+                         row_1[column_1 + channel]) *
+                        0.25f;
+                }
             }
         }
 
+        // A cached compressed texture file (.stex) is the header followed by the compressed data.
+        static constexpr uint32_t CACHED_TEXTURE_MAGIC = 0x58455453u; // 'STEX'.
+
+        struct CachedTextureHeader
+        {
+            uint32_t magic{CACHED_TEXTURE_MAGIC};
+            uint32_t encoder_version{TextureCompressor::ENCODER_VERSION};
+            uint64_t cache_key{};
+
+            Uint2 dimension{};
+            uint32_t mip_levels{};
+            TextureCompression compression{};
+
+            uint64_t data_size{};
+        };
+
+        static_assert(sizeof(CachedTextureHeader) == 40u && std::is_trivially_copyable_v<CachedTextureHeader>);
+
+        // FNV-1a hash of the source image file contents and the compression settings.
+        uint64_t get_cache_key(const std::span<const std::byte> source_data, const TextureCompression compression,
+                               const bool is_srgb)
+        {
+            auto hash = uint64_t{14695981039346656037u};
+
+            const auto hash_bytes = [&](const std::span<const std::byte> bytes) {
+                for (const auto byte : bytes)
+                {
+                    hash ^= static_cast<uint8_t>(byte);
+                    hash *= uint64_t{1099511628211u};
+                }
+            };
+
+            const auto settings = std::array{static_cast<uint32_t>(compression), static_cast<uint32_t>(is_srgb),
+                                             TextureCompressor::ENCODER_VERSION};
+
+            hash_bytes(source_data);
+            hash_bytes(std::as_bytes(std::span{settings}));
+
+            return hash;
+        }
+
+        std::string get_cache_path(const uint64_t cache_key)
+        {
+            return core::FileSystem::instance().get_absolute_path(
+                std::format("{}/{:016x}.stex", TEXTURE_CACHE_DIRECTORY, cache_key));
+        }
+
+        std::optional<TextureData> read_cached_texture(const uint64_t cache_key)
+        {
+            const auto cache_path = get_cache_path(cache_key);
+            if (!core::FileSystem::instance().exists(cache_path))
+            {
+                return std::nullopt;
+            }
+
+            const auto file = core::FileSystem::instance().map_file(cache_path);
+            if (!file.is_valid() || file.get_size() < sizeof(CachedTextureHeader))
+            {
+                return std::nullopt;
+            }
+
+            const auto &header = *reinterpret_cast<const CachedTextureHeader *>(file.get_data());
+
+            if (header.magic != CACHED_TEXTURE_MAGIC || header.encoder_version != TextureCompressor::ENCODER_VERSION ||
+                header.cache_key != cache_key || header.mip_levels == 0u ||
+                header.mip_levels > get_mip_level_count(header.dimension) ||
+                header.data_size != TextureCompressor::get_compressed_size(header.dimension, header.mip_levels,
+                                                                           header.compression) ||
+                header.data_size != file.get_size() - sizeof(CachedTextureHeader))
+            {
+                core::Log::instance().warn(std::format("Ignoring invalid cached texture : {}", cache_path));
+                return std::nullopt;
+            }
+
+            const auto *data = reinterpret_cast<const uint8_t *>(file.get_data() + sizeof(CachedTextureHeader));
+
+            return TextureData{
+                .dimension = header.dimension,
+                .num_channels = 4u,
+                .mip_levels = header.mip_levels,
+                .compression = header.compression,
+                .data = std::vector<uint8_t>(data, data + header.data_size),
+            };
+        }
+
+        void write_cached_texture(const uint64_t cache_key, const TextureData &texture_data)
+        {
+            const auto &data = std::get<std::vector<uint8_t>>(texture_data.data);
+
+            const auto header = CachedTextureHeader{
+                .cache_key = cache_key,
+                .dimension = texture_data.dimension,
+                .mip_levels = texture_data.mip_levels,
+                .compression = texture_data.compression,
+                .data_size = data.size(),
+            };
+
+            const auto cache_path = get_cache_path(cache_key);
+
+            // Textures can be loaded in parallel, so the file is written to a unique temporary path first and then
+            // renamed, so that readers never see a partially written file.
+            const auto temporary_path =
+                std::format("{}.{}.tmp", cache_path, std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+            auto error_code = std::error_code{};
+            std::filesystem::create_directories(std::filesystem::path(cache_path).parent_path(), error_code);
+
+            {
+                auto file = std::ofstream(temporary_path, std::ios::binary | std::ios::trunc);
+                if (!file.is_open())
+                {
+                    core::Log::instance().warn(std::format("Failed to open file with path : {}", temporary_path));
+                    return;
+                }
+
+                file.write(reinterpret_cast<const char *>(&header), sizeof(CachedTextureHeader));
+                file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+            }
+
+            std::filesystem::rename(temporary_path, cache_path, error_code);
+            if (error_code)
+            {
+                core::Log::instance().warn(std::format("Failed to write cached texture : {}", cache_path));
+                std::filesystem::remove(temporary_path, error_code);
+            }
+        }
+
+        // Block compress the texture (which must have its full mip chain) and write it to the texture cache. Textures
+        // that cannot be block compressed are returned as is.
+        TextureData compress_and_cache_texture(TextureData &&texture_data, const TextureCompression compression,
+                                               const uint64_t cache_key)
+        {
+            if (!TextureCompressor::can_compress(texture_data.dimension))
+            {
+                core::Log::instance().warn(std::format(
+                    "Texture with dimension {} x {} cannot be block compressed (dimension is not a multiple "
+                    "of 4), using uncompressed texture",
+                    texture_data.dimension.x, texture_data.dimension.y));
+
+                return std::move(texture_data);
+            }
+
+            const auto start_time = std::chrono::high_resolution_clock::now();
+
+            auto compressed_texture_data = TextureCompressor::compress_texture(texture_data, compression);
+
+            const auto end_time = std::chrono::high_resolution_clock::now();
+
+            core::Log::instance().info(
+                std::format("Compressed texture with dimension {} x {} in {} ms", texture_data.dimension.x,
+                            texture_data.dimension.y,
+                            std::chrono::duration<float, std::milli>(end_time - start_time).count()));
+
+            write_cached_texture(cache_key, compressed_texture_data);
+
+            return compressed_texture_data;
+        }
+
+        // OpenEXR loading (single part scanline files only).
+        // Reference : https://openexr.com/en/latest/OpenEXRFileLayout.html.
+        static constexpr uint32_t EXR_MAGIC = 20000630u;
+
+        // Flags in the version field for tiled, multi part and deep data files (which are not supported).
+        static constexpr uint32_t EXR_UNSUPPORTED_VERSION_FLAGS = 0x200u | 0x800u | 0x1000u;
+
+        enum class ExrPixelType : uint32_t
+        {
+            Uint,
+            Half,
+            Float,
+        };
+
+        enum class ExrCompression : uint8_t
+        {
+            None,
+            Rle,
+            Zips,
+            Zip,
+        };
+
+        struct ExrChannel
+        {
+            // Index of the RGBA channel the channel is loaded into (or INVALID_INDEX_U32 if the channel is skipped).
+            uint32_t texture_channel{INVALID_INDEX_U32};
+            ExrPixelType pixel_type{};
+        };
+
+        // Bounds checked reader for the header and chunk data. Reading past the end of the data means the file is
+        // corrupt (or truncated).
+        class ExrReader
+        {
+          public:
+            explicit ExrReader(const std::span<const std::byte> data) : m_data(data) {}
+
+            template <typename T> T read()
+            {
+                auto value = T{};
+                std::memcpy(&value, read_bytes(sizeof(T)).data(), sizeof(T));
+
+                return value;
+            }
+
+            std::span<const std::byte> read_bytes(const size_t size)
+            {
+                if (size > m_data.size() - m_offset)
+                {
+                    core::Log::instance().critical("OpenEXR file is truncated / corrupt");
+                }
+
+                m_offset += size;
+                return m_data.subspan(m_offset - size, size);
+            }
+
+            // Null terminated string.
+            std::string_view read_string()
+            {
+                const auto *begin = reinterpret_cast<const char *>(m_data.data() + m_offset);
+                const auto length = std::string_view(begin, m_data.size() - m_offset).find('\0');
+
+                if (length == std::string_view::npos)
+                {
+                    core::Log::instance().critical("OpenEXR file is truncated / corrupt");
+                }
+
+                m_offset += length + 1u;
+                return std::string_view(begin, length);
+            }
+
+          private:
+            std::span<const std::byte> m_data{};
+            size_t m_offset{};
+        };
+
+        bool is_exr_file(const std::byte *data, const uint32_t size)
+        {
+            auto magic = uint32_t{};
+            if (size >= sizeof(uint32_t))
+            {
+                std::memcpy(&magic, data, sizeof(uint32_t));
+            }
+
+            return magic == EXR_MAGIC;
+        }
+
+        uint32_t get_exr_pixel_type_size(const ExrPixelType pixel_type)
+        {
+            return pixel_type == ExrPixelType::Half ? 2u : 4u;
+        }
+
+        // Only R, G, B, A (optionally with a layer prefix, for ex. 'diffuse.R') and luminance only (Y) channels are
+        // loaded.
+        uint32_t get_exr_texture_channel(const std::string_view name)
+        {
+            const auto channel_name = name.substr(name.find_last_of('.') + 1u);
+
+            if (channel_name == "R" || channel_name == "Y")
+            {
+                return 0u;
+            }
+            else if (channel_name == "G")
+            {
+                return 1u;
+            }
+            else if (channel_name == "B")
+            {
+                return 2u;
+            }
+            else if (channel_name == "A")
+            {
+                return 3u;
+            }
+
+            return INVALID_INDEX_U32;
+        }
+
+        // Decode run length encoded data : a negative count is followed by -count literal bytes, else by a single byte
+        // that is repeated count + 1 times. Returns false if the data does not decode to exactly destination.size()
+        // bytes.
+        bool decode_exr_rle(const std::span<const std::byte> source, const std::span<std::byte> destination)
+        {
+            auto source_offset = size_t{0u};
+            auto destination_offset = size_t{0u};
+
+            while (source_offset < source.size())
+            {
+                const auto count = static_cast<int8_t>(source[source_offset++]);
+
+                if (count < 0)
+                {
+                    const auto literal_count = static_cast<size_t>(-count);
+                    if (literal_count > source.size() - source_offset ||
+                        literal_count > destination.size() - destination_offset)
+                    {
+                        return false;
+                    }
+
+                    std::memcpy(destination.data() + destination_offset, source.data() + source_offset, literal_count);
+                    source_offset += literal_count;
+                    destination_offset += literal_count;
+                }
+                else
+                {
+                    const auto run_length = static_cast<size_t>(count) + 1u;
+                    if (source_offset >= source.size() || run_length > destination.size() - destination_offset)
+                    {
+                        return false;
+                    }
+
+                    std::memset(destination.data() + destination_offset, static_cast<int>(source[source_offset++]),
+                                run_length);
+                    destination_offset += run_length;
+                }
+            }
+
+            return destination_offset == destination.size();
+        }
+
+        // RLE and ZIP compressed data is delta encoded, with the bytes split into two halves (even and odd bytes) to
+        // improve compression. Undo both steps (output is written to destination).
+        void reconstruct_exr_bytes(const std::span<std::byte> source, const std::span<std::byte> destination)
+        {
+            for (const auto i : std::views::iota(size_t{1u}, source.size()))
+            {
+                source[i] = static_cast<std::byte>(static_cast<uint8_t>(source[i - 1u]) +
+                                                   static_cast<uint8_t>(source[i]) - 128u);
+            }
+
+            const auto half_size = (source.size() + 1u) / 2u;
+            for (const auto i : std::views::iota(size_t{0u}, source.size()))
+            {
+                destination[i] = i % 2u == 0u ? source[i / 2u] : source[half_size + i / 2u];
+            }
+        }
+
+        // Load a scanline OpenEXR file into 4 channel (RGBA) float texels. Chunks are decompressed in parallel using
+        // the job system.
+        TextureData load_exr_texture(const std::span<const std::byte> file_data)
+        {
+            auto reader = ExrReader(file_data);
+
+            const auto magic = reader.read<uint32_t>();
+            const auto version = reader.read<uint32_t>();
+
+            if (magic != EXR_MAGIC || (version & 0xffu) != 2u || (version & EXR_UNSUPPORTED_VERSION_FLAGS) != 0u)
+            {
+                core::Log::instance().critical("Only single part scanline OpenEXR files (version 2) are supported");
+            }
+
+            auto channels = std::vector<ExrChannel>{};
+            auto compression = std::optional<ExrCompression>{};
+            auto data_window = std::optional<std::array<int32_t, 4u>>{};
+
+            // The header is a sequence of attributes (name, type, size, value), terminated by an empty name.
+            while (true)
+            {
+                const auto name = reader.read_string();
+                if (name.empty())
+                {
+                    break;
+                }
+
+                reader.read_string();
+                auto attribute = ExrReader(reader.read_bytes(reader.read<uint32_t>()));
+
+                if (name == "channels")
+                {
+                    // Channels are sorted by name, and the pixel data of each line is stored in the same order.
+                    while (true)
+                    {
+                        const auto channel_name = attribute.read_string();
+                        if (channel_name.empty())
+                        {
+                            break;
+                        }
+
+                        const auto pixel_type = attribute.read<uint32_t>();
+                        attribute.read_bytes(4u);
+                        const auto x_sampling = attribute.read<int32_t>();
+                        const auto y_sampling = attribute.read<int32_t>();
+
+                        if (pixel_type > static_cast<uint32_t>(ExrPixelType::Float) || x_sampling != 1 ||
+                            y_sampling != 1)
+                        {
+                            core::Log::instance().critical(std::format(
+                                "OpenEXR channel {} has unsupported pixel type / subsampling", channel_name));
+                        }
+
+                        channels.emplace_back(ExrChannel{
+                            .texture_channel = get_exr_texture_channel(channel_name),
+                            .pixel_type = static_cast<ExrPixelType>(pixel_type),
+                        });
+                    }
+                }
+                else if (name == "compression")
+                {
+                    const auto compression_type = attribute.read<uint8_t>();
+                    if (compression_type > static_cast<uint8_t>(ExrCompression::Zip))
+                    {
+                        core::Log::instance().critical(std::format(
+                            "OpenEXR compression {} is unsupported. The supported compressions are : None, RLE, ZIPS "
+                            "and ZIP",
+                            compression_type));
+                    }
+
+                    compression = static_cast<ExrCompression>(compression_type);
+                }
+                else if (name == "dataWindow")
+                {
+                    data_window = attribute.read<std::array<int32_t, 4u>>();
+                }
+            }
+
+            if (channels.empty() || !compression.has_value() || !data_window.has_value())
+            {
+                core::Log::instance().critical("OpenEXR file is missing the channels / compression / dataWindow");
+            }
+
+            // The data window is (min x, min y, max x, max y), inclusive.
+            const auto min_y = static_cast<int64_t>(data_window.value()[1]);
+            const auto window_width = static_cast<int64_t>(data_window.value()[2]) - data_window.value()[0] + 1;
+            const auto window_height = static_cast<int64_t>(data_window.value()[3]) - min_y + 1;
+
+            if (window_width <= 0 || window_height <= 0 || window_width > 65536 || window_height > 65536)
+            {
+                core::Log::instance().critical(
+                    std::format("OpenEXR file has invalid dimension {} x {}", window_width, window_height));
+            }
+
+            const auto width = static_cast<size_t>(window_width);
+            const auto height = static_cast<size_t>(window_height);
+
+            auto texture_data = TextureData{
+                .dimension = Uint2{.x = static_cast<uint32_t>(width), .y = static_cast<uint32_t>(height)},
+                .num_channels = 4u,
+            };
+
+            // Channels missing in the file are 0, except for alpha which is 1.
+            auto &float_data = texture_data.data.emplace<std::vector<float>>(width * height * 4u);
+            for (const auto i : std::views::iota(size_t{0u}, width * height))
+            {
+                float_data[i * 4u + 3u] = 1.0f;
+            }
+
+            const auto has_luminance_only =
+                std::none_of(channels.begin(), channels.end(), [](const ExrChannel &channel) {
+                    return channel.texture_channel == 1u || channel.texture_channel == 2u;
+                });
+
+            auto line_size = size_t{0u};
+            for (const auto &channel : channels)
+            {
+                line_size += get_exr_pixel_type_size(channel.pixel_type) * width;
+            }
+
+            const auto lines_per_chunk = compression.value() == ExrCompression::Zip ? size_t{16u} : size_t{1u};
+            const auto chunk_count = (height + lines_per_chunk - 1u) / lines_per_chunk;
+
+            // The header is followed by a table with the (file) offset of each chunk.
+            auto offsets = std::vector<uint64_t>(chunk_count);
+            for (auto &offset : offsets)
+            {
+                offset = reader.read<uint64_t>();
+            }
+
+            core::JobSystem::instance().parallel_for(chunk_count, [&](const size_t chunk) {
+                if (offsets[chunk] > file_data.size())
+                {
+                    core::Log::instance().critical("OpenEXR chunk offset is out of bounds");
+                }
+
+                auto chunk_reader = ExrReader(file_data.subspan(offsets[chunk]));
+
+                const auto line = static_cast<int64_t>(chunk_reader.read<int32_t>()) - min_y;
+                if (line < 0 || line >= window_height)
+                {
+                    core::Log::instance().critical("OpenEXR chunk has invalid line coordinate");
+                }
+
+                const auto first_line = static_cast<size_t>(line);
+                const auto line_count = std::min(lines_per_chunk, height - first_line);
+                const auto chunk_size = line_count * line_size;
+
+                const auto stored_data = chunk_reader.read_bytes(chunk_reader.read<uint32_t>());
+
+                // Chunks that do not get smaller by compressing them are stored uncompressed.
+                auto pixel_data = stored_data;
+
+                thread_local auto decompressed_data = std::vector<std::byte>{};
+                thread_local auto reconstructed_data = std::vector<std::byte>{};
+
+                if (compression.value() != ExrCompression::None && stored_data.size() != chunk_size)
+                {
+                    decompressed_data.resize(chunk_size);
+                    reconstructed_data.resize(chunk_size);
+
+                    const auto decompressed =
+                        compression.value() == ExrCompression::Rle
+                            ? decode_exr_rle(stored_data, decompressed_data)
+                            : stbi_zlib_decode_buffer(reinterpret_cast<char *>(decompressed_data.data()),
+                                                      static_cast<int>(chunk_size),
+                                                      reinterpret_cast<const char *>(stored_data.data()),
+                                                      static_cast<int>(stored_data.size())) ==
+                                  static_cast<int>(chunk_size);
+
+                    if (!decompressed)
+                    {
+                        core::Log::instance().critical("Failed to decompress OpenEXR chunk");
+                    }
+
+                    reconstruct_exr_bytes(decompressed_data, reconstructed_data);
+                    pixel_data = reconstructed_data;
+                }
+                else if (stored_data.size() != chunk_size)
+                {
+                    core::Log::instance().critical("OpenEXR chunk has invalid size");
+                }
+
+                // Each line stores all values of the first channel, followed by all values of the next channel etc.
+                auto pixel_offset = size_t{0u};
+                for (const auto line_index : std::views::iota(size_t{0u}, line_count))
+                {
+                    auto *texels = float_data.data() + (first_line + line_index) * width * 4u;
+
+                    for (const auto &channel : channels)
+                    {
+                        const auto value_size = get_exr_pixel_type_size(channel.pixel_type);
+                        const auto *values = pixel_data.data() + pixel_offset;
+
+                        pixel_offset += value_size * width;
+
+                        if (channel.texture_channel == INVALID_INDEX_U32)
+                        {
+                            continue;
+                        }
+
+                        for (const auto x : std::views::iota(size_t{0u}, width))
+                        {
+                            auto value = 0.0f;
+                            switch (channel.pixel_type)
+                            {
+                            case ExrPixelType::Uint: {
+                                auto uint_value = uint32_t{};
+                                std::memcpy(&uint_value, values + x * value_size, sizeof(uint32_t));
+                                value = static_cast<float>(uint_value);
+                            }
+                            break;
+
+                            case ExrPixelType::Half: {
+                                auto half_value = uint16_t{};
+                                std::memcpy(&half_value, values + x * value_size, sizeof(uint16_t));
+                                value = FloatConversion::convert_half_to_float(half_value);
+                            }
+                            break;
+
+                            case ExrPixelType::Float: {
+                                std::memcpy(&value, values + x * value_size, sizeof(float));
+                            }
+                            break;
+                            }
+
+                            texels[x * 4u + channel.texture_channel] = value;
+
+                            // Luminance is replicated into the green and blue channels.
+                            if (has_luminance_only && channel.texture_channel == 0u)
+                            {
+                                texels[x * 4u + 1u] = value;
+                                texels[x * 4u + 2u] = value;
+                            }
+                        }
+                    }
+                }
+            });
+
+            return texture_data;
+        }
+    } // namespace
+
+    TextureData load_texture(const std::string_view texture_path, const uint32_t num_channels, const bool generate_mips,
+                             const bool is_srgb)
+    {
+        // If the texture extension is 'hdr' / 'exr', that means we need to load the texture as vector of floats. Else,
+        // a vector of uint8_t's is used.
+        if (const auto extension = std::filesystem::path(texture_path).extension();
+            extension == ".hdr" || extension == ".exr")
+        {
+            return load_hdr_texture(texture_path, FloatTextureFormat::Float32, generate_mips);
+        }
+
+        // The texture is read through the file system, so that it can be loaded from mounted asset archives as well.
+        const auto file = core::FileSystem::instance().map_file(texture_path);
+        if (!file.is_valid())
+        {
+            core::Log::instance().critical(std::format("Failed to load texture from path : {}", texture_path));
+        }
+
+        auto texture_data =
+            load_texture(file.get_data(), static_cast<uint32_t>(file.get_size()), num_channels, generate_mips, is_srgb);
+
         core::Log::instance().info(std::format("Loaded texture from path :  {}", texture_path));
 
         return texture_data;
     }
 
-    TextureData load_texture(const std::byte *data, const uint32_t size, const uint32_t num_channels)
+    TextureData load_texture(const std::byte *data, const uint32_t size, const uint32_t num_channels,
+                             const bool generate_mips, const bool is_srgb)
     {
-        auto texture_data = TextureData{};
+        // The data vector is allocated once, with space for the full mip chain if mips are generated (so that
+        // generate_mip_chain does not have to reallocate it), and the base level is decoded directly into it.
+        const auto dimension = get_texture_dimension(data, size);
+        const auto mip_levels = generate_mips ? get_mip_level_count(dimension) : 1u;
+
+        auto byte_data = std::vector<uint8_t>{};
+        byte_data.reserve(get_mip_chain_texel_count(dimension, mip_levels) * num_channels);
+        byte_data.resize(static_cast<size_t>(dimension.x) * dimension.y * num_channels);
+
+        auto texture_data = TextureData{
+            .dimension = decode_texture(data, size, num_channels, byte_data),
+            .num_channels = num_channels,
+            .data = std::move(byte_data),
+        };
+
+        if (generate_mips)
+        {
+            generate_mip_chain(texture_data, is_srgb);
+        }
+
+        return texture_data;
+    }
+
+    Uint2 get_texture_dimension(const std::byte *data, const uint32_t size)
+    {
+        auto width = static_cast<int>(0);
+        auto height = static_cast<int>(0);
+        auto channels = static_cast<int>(0);
+
+        if (!stbi_info_from_memory(reinterpret_cast<const stbi_uc *>(data), static_cast<int>(size), &width, &height,
+                                   &channels))
+        {
+            return Uint2{};
+        }
+
+        return Uint2{
+            .x = static_cast<uint32_t>(width),
+            .y = static_cast<uint32_t>(height),
+        };
+    }
 
+    Uint2 decode_texture(const std::byte *data, const uint32_t size, const uint32_t num_channels,
+                         const std::span<uint8_t> destination)
+    {
         auto width = static_cast<int>(0);
         auto height = static_cast<int>(0);
 
-        auto data_loaded_from_memory = stbi_load_from_memory(reinterpret_cast<const stbi_uc *>(data), size, &width,
-                                                             &height, nullptr, static_cast<int>(num_channels));
+        // stbi always decodes into memory it allocates itself, which is freed once copied into the destination.
+        const auto decoded_data = std::unique_ptr<stbi_uc, decltype(&stbi_image_free)>(
+            stbi_load_from_memory(reinterpret_cast<const stbi_uc *>(data), static_cast<int>(size), &width, &height,
+                                  nullptr, static_cast<int>(num_channels)),
+            &stbi_image_free);
+
+        if (!decoded_data || width == 0 || height == 0)
+        {
+            core::Log::instance().critical(std::format("Failed to load texture : {}", stbi_failure_reason()));
+        }
+
+        const auto decoded_size = static_cast<size_t>(width) * static_cast<size_t>(height) * num_channels;
+        if (destination.size() < decoded_size)
+        {
+            core::Log::instance().critical(
+                std::format("Destination ({} bytes) is too small for texture with dimension {} x {} ({} bytes)",
+                            destination.size(), width, height, decoded_size));
+        }
 
-        texture_data.dimension = Uint2{
+        std::memcpy(destination.data(), decoded_data.get(), decoded_size);
+
+        return Uint2{
             .x = static_cast<uint32_t>(width),
             .y = static_cast<uint32_t>(height),
         };
+    }
+
+    TextureData load_hdr_texture(const std::string_view texture_path, const FloatTextureFormat format,
+                                 const bool generate_mips)
+    {
+        const auto file = core::FileSystem::instance().map_file(texture_path);
+        if (!file.is_valid())
+        {
+            core::Log::instance().critical(std::format("Failed to load texture from path : {}", texture_path));
+        }
+
+        auto texture_data = load_hdr_texture(file.get_data(), static_cast<uint32_t>(file.get_size()), format,
+                                             generate_mips);
+
+        core::Log::instance().info(std::format("Loaded texture from path :  {}", texture_path));
+
+        return texture_data;
+    }
 
-        if (!data || width == 0 || height == 0)
+    TextureData load_hdr_texture(const std::byte *data, const uint32_t size, const FloatTextureFormat format,
+                                 const bool generate_mips)
+    {
+        auto texture_data = TextureData{};
+
+        if (is_exr_file(data, size))
         {
-            core::Log::instance().critical("Failed to load texture");
-            return {};
+            texture_data = load_exr_texture(std::span{data, size});
         }
         else
         {
-            auto data_vector = std::vector<uint8_t>(static_cast<size_t>(width * height * num_channels));
-            std::memcpy(data_vector.data(), data_loaded_from_memory, data_vector.size());
+            auto width = static_cast<int>(0);
+            auto height = static_cast<int>(0);
+
+            const auto decoded_data = std::unique_ptr<float, decltype(&stbi_image_free)>(
+                stbi_loadf_from_memory(reinterpret_cast<const stbi_uc *>(data), static_cast<int>(size), &width,
+                                       &height, nullptr, 4),
+                &stbi_image_free);
+
+            if (!decoded_data || width == 0 || height == 0)
+            {
+                core::Log::instance().critical(std::format("Failed to load texture : {}", stbi_failure_reason()));
+            }
+
+            texture_data = TextureData{
+                .dimension = Uint2{.x = static_cast<uint32_t>(width), .y = static_cast<uint32_t>(height)},
+                .num_channels = 4u,
+                .data = std::vector<float>(decoded_data.get(),
+                                           decoded_data.get() + static_cast<size_t>(width) * height * 4u),
+            };
+        }
+
+        if (generate_mips)
+        {
+            generate_mip_chain(texture_data, false);
+        }
+
+        convert_float_texture(texture_data, format);
+
+        return texture_data;
+    }
+
+    void convert_float_texture(TextureData &texture_data, const FloatTextureFormat format)
+    {
+        if (format == FloatTextureFormat::Float32)
+        {
+            return;
+        }
+
+        const auto float_data = std::move(std::get<std::vector<float>>(texture_data.data));
+
+        // Textures are converted in batches of texels, so that large textures are converted in parallel.
+        static constexpr size_t BATCH_TEXEL_COUNT = 16384u;
+
+        const auto num_channels = texture_data.num_channels;
+        const auto texel_count = float_data.size() / num_channels;
+        const auto batch_count = (texel_count + BATCH_TEXEL_COUNT - 1u) / BATCH_TEXEL_COUNT;
+
+        const auto get_batch_texel_count = [&](const size_t batch) {
+            return std::min(BATCH_TEXEL_COUNT, texel_count - batch * BATCH_TEXEL_COUNT);
+        };
+
+        switch (format)
+        {
+        case FloatTextureFormat::Float16: {
+            if (num_channels != 4u)
+            {
+                core::Log::instance().critical("Only 4 channel float textures can be converted to half floats");
+            }
+
+            auto &half_data = texture_data.data.emplace<std::vector<uint16_t>>(float_data.size());
+
+            core::JobSystem::instance().parallel_for(batch_count, [&](const size_t batch) {
+                const auto offset = batch * BATCH_TEXEL_COUNT * num_channels;
+                const auto count = get_batch_texel_count(batch) * num_channels;
+
+                FloatConversion::convert_floats_to_halves(std::span{float_data}.subspan(offset, count),
+                                                          std::span{half_data}.subspan(offset, count));
+            });
+        }
+        break;
+
+        case FloatTextureFormat::R11G11B10: {
+            if (num_channels < 3u)
+            {
+                core::Log::instance().critical("Only 3 or 4 channel float textures can be converted to R11G11B10");
+            }
+
+            auto &packed_data = texture_data.data.emplace<std::vector<uint32_t>>(texel_count);
+
+            core::JobSystem::instance().parallel_for(batch_count, [&](const size_t batch) {
+                const auto offset = batch * BATCH_TEXEL_COUNT;
+                const auto count = get_batch_texel_count(batch);
+
+                FloatConversion::convert_texels_to_r11g11b10(
+                    std::span{float_data}.subspan(offset * num_channels, count * num_channels), num_channels,
+                    std::span{packed_data}.subspan(offset, count));
+            });
 
-            texture_data.data = data_vector;
+            texture_data.num_channels = 3u;
         }
+        break;
+
+        default: {
+            // Float32 textures are returned as is (see above).
+        }
+        break;
+        }
+    }
+
+    core::AsyncHandle<TextureData> load_texture_async(const std::string_view texture_path, const uint32_t num_channels,
+                                                      const bool generate_mips, const bool is_srgb)
+    {
+        return core::AsyncFileLoader::instance().load<TextureData>(
+            texture_path, [texture_path = std::string(texture_path), num_channels, generate_mips,
+                           is_srgb](const core::FileView &file) {
+                auto texture_data = load_texture(file.get_data(), static_cast<uint32_t>(file.get_size()),
+                                                 num_channels, generate_mips, is_srgb);
+
+                core::Log::instance().info(std::format("Loaded texture from path :  {}", texture_path));
+
+                return std::make_shared<const TextureData>(std::move(texture_data));
+            });
+    }
+
+    TextureData load_compressed_texture(const std::string_view texture_path, const TextureCompression compression,
+                                        const bool is_srgb)
+    {
+        // The source file is hashed (to look up the cache) and decoded directly from the mapping.
+        const auto file = core::FileSystem::instance().map_file(texture_path);
+        if (!file.is_valid())
+        {
+            core::Log::instance().critical(std::format("Failed to load texture from path : {}", texture_path));
+        }
+
+        auto texture_data =
+            load_compressed_texture(file.get_data(), static_cast<uint32_t>(file.get_size()), compression, is_srgb);
+
+        core::Log::instance().info(std::format("Loaded texture from path :  {}", texture_path));
 
         return texture_data;
     }
+
+    TextureData load_compressed_texture(const std::byte *data, const uint32_t size,
+                                        const TextureCompression compression, const bool is_srgb)
+    {
+        if (compression == TextureCompression::None)
+        {
+            return load_texture(data, size, 4u, true, is_srgb);
+        }
+
+        const auto cache_key = get_cache_key(std::span{data, size}, compression, is_srgb);
+
+        if (auto cached_texture_data = read_cached_texture(cache_key); cached_texture_data.has_value())
+        {
+            return std::move(cached_texture_data.value());
+        }
+
+        return compress_and_cache_texture(load_texture(data, size, 4u, true, is_srgb), compression, cache_key);
+    }
+
+    TextureData load_packed_texture(const std::span<const TextureChannelSource, 4u> channel_sources,
+                                    const TextureCompression compression)
+    {
+        // The cache key combines the cache keys of the source images with the channel layout.
+        auto cache_key_data = std::vector<uint64_t>{};
+        for (const auto &channel_source : channel_sources)
+        {
+            cache_key_data.push_back(channel_source.data.empty()
+                                         ? uint64_t{0u}
+                                         : get_cache_key(channel_source.data, compression, false));
+            cache_key_data.push_back((uint64_t{channel_source.source_channel} << 8u) | channel_source.fill_value);
+        }
+
+        const auto cache_key = get_cache_key(std::as_bytes(std::span{cache_key_data}), compression, false);
+
+        if (compression != TextureCompression::None)
+        {
+            if (auto cached_texture_data = read_cached_texture(cache_key); cached_texture_data.has_value())
+            {
+                return std::move(cached_texture_data.value());
+            }
+        }
+
+        // Decode each distinct source image once.
+        auto source_textures = std::array<const TextureData *, 4u>{};
+        auto decoded_textures = std::vector<std::pair<const std::byte *, TextureData>>{};
+        decoded_textures.reserve(channel_sources.size());
+
+        auto dimension = Uint2{};
+        for (const auto i : std::views::iota(size_t{0u}, channel_sources.size()))
+        {
+            const auto data = channel_sources[i].data;
+            if (data.empty())
+            {
+                continue;
+            }
+
+            auto decoded_texture = std::find_if(decoded_textures.begin(), decoded_textures.end(),
+                                                [&](const auto &texture) { return texture.first == data.data(); });
+            if (decoded_texture == decoded_textures.end())
+            {
+                decoded_textures.emplace_back(data.data(),
+                                              load_texture(data.data(), static_cast<uint32_t>(data.size()), 4u));
+                decoded_texture = decoded_textures.end() - 1u;
+            }
+
+            source_textures[i] = &decoded_texture->second;
+
+            dimension.x = std::max(dimension.x, decoded_texture->second.dimension.x);
+            dimension.y = std::max(dimension.y, decoded_texture->second.dimension.y);
+        }
+
+        if (dimension.x == 0u || dimension.y == 0u)
+        {
+            return TextureData{};
+        }
+
+        auto packed_data = std::vector<uint8_t>{};
+        packed_data.reserve(get_mip_chain_texel_count(dimension, get_mip_level_count(dimension)) * 4u);
+        packed_data.resize(static_cast<size_t>(dimension.x) * dimension.y * 4u);
+
+        for (const auto channel : std::views::iota(0u, 4u))
+        {
+            const auto source_texture = source_textures[channel];
+            if (source_texture == nullptr)
+            {
+                for (const auto texel : std::views::iota(size_t{0u}, packed_data.size() / 4u))
+                {
+                    packed_data[texel * 4u + channel] = channel_sources[channel].fill_value;
+                }
+
+                continue;
+            }
+
+            const auto &source_data = std::get<std::vector<uint8_t>>(source_texture->data);
+            const auto source_dimension = source_texture->dimension;
+            const auto source_channel = std::min(channel_sources[channel].source_channel, 3u);
+
+            for (const auto y : std::views::iota(0u, dimension.y))
+            {
+                const auto source_y = static_cast<size_t>(y) * source_dimension.y / dimension.y;
+                for (const auto x : std::views::iota(0u, dimension.x))
+                {
+                    const auto source_x = static_cast<size_t>(x) * source_dimension.x / dimension.x;
+
+                    packed_data[(static_cast<size_t>(y) * dimension.x + x) * 4u + channel] =
+                        source_data[(source_y * source_dimension.x + source_x) * 4u + source_channel];
+                }
+            }
+        }
+
+        auto texture_data = TextureData{
+            .dimension = dimension,
+            .num_channels = 4u,
+            .data = std::move(packed_data),
+        };
+
+        generate_mip_chain(texture_data, false);
+
+        if (compression == TextureCompression::None)
+        {
+            return texture_data;
+        }
+
+        return compress_and_cache_texture(std::move(texture_data), compression, cache_key);
+    }
+
+    std::string get_cached_texture_path(const std::span<const std::byte> source_data,
+                                        const TextureCompression compression, const bool is_srgb)
+    {
+        return get_cache_path(get_cache_key(source_data, compression, is_srgb));
+    }
+
+    uint32_t get_mip_level_count(const Uint2 dimension)
+    {
+        return static_cast<uint32_t>(std::bit_width(std::max({dimension.x, dimension.y, 1u})));
+    }
+
+    Uint2 get_mip_dimension(const Uint2 dimension, const uint32_t mip_level)
+    {
+        return Uint2{
+            .x = std::max(dimension.x >> mip_level, 1u),
+            .y = std::max(dimension.y >> mip_level, 1u),
+        };
+    }
+
+    size_t get_mip_chain_texel_count(const Uint2 dimension, const uint32_t mip_levels)
+    {
+        auto texel_count = size_t{0u};
+        for (const auto mip_level : std::views::iota(0u, mip_levels))
+        {
+            const auto mip_dimension = get_mip_dimension(dimension, mip_level);
+            texel_count += static_cast<size_t>(mip_dimension.x) * mip_dimension.y;
+        }
+
+        return texel_count;
+    }
+
+    void generate_mip_chain(TextureData &texture_data, const bool is_srgb)
+    {
+        const auto dimension = texture_data.dimension;
+        const auto num_channels = texture_data.num_channels;
+        const auto mip_levels = get_mip_level_count(dimension);
+
+        // Half float / packed textures are converted after the mip chain is generated (see load_hdr_texture).
+        if (texture_data.mip_levels != 1u || mip_levels == 1u || num_channels == 0u ||
+            std::holds_alternative<std::vector<uint16_t>>(texture_data.data) ||
+            std::holds_alternative<std::vector<uint32_t>>(texture_data.data))
+        {
+            return;
+        }
+
+        auto &job_system = core::JobSystem::instance();
+
+        const auto get_level_offset = [&](const uint32_t mip_level) {
+            return get_mip_chain_texel_count(dimension, mip_level) * num_channels;
+        };
+
+        const auto get_row_size = [&](const Uint2 mip_dimension) {
+            return static_cast<size_t>(mip_dimension.x) * num_channels;
+        };
+
+        // Returns the indices of the two source rows used for a destination row.
+        const auto get_source_rows = [](const Uint2 source_dimension, const size_t row) {
+            return std::pair{row * 2u, std::min<size_t>(row * 2u + 1u, source_dimension.y - 1u)};
+        };
+
+        const auto mip_chain_size = get_level_offset(mip_levels);
+
+        if (auto *float_data = std::get_if<std::vector<float>>(&texture_data.data))
+        {
+            // Float textures are already linear, so each level is filtered directly from the previous level.
+            float_data->resize(mip_chain_size);
+
+            for (const auto mip_level : std::views::iota(1u, mip_levels))
+            {
+                const auto source_dimension = get_mip_dimension(dimension, mip_level - 1u);
+                const auto destination_dimension = get_mip_dimension(dimension, mip_level);
+
+                const auto *source = float_data->data() + get_level_offset(mip_level - 1u);
+                auto *destination = float_data->data() + get_level_offset(mip_level);
+
+                job_system.parallel_for(destination_dimension.y, [&](const size_t row) {
+                    const auto [row_0, row_1] = get_source_rows(source_dimension, row);
+
+                    downsample_row(source + row_0 * get_row_size(source_dimension),
+                                   source + row_1 * get_row_size(source_dimension), source_dimension.x,
+                                   destination + row * get_row_size(destination_dimension), destination_dimension.x,
+                                   num_channels);
+                });
+            }
+        }
+        else
+        {
+            // The levels are filtered in (linear) float precision, and each level is filtered from the float version
+            // of the previous level (rather than the 8 bit version) so that quantization errors do not accumulate.
+            // The base level is decoded two rows at a time while generating the first mip level, so the float buffers
+            // only need to hold mip level 1 and below.
+            auto &byte_data = std::get<std::vector<uint8_t>>(texture_data.data);
+            byte_data.resize(mip_chain_size);
+
+            auto source = std::vector<float>(get_row_size(get_mip_dimension(dimension, 1u)) *
+                                             get_mip_dimension(dimension, 1u).y);
+            auto destination = std::vector<float>(get_row_size(get_mip_dimension(dimension, 2u)) *
+                                                  get_mip_dimension(dimension, 2u).y);
+
+            for (const auto mip_level : std::views::iota(1u, mip_levels))
+            {
+                const auto source_dimension = get_mip_dimension(dimension, mip_level - 1u);
+                const auto destination_dimension = get_mip_dimension(dimension, mip_level);
+
+                auto *output = byte_data.data() + get_level_offset(mip_level);
+
+                // Mip level 1 is written directly into the float buffer the next level is filtered from.
+                auto *filtered = mip_level == 1u ? source.data() : destination.data();
+
+                job_system.parallel_for(destination_dimension.y, [&](const size_t row) {
+                    const auto [row_0, row_1] = get_source_rows(source_dimension, row);
+                    const auto row_size = get_row_size(source_dimension);
+
+                    auto *filtered_row = filtered + row * get_row_size(destination_dimension);
+
+                    if (mip_level == 1u)
+                    {
+                        thread_local auto decoded_rows = std::vector<float>{};
+                        decoded_rows.resize(row_size * 2u);
+
+                        decode_row(byte_data.data() + row_0 * row_size, decoded_rows.data(), source_dimension.x,
+                                   num_channels, is_srgb);
+                        decode_row(byte_data.data() + row_1 * row_size, decoded_rows.data() + row_size,
+                                   source_dimension.x, num_channels, is_srgb);
+
+                        downsample_row(decoded_rows.data(), decoded_rows.data() + row_size, source_dimension.x,
+                                       filtered_row, destination_dimension.x, num_channels);
+                    }
+                    else
+                    {
+                        downsample_row(source.data() + row_0 * row_size, source.data() + row_1 * row_size,
+                                       source_dimension.x, filtered_row, destination_dimension.x, num_channels);
+                    }
+
+                    encode_row(filtered_row, output + row * get_row_size(destination_dimension),
+                               destination_dimension.x, num_channels, is_srgb);
+                });
+
+                if (mip_level != 1u)
+                {
+                    std::swap(source, destination);
+                }
+            }
+        }
+
+        texture_data.mip_levels = mip_levels;
+    }
 } // namespace serenity::asset::TextureLoader
\ No newline at end of file
@@ -0,0 +1,253 @@
+#include "serenity-engine/asset/vertex_quantization.hpp"
+
+#include "serenity-engine/asset/float_conversion.hpp"
+
+using namespace math;
+
+namespace serenity::asset::VertexQuantization
+{
+    namespace
+    {
+        uint32_t encode_octahedral_normal(const XMFLOAT3 normal)
+        {
+            const auto length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+            const auto inverse_length = length > 0.0f ? 1.0f / length : 0.0f;
+
+            auto x = normal.x * inverse_length;
+            auto y = normal.y * inverse_length;
+
+            // Fold the lower hemisphere over the diagonals.
+            if (normal.z < 0.0f)
+            {
+                const auto folded_x = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+                const auto folded_y = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+
+                x = folded_x;
+                y = folded_y;
+            }
+
+            const auto to_snorm = [](const float value) {
+                const auto snorm = static_cast<int32_t>(std::round(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+                return static_cast<uint32_t>(snorm) & 0xffffu;
+            };
+
+            return to_snorm(x) | (to_snorm(y) << 16u);
+        }
+
+#if defined(_XM_SSE_INTRINSICS_)
+        struct TransposedVectors
+        {
+            __m128 x{};
+            __m128 y{};
+            __m128 z{};
+        };
+
+        // Load 4 consecutive XMFLOAT3's and transpose them into x, y and z vectors.
+        TransposedVectors load_transposed(const XMFLOAT3 *source)
+        {
+            const auto a = _mm_loadu_ps(&source[0].x);
+            const auto b = _mm_loadu_ps(&source[1].y);
+            const auto c = _mm_loadu_ps(&source[2].z);
+
+            const auto x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+            const auto y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                                          _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+            const auto z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                                          _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+            return TransposedVectors{.x = x, .y = y, .z = z};
+        }
+#endif
+    } // namespace
+
+    QuantizedVertexData quantize_vertices(const std::span<const math::XMFLOAT3> positions,
+                                          const std::span<const math::XMFLOAT3> normals,
+                                          const std::span<const math::XMFLOAT2> texture_coords)
+    {
+        auto quantized_vertex_data = QuantizedVertexData{};
+
+        std::tie(quantized_vertex_data.position_dequantization_offset,
+                 quantized_vertex_data.position_dequantization_scale) = get_position_dequantization(positions);
+
+        quantized_vertex_data.positions =
+            quantize_positions(positions, quantized_vertex_data.position_dequantization_offset,
+                               quantized_vertex_data.position_dequantization_scale);
+        quantized_vertex_data.normals = encode_octahedral_normals(normals);
+        quantized_vertex_data.texture_coords = encode_half_texture_coords(texture_coords);
+
+        return quantized_vertex_data;
+    }
+
+    std::pair<math::XMFLOAT3, math::XMFLOAT3> get_position_dequantization(
+        const std::span<const math::XMFLOAT3> positions)
+    {
+        if (positions.empty())
+        {
+            return {XMFLOAT3{}, XMFLOAT3{}};
+        }
+
+        auto min_position = XMLoadFloat3(&positions[0]);
+        auto max_position = min_position;
+
+        for (const auto &position : positions)
+        {
+            min_position = XMVectorMin(min_position, XMLoadFloat3(&position));
+            max_position = XMVectorMax(max_position, XMLoadFloat3(&position));
+        }
+
+        auto offset = XMFLOAT3{};
+        auto scale = XMFLOAT3{};
+
+        XMStoreFloat3(&offset, min_position);
+        XMStoreFloat3(&scale, (max_position - min_position) * (1.0f / 65535.0f));
+
+        return {offset, scale};
+    }
+
+    std::vector<QuantizedPosition> quantize_positions(const std::span<const math::XMFLOAT3> positions,
+                                                      const math::XMFLOAT3 offset, const math::XMFLOAT3 scale)
+    {
+        auto quantized_positions = std::vector<QuantizedPosition>(positions.size());
+
+        // Axes with zero extent are quantized to zero.
+        const auto inverse_scale = XMFLOAT3{
+            scale.x > 0.0f ? 1.0f / scale.x : 0.0f,
+            scale.y > 0.0f ? 1.0f / scale.y : 0.0f,
+            scale.z > 0.0f ? 1.0f / scale.z : 0.0f,
+        };
+
+        const auto quantize = [&](const float value, const float component_offset, const float component_scale) {
+            return static_cast<uint16_t>(
+                std::round(std::clamp((value - component_offset) * component_scale, 0.0f, 65535.0f)));
+        };
+
+        auto i = size_t{0u};
+
+#if defined(_XM_SSE_INTRINSICS_)
+        // Quantizes 4 positions per iteration. The 4 x (x, y, z, 0) 16 bit outputs are packed into 2 128 bit stores.
+        const auto offset_x = _mm_set1_ps(offset.x);
+        const auto offset_y = _mm_set1_ps(offset.y);
+        const auto offset_z = _mm_set1_ps(offset.z);
+
+        const auto inverse_scale_x = _mm_set1_ps(inverse_scale.x);
+        const auto inverse_scale_y = _mm_set1_ps(inverse_scale.y);
+        const auto inverse_scale_z = _mm_set1_ps(inverse_scale.z);
+
+        const auto zero = _mm_setzero_ps();
+        const auto max_value = _mm_set1_ps(65535.0f);
+
+        const auto quantize_component = [&](const __m128 value, const __m128 component_offset,
+                                            const __m128 component_inverse_scale) {
+            const auto scaled = _mm_mul_ps(_mm_sub_ps(value, component_offset), component_inverse_scale);
+            return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(scaled, zero), max_value));
+        };
+
+        // Values above 32767 do not fit the signed saturating pack, so the values are biased down before packing and
+        // the bias is restored by flipping the top bit of each 16 bit value.
+        const auto bias = _mm_set1_epi32(32768);
+        const auto top_bit = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+
+        for (; i + 4u <= positions.size(); i += 4u)
+        {
+            const auto [x, y, z] = load_transposed(positions.data() + i);
+
+            const auto x_values = _mm_sub_epi32(quantize_component(x, offset_x, inverse_scale_x), bias);
+            const auto y_values = _mm_sub_epi32(quantize_component(y, offset_y, inverse_scale_y), bias);
+
+            // The z values (with a zero padding in the upper 16 bits) are already in the final 32 bit layout.
+            const auto z_values = quantize_component(z, offset_z, inverse_scale_z);
+
+            // x0 y0 x1 y1 x2 y2 x3 y3 (as 16 bit values).
+            const auto xy_values = _mm_xor_si128(_mm_packs_epi32(_mm_unpacklo_epi32(x_values, y_values),
+                                                                 _mm_unpackhi_epi32(x_values, y_values)),
+                                                 top_bit);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(quantized_positions.data() + i),
+                             _mm_unpacklo_epi32(xy_values, z_values));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(quantized_positions.data() + i + 2u),
+                             _mm_unpackhi_epi32(xy_values, z_values));
+        }
+#endif
+
+        for (; i < positions.size(); ++i)
+        {
+            quantized_positions[i] = QuantizedPosition{
+                .x = quantize(positions[i].x, offset.x, inverse_scale.x),
+                .y = quantize(positions[i].y, offset.y, inverse_scale.y),
+                .z = quantize(positions[i].z, offset.z, inverse_scale.z),
+            };
+        }
+
+        return quantized_positions;
+    }
+
+    std::vector<uint32_t> encode_octahedral_normals(const std::span<const math::XMFLOAT3> normals)
+    {
+        auto encoded_normals = std::vector<uint32_t>(normals.size());
+
+        auto i = size_t{0u};
+
+#if defined(_XM_SSE_INTRINSICS_)
+        // Encodes 4 normals per iteration.
+        const auto sign_mask = _mm_set1_ps(-0.0f);
+        const auto one = _mm_set1_ps(1.0f);
+        const auto snorm_scale = _mm_set1_ps(32767.0f);
+
+        const auto absolute = [&](const __m128 value) { return _mm_andnot_ps(sign_mask, value); };
+
+        for (; i + 4u <= normals.size(); i += 4u)
+        {
+            const auto [x, y, z] = load_transposed(normals.data() + i);
+
+            // Project onto the octahedron (zero length normals are encoded as zero).
+            const auto length = _mm_add_ps(_mm_add_ps(absolute(x), absolute(y)), absolute(z));
+            const auto inverse_length =
+                _mm_and_ps(_mm_div_ps(one, length), _mm_cmpgt_ps(length, _mm_setzero_ps()));
+
+            const auto projected_x = _mm_mul_ps(x, inverse_length);
+            const auto projected_y = _mm_mul_ps(y, inverse_length);
+
+            // Fold the lower hemisphere over the diagonals (1 - |y| is never negative, so the sign of x can be copied
+            // by or-ing in the sign bit).
+            const auto folded_x =
+                _mm_or_ps(_mm_sub_ps(one, absolute(projected_y)), _mm_and_ps(projected_x, sign_mask));
+            const auto folded_y =
+                _mm_or_ps(_mm_sub_ps(one, absolute(projected_x)), _mm_and_ps(projected_y, sign_mask));
+
+            const auto is_lower_hemisphere = _mm_cmplt_ps(z, _mm_setzero_ps());
+
+            const auto to_snorm = [&](const __m128 projected, const __m128 folded) {
+                const auto value = _mm_or_ps(_mm_and_ps(is_lower_hemisphere, folded),
+                                             _mm_andnot_ps(is_lower_hemisphere, projected));
+                return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(value, _mm_sub_ps(_mm_setzero_ps(), one)), one),
+                                                  snorm_scale));
+            };
+
+            const auto encoded = _mm_or_si128(_mm_and_si128(to_snorm(projected_x, folded_x), _mm_set1_epi32(0xffff)),
+                                              _mm_slli_epi32(to_snorm(projected_y, folded_y), 16));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(encoded_normals.data() + i), encoded);
+        }
+#endif
+
+        for (; i < normals.size(); ++i)
+        {
+            encoded_normals[i] = encode_octahedral_normal(normals[i]);
+        }
+
+        return encoded_normals;
+    }
+
+    std::vector<uint32_t> encode_half_texture_coords(const std::span<const math::XMFLOAT2> texture_coords)
+    {
+        auto encoded_texture_coords = std::vector<uint32_t>(texture_coords.size());
+
+        // The two halves of each texture coord (x in the lower 16 bits) have the same layout in memory as the halves of
+        // the x and y components converted one after the other.
+        FloatConversion::convert_floats_to_halves(
+            std::span{reinterpret_cast<const float *>(texture_coords.data()), texture_coords.size() * 2u},
+            std::span{reinterpret_cast<uint16_t *>(encoded_texture_coords.data()), texture_coords.size() * 2u});
+
+        return encoded_texture_coords;
+    }
+} // namespace serenity::asset::VertexQuantization
\ No newline at end of file
@@ -8,6 +8,14 @@ namespace serenity::core
         m_log = std::make_unique<Log>(application_config.log_to_console, application_config.log_to_console);
 
         m_file_system = std::make_unique<FileSystem>();
+        if (std::filesystem::exists(m_file_system->get_absolute_path(FileSystem::ASSET_ARCHIVE_PATH)))
+        {
+            m_file_system->mount_archive(FileSystem::ASSET_ARCHIVE_PATH);
+        }
+
+        m_job_system = std::make_unique<JobSystem>();
+
+        m_async_file_loader = std::make_unique<AsyncFileLoader>();
 
         if (const auto window_dimensions = std::get_if<Uint2>(&application_config.dimensions); window_dimensions)
         {
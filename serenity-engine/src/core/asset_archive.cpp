@@ -0,0 +1,102 @@
+#include "serenity-engine/core/asset_archive.hpp"
+
+#include "serenity-engine/core/lz4.hpp"
+
+namespace serenity::core
+{
+    AssetArchive::AssetArchive(const std::string_view archive_path) : m_archive_path(archive_path)
+    {
+        m_file = MemoryMappedFile(archive_path);
+
+        if (!m_file.is_valid() || m_file.get_size() < sizeof(AssetArchiveHeader))
+        {
+            Log::instance().critical(std::format("Failed to load asset archive with path : {}", archive_path));
+        }
+
+        const auto &header = get_header();
+        if (header.magic != ASSET_ARCHIVE_MAGIC || header.version != ASSET_ARCHIVE_VERSION)
+        {
+            Log::instance().critical(
+                std::format("Asset archive {} has invalid magic / version (version : {}, expected version : {}). The "
+                            "archive has to be packed again",
+                            archive_path, header.version, ASSET_ARCHIVE_VERSION));
+        }
+
+        // Validate that the table of contents and all file data lie within the archive, so the spans handed out never
+        // point past the mapping.
+        const auto is_section_valid = [&](const uint64_t offset, const uint64_t size) {
+            return offset <= m_file.get_size() && size <= m_file.get_size() - offset;
+        };
+
+        if (header.entries_offset % alignof(AssetArchiveEntry) != 0u ||
+            !is_section_valid(header.entries_offset, header.entry_count * sizeof(AssetArchiveEntry)) ||
+            !is_section_valid(header.paths_offset, header.paths_size))
+        {
+            Log::instance().critical(std::format("Asset archive {} is truncated / corrupt", archive_path));
+        }
+
+        for (const auto &entry : get_entries())
+        {
+            if (entry.path_offset > header.paths_size || entry.path_size > header.paths_size - entry.path_offset ||
+                !is_section_valid(entry.data_offset, entry.stored_size) ||
+                (entry.compression == ArchiveCompression::None && entry.stored_size != entry.size) ||
+                entry.compression > ArchiveCompression::Lz4)
+            {
+                Log::instance().critical(std::format("Asset archive {} has invalid entries", archive_path));
+            }
+        }
+
+        // find_entry relies on the entries being sorted by path.
+        const auto entries = get_entries();
+        if (!std::is_sorted(entries.begin(), entries.end(),
+                            [&](const AssetArchiveEntry &a, const AssetArchiveEntry &b) {
+                                return get_path(a) < get_path(b);
+                            }))
+        {
+            Log::instance().critical(std::format("Asset archive {} has unsorted entries", archive_path));
+        }
+
+        Log::instance().info(std::format("Loaded asset archive {} with {} files", archive_path, header.entry_count));
+    }
+
+    const AssetArchiveEntry *AssetArchive::find_entry(const std::string_view path) const
+    {
+        const auto entries = get_entries();
+
+        const auto itr =
+            std::lower_bound(entries.begin(), entries.end(), path,
+                             [&](const AssetArchiveEntry &entry, const std::string_view value) {
+                                 return get_path(entry) < value;
+                             });
+
+        return itr != entries.end() && get_path(*itr) == path ? &*itr : nullptr;
+    }
+
+    void AssetArchive::read(const AssetArchiveEntry &entry, const std::span<std::byte> destination) const
+    {
+        if (destination.size() != entry.size)
+        {
+            Log::instance().critical(std::format("Destination size ({}) does not match size of file {} ({})",
+                                                 destination.size(), get_path(entry), entry.size));
+        }
+
+        const auto stored_data = get_stored_data(entry);
+
+        switch (entry.compression)
+        {
+        case ArchiveCompression::None: {
+            std::memcpy(destination.data(), stored_data.data(), stored_data.size());
+        }
+        break;
+
+        case ArchiveCompression::Lz4: {
+            if (!Lz4::decompress(stored_data, destination))
+            {
+                Log::instance().critical(
+                    std::format("Failed to decompress file {} in asset archive {}", get_path(entry), m_archive_path));
+            }
+        }
+        break;
+        }
+    }
+} // namespace serenity::core
\ No newline at end of file
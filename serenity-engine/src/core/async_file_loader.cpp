@@ -0,0 +1,96 @@
+#include "serenity-engine/core/async_file_loader.hpp"
+
+namespace serenity::core
+{
+    namespace
+    {
+        // The smallest page size of the supported platforms.
+        static constexpr size_t MIN_PAGE_SIZE = 4096u;
+    } // namespace
+
+    AsyncFileLoader::AsyncFileLoader()
+    {
+        m_io_thread = std::thread([this]() { io_thread_function(); });
+
+        Log::instance().info("Created async file loader");
+    }
+
+    AsyncFileLoader::~AsyncFileLoader()
+    {
+        {
+            const auto lock = std::scoped_lock(m_read_request_mutex);
+            m_quit = true;
+        }
+
+        m_read_request_condition_variable.notify_one();
+        m_io_thread.join();
+
+        // Requests that were not read yet are dropped (their handles get a broken promise exception), but the jobs
+        // that are already processing file contents must complete before the loader is destroyed.
+        m_read_requests.clear();
+        JobSystem::instance().wait(m_job_counter);
+    }
+
+    void AsyncFileLoader::add_read_request(const std::string_view path, ReadCallback callback)
+    {
+        {
+            const auto lock = std::scoped_lock(m_read_request_mutex);
+            m_read_requests.emplace_back(ReadRequest{
+                .path = FileSystem::instance().get_absolute_path(path),
+                .callback = std::move(callback),
+            });
+        }
+
+        m_read_request_condition_variable.notify_one();
+    }
+
+    void AsyncFileLoader::io_thread_function()
+    {
+        while (true)
+        {
+            auto read_request = ReadRequest{};
+
+            {
+                auto lock = std::unique_lock(m_read_request_mutex);
+                m_read_request_condition_variable.wait(lock, [&]() { return m_quit || !m_read_requests.empty(); });
+
+                if (m_quit)
+                {
+                    return;
+                }
+
+                read_request = std::move(m_read_requests.front());
+                m_read_requests.pop_front();
+            }
+
+            auto exception = std::exception_ptr{};
+
+            // The file is mapped through the file system, so that it can be read from mounted asset archives as well.
+            // The job processes the file directly from the mapping (the file contents are never copied into a
+            // buffer). The file view is shared, as jobs have to be copyable.
+            auto file = std::make_shared<FileView>(FileSystem::instance().map_file(read_request.path));
+            if (file->is_valid())
+            {
+                // Touch every page of the file, so that the page faults (i.e the actual disk reads) happen on the IO
+                // thread rather than on the worker threads.
+                const auto *data = static_cast<const volatile std::byte *>(file->get_data());
+                for (auto offset = size_t{0u}; offset < file->get_size(); offset += MIN_PAGE_SIZE)
+                {
+                    [[maybe_unused]] const auto byte = data[offset];
+                }
+            }
+            else
+            {
+                exception = std::make_exception_ptr(
+                    std::runtime_error(std::format("Failed to open file with path : {}", read_request.path)));
+            }
+
+            // The file contents are processed on the job system, so the IO thread can start reading the next file.
+            JobSystem::instance().schedule(
+                [callback = std::move(read_request.callback), file = std::move(file), exception]() {
+                    callback(*file, exception);
+                },
+                m_job_counter);
+        }
+    }
+} // namespace serenity::core
\ No newline at end of file
@@ -33,8 +33,56 @@ namespace serenity::core
         }
     }
 
+    void FileSystem::mount_archive(const std::string_view archive_path)
+    {
+        m_archives.emplace_back(std::make_unique<AssetArchive>(get_absolute_path(archive_path)));
+
+        Log::instance().info(std::format("Mounted asset archive {}", archive_path));
+    }
+
+    FileView FileSystem::map_file(const std::string_view path) const
+    {
+        auto file_view = FileView{};
+
+        if (const auto [archive, entry] = find_archive_entry(path); entry)
+        {
+            // Uncompressed files are used directly from the archive mapping.
+            if (entry->compression == ArchiveCompression::None)
+            {
+                file_view.m_data = archive->get_stored_data(*entry);
+            }
+            else
+            {
+                file_view.m_decompressed_data.resize(entry->size);
+                archive->read(*entry, file_view.m_decompressed_data);
+
+                file_view.m_data = file_view.m_decompressed_data;
+            }
+
+            return file_view;
+        }
+
+        file_view.m_file = MemoryMappedFile(get_absolute_path(path));
+        file_view.m_data = file_view.m_file.get_span();
+
+        return file_view;
+    }
+
+    bool FileSystem::exists(const std::string_view path) const
+    {
+        return find_archive_entry(path).second != nullptr || std::filesystem::exists(get_absolute_path(path));
+    }
+
     std::string FileSystem::read_file(const std::string_view path) const
     {
+        if (const auto [archive, entry] = find_archive_entry(path); entry)
+        {
+            auto file_contents = std::string(entry->size, '\0');
+            archive->read(*entry, std::as_writable_bytes(std::span{file_contents}));
+
+            return file_contents;
+        }
+
         auto file = std::ifstream(std::string(path));
         if (!file.is_open())
         {
@@ -63,4 +111,36 @@ namespace serenity::core
 
         file.close();
     }
+
+    std::pair<const AssetArchive *, const AssetArchiveEntry *> FileSystem::find_archive_entry(
+        const std::string_view path) const
+    {
+        if (m_archives.empty())
+        {
+            return {nullptr, nullptr};
+        }
+
+        // Paths in the archive are relative to the root directory (and use '/' as separator).
+        auto relative_path = std::filesystem::path(std::string(path));
+        if (relative_path.is_absolute())
+        {
+            relative_path = relative_path.lexically_relative(std::filesystem::path(m_root_directory).parent_path());
+        }
+
+        const auto archive_path = relative_path.lexically_normal().generic_string();
+        if (archive_path.empty() || archive_path.starts_with(".."))
+        {
+            return {nullptr, nullptr};
+        }
+
+        for (const auto &archive : m_archives | std::views::reverse)
+        {
+            if (const auto entry = archive->find_entry(archive_path); entry)
+            {
+                return {archive.get(), entry};
+            }
+        }
+
+        return {nullptr, nullptr};
+    }
 } // namespace serenity::core
\ No newline at end of file
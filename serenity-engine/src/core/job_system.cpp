@@ -0,0 +1,300 @@
+#include "serenity-engine/core/job_system.hpp"
+
+namespace serenity::core
+{
+    namespace
+    {
+        // The job system a thread belongs to, and the index of the thread's work stealing queue.
+        struct ThreadContext
+        {
+            const JobSystem *job_system{};
+            uint32_t thread_index{INVALID_INDEX_U32};
+        };
+
+        thread_local ThreadContext t_thread_context{};
+    } // namespace
+
+    bool WorkStealingQueue::push(Job *job)
+    {
+        const auto bottom = m_bottom.load(std::memory_order_relaxed);
+        const auto top = m_top.load(std::memory_order_acquire);
+
+        if (bottom - top >= CAPACITY)
+        {
+            return false;
+        }
+
+        m_jobs[bottom % CAPACITY].store(job, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    Job *WorkStealingQueue::pop()
+    {
+        const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            // Queue is empty.
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        auto job = m_jobs[bottom % CAPACITY].load(std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            // Last job in the queue, race against stealing threads for it.
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                job = nullptr;
+            }
+
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return job;
+    }
+
+    Job *WorkStealingQueue::steal()
+    {
+        auto top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        const auto job = m_jobs[top % CAPACITY].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            // Lost the race against the owning thread or another stealing thread.
+            return nullptr;
+        }
+
+        return job;
+    }
+
+    JobSystem::JobSystem(const uint32_t worker_thread_count)
+    {
+        // There is always at least one worker thread, so that jobs make progress even if no thread waits on them (for
+        // ex. the jobs scheduled by the async file loader).
+        const auto hardware_thread_count = std::max(std::thread::hardware_concurrency(), 2u);
+        const auto thread_count = worker_thread_count != 0u ? worker_thread_count + 1u : hardware_thread_count;
+
+        m_queues.reserve(thread_count);
+        for ([[maybe_unused]] const auto i : std::views::iota(0u, thread_count))
+        {
+            m_queues.emplace_back(std::make_unique<WorkStealingQueue>());
+        }
+
+        // The thread creating the job system uses the first queue.
+        t_thread_context = ThreadContext{
+            .job_system = this,
+            .thread_index = 0u,
+        };
+
+        m_worker_threads.reserve(thread_count - 1u);
+        for (const auto i : std::views::iota(1u, thread_count))
+        {
+            m_worker_threads.emplace_back([this, i]() { worker_thread_function(i); });
+        }
+
+        Log::instance().info(std::format("Created job system with {} worker threads", m_worker_threads.size()));
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            const auto lock = std::scoped_lock(m_sleep_mutex);
+            m_quit.store(true);
+        }
+
+        m_sleep_condition_variable.notify_all();
+
+        for (auto &worker_thread : m_worker_threads)
+        {
+            worker_thread.join();
+        }
+
+        t_thread_context = ThreadContext{};
+
+        // Jobs that were scheduled but never waited on.
+        const auto thread_count = static_cast<uint32_t>(m_queues.size());
+        for (const auto i : std::views::iota(0u, thread_count))
+        {
+            while (const auto job = m_queues[i]->steal())
+            {
+                delete job;
+            }
+        }
+
+        for (const auto job : m_shared_queue)
+        {
+            delete job;
+        }
+    }
+
+    void JobSystem::schedule(std::function<void()> job_function, JobCounter &counter)
+    {
+        counter.m_count.fetch_add(1u, std::memory_order_relaxed);
+
+        const auto job = new Job{
+            .function = std::move(job_function),
+            .counter = &counter,
+        };
+
+        if (const auto thread_index = get_current_thread_index(); thread_index != INVALID_INDEX_U32)
+        {
+            if (!m_queues[thread_index]->push(job))
+            {
+                // The queue is full, so execute the job immediately.
+                execute_job(job);
+                return;
+            }
+        }
+        else
+        {
+            const auto lock = std::scoped_lock(m_shared_queue_mutex);
+            m_shared_queue.push_back(job);
+            m_shared_queue_job_count.fetch_add(1u, std::memory_order_release);
+        }
+
+        // Both the pending job count and sleeping thread count are seq_cst, so that either this
+        // thread sees the sleeping worker, or the worker sees the pending job before going to sleep.
+        m_pending_job_count.fetch_add(1u);
+        if (m_sleeping_thread_count.load() > 0u)
+        {
+            const auto lock = std::scoped_lock(m_sleep_mutex);
+            m_sleep_condition_variable.notify_one();
+        }
+    }
+
+    void JobSystem::wait(JobCounter &counter)
+    {
+        const auto thread_index = get_current_thread_index();
+
+        while (!counter.is_complete())
+        {
+            if (const auto job = get_job(thread_index); job)
+            {
+                execute_job(job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        if (counter.m_exception)
+        {
+            const auto exception = std::exchange(counter.m_exception, nullptr);
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void JobSystem::worker_thread_function(const uint32_t thread_index)
+    {
+        t_thread_context = ThreadContext{
+            .job_system = this,
+            .thread_index = thread_index,
+        };
+
+        while (!m_quit.load(std::memory_order_relaxed))
+        {
+            if (const auto job = get_job(thread_index); job)
+            {
+                execute_job(job);
+                continue;
+            }
+
+            auto lock = std::unique_lock(m_sleep_mutex);
+
+            m_sleeping_thread_count.fetch_add(1u);
+            m_sleep_condition_variable.wait(lock, [&]() { return m_pending_job_count.load() > 0u || m_quit.load(); });
+            m_sleeping_thread_count.fetch_sub(1u);
+        }
+    }
+
+    Job *JobSystem::get_job(const uint32_t thread_index)
+    {
+        const auto on_job_found = [&](Job *job) {
+            m_pending_job_count.fetch_sub(1u);
+            return job;
+        };
+
+        if (thread_index != INVALID_INDEX_U32)
+        {
+            if (const auto job = m_queues[thread_index]->pop(); job)
+            {
+                return on_job_found(job);
+            }
+        }
+
+        if (m_shared_queue_job_count.load(std::memory_order_acquire) > 0u)
+        {
+            const auto lock = std::scoped_lock(m_shared_queue_mutex);
+            if (!m_shared_queue.empty())
+            {
+                const auto job = m_shared_queue.front();
+                m_shared_queue.pop_front();
+                m_shared_queue_job_count.fetch_sub(1u, std::memory_order_relaxed);
+
+                return on_job_found(job);
+            }
+        }
+
+        // Steal from the other threads, starting with the queue after this thread's queue so that threads do not all
+        // contend for the same queue.
+        const auto thread_count = static_cast<uint32_t>(m_queues.size());
+        const auto start_index = thread_index != INVALID_INDEX_U32 ? thread_index + 1u : 0u;
+        for (const auto i : std::views::iota(0u, thread_count))
+        {
+            const auto victim_index = (start_index + i) % thread_count;
+            if (victim_index == thread_index)
+            {
+                continue;
+            }
+
+            if (const auto job = m_queues[victim_index]->steal(); job)
+            {
+                return on_job_found(job);
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JobSystem::execute_job(Job *job)
+    {
+        const auto counter = job->counter;
+
+        try
+        {
+            job->function();
+        }
+        catch (...)
+        {
+            const auto lock = std::scoped_lock(counter->m_exception_mutex);
+            if (!counter->m_exception)
+            {
+                counter->m_exception = std::current_exception();
+            }
+        }
+
+        // The counter can be destroyed by the waiting thread as soon as it reaches zero, so it must
+        // not be accessed after being decremented.
+        delete job;
+        counter->m_count.fetch_sub(1u, std::memory_order_release);
+    }
+
+    uint32_t JobSystem::get_current_thread_index() const
+    {
+        return t_thread_context.job_system == this ? t_thread_context.thread_index : INVALID_INDEX_U32;
+    }
+} // namespace serenity::core
\ No newline at end of file
@@ -0,0 +1,231 @@
+#include "serenity-engine/core/lz4.hpp"
+
+namespace serenity::core::Lz4
+{
+    namespace
+    {
+        static constexpr size_t MIN_MATCH_LENGTH = 4u;
+        static constexpr size_t MAX_MATCH_OFFSET = 65535u;
+
+        // The last match must start at least 12 bytes before the end of the block, and the last 5 bytes of the block
+        // are always literals.
+        static constexpr size_t MATCH_START_END_DISTANCE = 12u;
+        static constexpr size_t LAST_LITERALS = 5u;
+
+        static constexpr uint32_t HASH_TABLE_BITS = 16u;
+        static constexpr uint32_t INVALID_POSITION = std::numeric_limits<uint32_t>::max();
+
+        uint32_t read_u32(const std::byte *data)
+        {
+            auto value = uint32_t{};
+            std::memcpy(&value, data, sizeof(uint32_t));
+
+            return value;
+        }
+
+        uint32_t get_hash(const uint32_t sequence)
+        {
+            return (sequence * 2654435761u) >> (32u - HASH_TABLE_BITS);
+        }
+
+        // Lengths that do not fit in the 4 bits of the token are stored as a sequence of bytes (255 means that more
+        // bytes follow).
+        void write_length(std::vector<std::byte> &output, size_t length)
+        {
+            while (length >= 255u)
+            {
+                output.emplace_back(std::byte{255u});
+                length -= 255u;
+            }
+
+            output.emplace_back(static_cast<std::byte>(length));
+        }
+
+        void write_sequence(std::vector<std::byte> &output, const std::span<const std::byte> literals,
+                            const size_t match_offset, const size_t match_length)
+        {
+            const auto literal_length = literals.size();
+            const auto encoded_match_length = match_length != 0u ? match_length - MIN_MATCH_LENGTH : 0u;
+
+            output.emplace_back(static_cast<std::byte>((std::min<size_t>(literal_length, 15u) << 4u) |
+                                                       std::min<size_t>(encoded_match_length, 15u)));
+
+            if (literal_length >= 15u)
+            {
+                write_length(output, literal_length - 15u);
+            }
+
+            output.insert(output.end(), literals.begin(), literals.end());
+
+            // The last sequence of the block only has literals.
+            if (match_length == 0u)
+            {
+                return;
+            }
+
+            output.emplace_back(static_cast<std::byte>(match_offset & 0xFFu));
+            output.emplace_back(static_cast<std::byte>(match_offset >> 8u));
+
+            if (encoded_match_length >= 15u)
+            {
+                write_length(output, encoded_match_length - 15u);
+            }
+        }
+
+        // Returns false if reading the length would go past the end of the input.
+        bool read_length(const std::span<const std::byte> input, size_t &input_offset, size_t &length)
+        {
+            auto byte = uint8_t{255u};
+            while (byte == 255u)
+            {
+                if (input_offset >= input.size())
+                {
+                    return false;
+                }
+
+                byte = static_cast<uint8_t>(input[input_offset++]);
+                length += byte;
+            }
+
+            return true;
+        }
+    } // namespace
+
+    size_t get_max_compressed_size(const size_t size)
+    {
+        return size + size / 255u + 16u;
+    }
+
+    std::vector<std::byte> compress(const std::span<const std::byte> data)
+    {
+        auto output = std::vector<std::byte>{};
+        output.reserve(get_max_compressed_size(data.size()));
+
+        auto literal_start = size_t{0u};
+
+        if (data.size() > MATCH_START_END_DISTANCE)
+        {
+            // Position of the last occurence of each (hashed) 4 byte sequence.
+            auto hash_table = std::vector<uint32_t>(size_t{1u} << HASH_TABLE_BITS, INVALID_POSITION);
+
+            const auto match_start_limit = data.size() - MATCH_START_END_DISTANCE;
+            const auto match_end_limit = data.size() - LAST_LITERALS;
+
+            auto position = size_t{0u};
+            while (position < match_start_limit)
+            {
+                const auto sequence = read_u32(data.data() + position);
+                const auto hash = get_hash(sequence);
+
+                const auto candidate = hash_table[hash];
+                hash_table[hash] = static_cast<uint32_t>(position);
+
+                if (candidate == INVALID_POSITION || position - candidate > MAX_MATCH_OFFSET ||
+                    read_u32(data.data() + candidate) != sequence)
+                {
+                    ++position;
+                    continue;
+                }
+
+                auto match_length = MIN_MATCH_LENGTH;
+                while (position + match_length < match_end_limit &&
+                       data[candidate + match_length] == data[position + match_length])
+                {
+                    ++match_length;
+                }
+
+                write_sequence(output, data.subspan(literal_start, position - literal_start), position - candidate,
+                               match_length);
+
+                position += match_length;
+                literal_start = position;
+            }
+        }
+
+        write_sequence(output, data.subspan(literal_start), 0u, 0u);
+
+        return output;
+    }
+
+    bool decompress(const std::span<const std::byte> compressed_data, const std::span<std::byte> destination)
+    {
+        auto input_offset = size_t{0u};
+        auto output_offset = size_t{0u};
+
+        while (input_offset < compressed_data.size())
+        {
+            const auto token = static_cast<uint8_t>(compressed_data[input_offset++]);
+
+            auto literal_length = static_cast<size_t>(token >> 4u);
+            if (literal_length == 15u && !read_length(compressed_data, input_offset, literal_length))
+            {
+                return false;
+            }
+
+            if (literal_length > compressed_data.size() - input_offset ||
+                literal_length > destination.size() - output_offset)
+            {
+                return false;
+            }
+
+            // Sequences can have no literals, and the data pointers of empty spans can be nullptr (which memcpy must
+            // not be called with, even for a size of 0).
+            if (literal_length != 0u)
+            {
+                std::memcpy(destination.data() + output_offset, compressed_data.data() + input_offset,
+                            literal_length);
+            }
+
+            input_offset += literal_length;
+            output_offset += literal_length;
+
+            // The last sequence has no match.
+            if (input_offset == compressed_data.size())
+            {
+                break;
+            }
+
+            if (compressed_data.size() - input_offset < 2u)
+            {
+                return false;
+            }
+
+            const auto match_offset = static_cast<size_t>(compressed_data[input_offset]) |
+                                      (static_cast<size_t>(compressed_data[input_offset + 1u]) << 8u);
+            input_offset += 2u;
+
+            auto match_length = static_cast<size_t>(token & 0xFu);
+            if (match_length == 15u && !read_length(compressed_data, input_offset, match_length))
+            {
+                return false;
+            }
+
+            match_length += MIN_MATCH_LENGTH;
+
+            if (match_offset == 0u || match_offset > output_offset ||
+                match_length > destination.size() - output_offset)
+            {
+                return false;
+            }
+
+            // Matches can overlap the bytes they produce (for ex. offset 1 repeats the previous byte), in which case
+            // the bytes have to be copied one at a time.
+            const auto *match = destination.data() + output_offset - match_offset;
+            if (match_offset >= match_length)
+            {
+                std::memcpy(destination.data() + output_offset, match, match_length);
+            }
+            else
+            {
+                for (const auto i : std::views::iota(size_t{0u}, match_length))
+                {
+                    destination[output_offset + i] = match[i];
+                }
+            }
+
+            output_offset += match_length;
+        }
+
+        return output_offset == destination.size();
+    }
+} // namespace serenity::core::Lz4
\ No newline at end of file
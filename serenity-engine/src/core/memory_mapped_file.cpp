@@ -0,0 +1,149 @@
+#include "serenity-engine/core/memory_mapped_file.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace serenity::core
+{
+    MemoryMappedFile::MemoryMappedFile(const std::string_view path)
+    {
+        const auto file_path = std::filesystem::path(std::string(path));
+
+#ifdef _WIN32
+        m_file_handle = ::CreateFileW(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                      FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_file_handle == INVALID_HANDLE_VALUE)
+        {
+            Log::instance().warn(std::format("Failed to open file for memory mapping with path : {}", path));
+            return;
+        }
+
+        auto file_size = LARGE_INTEGER{};
+        if (!::GetFileSizeEx(m_file_handle, &file_size) || file_size.QuadPart == 0)
+        {
+            Log::instance().warn(std::format("Failed to get size of (or empty) file with path : {}", path));
+            unmap();
+            return;
+        }
+
+        m_file_mapping_handle = ::CreateFileMappingW(m_file_handle, nullptr, PAGE_READONLY, 0u, 0u, nullptr);
+        if (!m_file_mapping_handle)
+        {
+            Log::instance().warn(std::format("Failed to create file mapping for file with path : {}", path));
+            unmap();
+            return;
+        }
+
+        m_data = static_cast<const std::byte *>(::MapViewOfFile(m_file_mapping_handle, FILE_MAP_READ, 0u, 0u, 0u));
+        m_size = static_cast<size_t>(file_size.QuadPart);
+#else
+        const auto file_descriptor = ::open(file_path.c_str(), O_RDONLY);
+        if (file_descriptor == -1)
+        {
+            Log::instance().warn(std::format("Failed to open file for memory mapping with path : {}", path));
+            return;
+        }
+
+        struct stat file_stat = {};
+        if (::fstat(file_descriptor, &file_stat) != 0 || file_stat.st_size == 0)
+        {
+            Log::instance().warn(std::format("Failed to get size of (or empty) file with path : {}", path));
+            ::close(file_descriptor);
+            return;
+        }
+
+        // The file descriptor can be closed once the mapping is created.
+        auto *mapping =
+            ::mmap(nullptr, static_cast<size_t>(file_stat.st_size), PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        ::close(file_descriptor);
+
+        if (mapping != MAP_FAILED)
+        {
+            m_data = static_cast<const std::byte *>(mapping);
+            m_size = static_cast<size_t>(file_stat.st_size);
+        }
+#endif
+
+        if (!m_data)
+        {
+            Log::instance().warn(std::format("Failed to memory map file with path : {}", path));
+            unmap();
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        unmap();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile &&other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MemoryMappedFile &MemoryMappedFile::operator=(MemoryMappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0u);
+
+#ifdef _WIN32
+            m_file_handle = std::exchange(other.m_file_handle, INVALID_HANDLE_VALUE);
+            m_file_mapping_handle = std::exchange(other.m_file_mapping_handle, nullptr);
+#endif
+        }
+
+        return *this;
+    }
+
+    size_t MemoryMappedFile::get_mapped_size() const
+    {
+#ifdef _WIN32
+        auto system_info = SYSTEM_INFO{};
+        ::GetSystemInfo(&system_info);
+        const auto page_size = static_cast<size_t>(system_info.dwPageSize);
+#else
+        const auto page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+
+        return (m_size + page_size - 1u) / page_size * page_size;
+    }
+
+    void MemoryMappedFile::unmap()
+    {
+#ifdef _WIN32
+        if (m_data)
+        {
+            ::UnmapViewOfFile(m_data);
+        }
+
+        if (m_file_mapping_handle)
+        {
+            ::CloseHandle(m_file_mapping_handle);
+        }
+
+        if (m_file_handle != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(m_file_handle);
+        }
+
+        m_file_handle = INVALID_HANDLE_VALUE;
+        m_file_mapping_handle = nullptr;
+#else
+        if (m_data)
+        {
+            ::munmap(const_cast<std::byte *>(m_data), m_size);
+        }
+#endif
+
+        m_data = nullptr;
+        m_size = 0u;
+    }
+} // namespace serenity::core
\ No newline at end of file
@@ -267,6 +267,38 @@ namespace serenity::editor
                 ImGui::TreePop();
             }
 
+            auto &texture_residency_manager = renderer::Renderer::instance().get_texture_residency_manager();
+
+            if (ImGui::TreeNode("Texture Residency"))
+            {
+                constexpr auto bytes_per_mb = uint64_t{1024u * 1024u};
+
+                ImGui::Text("Resident texture memory : %.2f MB",
+                            static_cast<double>(texture_residency_manager.get_resident_size()) / bytes_per_mb);
+
+                auto budget = static_cast<int>(texture_residency_manager.get_budget() / bytes_per_mb);
+                if (ImGui::SliderInt("Budget (MB)", &budget, 64, 8192))
+                {
+                    texture_residency_manager.set_budget(static_cast<uint64_t>(budget) * bytes_per_mb);
+                }
+
+                auto texture_streaming_enabled = renderer::Renderer::instance().is_texture_streaming_enabled();
+                if (ImGui::Checkbox("Texture Streaming", &texture_streaming_enabled))
+                {
+                    renderer::Renderer::instance().set_texture_streaming_enabled(texture_streaming_enabled);
+                }
+
+                auto max_streamed_size = static_cast<int>(texture_residency_manager.get_max_streamed_size_per_frame() /
+                                                          bytes_per_mb);
+                if (ImGui::SliderInt("Max Streamed Size Per Frame (MB)", &max_streamed_size, 1, 256))
+                {
+                    texture_residency_manager.set_max_streamed_size_per_frame(static_cast<uint64_t>(max_streamed_size) *
+                                                                              bytes_per_mb);
+                }
+
+                ImGui::TreePop();
+            }
+
             ImGui::SetNextItemOpen(true);
             if (const auto &pipelines = renderer::Renderer::instance().get_pipelines(); ImGui::TreeNode("Pipelines"))
             {
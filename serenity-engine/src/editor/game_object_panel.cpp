@@ -57,18 +57,26 @@ namespace serenity::editor
 
                 if (ImGui::TreeNode("Material"))
                 {
-                    for (int i = 0; i < game_object.material_count; i++)
+                    for (size_t i = 0; i < game_object.material_indices.size(); i++)
                     {
                         if (ImGui::TreeNode(std::string("Material "s + std::to_string(i)).c_str()))
                         {
-                            auto &material_buffer_data =
-                                scene.get_scene_resources().material_buffers.at(game_object.material_buffer_offset + i);
+                            // Materials are shared by all game objects that use an identical material, so edits apply
+                            // to all of them.
+                            const auto material_index = game_object.material_indices[i];
+                            auto material_buffer_data = scene.get_scene_resources().material_buffers.at(material_index);
 
-                            ImGui::ColorPicker3("Base Color", &material_buffer_data.base_color.x);
-                            ImGui::SliderFloat("Metallic Factor", &material_buffer_data.metallic_roughness_factor.x,
-                                               0.0f, 1.0f);
-                            ImGui::SliderFloat("Roughness Factor", &material_buffer_data.metallic_roughness_factor.y,
-                                               0.0f, 1.0f);
+                            auto material_modified =
+                                ImGui::ColorPicker3("Base Color", &material_buffer_data.base_color.x);
+                            material_modified |= ImGui::SliderFloat(
+                                "Metallic Factor", &material_buffer_data.metallic_roughness_factor.x, 0.0f, 1.0f);
+                            material_modified |= ImGui::SliderFloat(
+                                "Roughness Factor", &material_buffer_data.metallic_roughness_factor.y, 0.0f, 1.0f);
+
+                            if (material_modified)
+                            {
+                                scene.update_material_buffer(material_index, material_buffer_data);
+                            }
 
                             ImGui::TreePop();
                         }
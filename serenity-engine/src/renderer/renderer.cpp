@@ -8,6 +8,59 @@
 
 namespace serenity::renderer
 {
+    namespace
+    {
+        // Size (in bytes) of the mip levels of the texture, as tracked by the texture residency manager. The most
+        // detailed mip of a block compressed texture must have dimensions that are a multiple of the block size, so
+        // the mip levels from the first one that does not are combined into a single level (which can only be evicted
+        // along with the rest of the texture).
+        std::vector<uint64_t> get_residency_mip_sizes(const rhi::TextureCreationDesc &texture_creation_desc)
+        {
+            const auto is_block_compressed = rhi::get_bytes_per_block(texture_creation_desc.format) != 0u;
+
+            auto mip_sizes = std::vector<uint64_t>{};
+            auto combine_mip_levels = false;
+
+            for (const auto mip_level : std::views::iota(0u, texture_creation_desc.mip_levels))
+            {
+                const auto mip_size =
+                    rhi::get_mip_size_in_bytes(texture_creation_desc, mip_level) * texture_creation_desc.array_size;
+
+                combine_mip_levels = combine_mip_levels ||
+                                     (mip_level != 0u && is_block_compressed &&
+                                      ((std::max(texture_creation_desc.dimension.x >> mip_level, 1u) % 4u) != 0u ||
+                                       (std::max(texture_creation_desc.dimension.y >> mip_level, 1u) % 4u) != 0u));
+
+                if (combine_mip_levels)
+                {
+                    mip_sizes.back() += mip_size;
+                }
+                else
+                {
+                    mip_sizes.push_back(mip_size);
+                }
+            }
+
+            return mip_sizes;
+        }
+
+        // The first mip level whose dimensions are at most TEXTURE_STREAMING_INITIAL_MIP_DIMENSION (but never beyond
+        // the last mip level tracked by the residency manager).
+        uint32_t get_initial_streaming_mip(const rhi::TextureCreationDesc &texture_creation_desc,
+                                           const uint32_t residency_mip_count)
+        {
+            auto mip_level = 0u;
+            while (mip_level + 1u < residency_mip_count &&
+                   std::max(texture_creation_desc.dimension.x, texture_creation_desc.dimension.y) >> mip_level >
+                       Renderer::TEXTURE_STREAMING_INITIAL_MIP_DIMENSION)
+            {
+                ++mip_level;
+            }
+
+            return mip_level;
+        }
+    } // namespace
+
     Renderer::Renderer(window::Window &window) : window_ref(window)
     {
         // Create resources.
@@ -23,6 +76,9 @@ namespace serenity::renderer
 
     Renderer::~Renderer()
     {
+        // Wait for the texture uploads that are still in progress, before their resources are released.
+        m_device->get_copy_command_queue().flush();
+
         core::Log::instance().info("Destroyed renderer");
     }
 
@@ -34,6 +90,8 @@ namespace serenity::renderer
         // Frame start will reset the command list and command allocator associated with the current frame.
         device.frame_start();
 
+        update_texture_residency();
+
         auto &command_list = device.get_current_frame_direct_command_list();
         auto &back_buffer = swapchain.get_current_back_buffer();
 
@@ -140,6 +198,8 @@ namespace serenity::renderer
         device.frame_end();
 
         reload_pipelines();
+
+        ++m_frame_number;
     }
 
     void Renderer::update_renderpasses(const uint32_t frame_count)
@@ -159,6 +219,73 @@ namespace serenity::renderer
             .update(reinterpret_cast<const std::byte *>(&m_post_processing_renderpass->get_post_process_buffer()), sizeof(interop::PostProcessBuffer));
     }
 
+    uint32_t Renderer::create_texture(const rhi::TextureCreationDesc &texture_creation_desc, const std::byte *data,
+                                      TextureDataSource texture_data_source)
+    {
+        const auto index = static_cast<uint32_t>(m_allocated_textures.size());
+
+        // All textures count towards the texture memory budget, but only textures with a data source can be evicted.
+        const auto evictable = texture_data_source != nullptr &&
+                               texture_creation_desc.usage == rhi::TextureUsage::ShaderResourceTexture &&
+                               texture_creation_desc.array_size == 1u;
+
+        const auto mip_sizes = get_residency_mip_sizes(texture_creation_desc);
+
+        // Streamed textures only have their smallest mip levels resident at first, so that they are usable as soon as
+        // possible. The more detailed mip levels are streamed in by update_texture_residency.
+        const auto most_detailed_mip =
+            evictable && m_texture_streaming_enabled && data != nullptr
+                ? get_initial_streaming_mip(texture_creation_desc, static_cast<uint32_t>(mip_sizes.size()))
+                : 0u;
+
+        if (most_detailed_mip != 0u)
+        {
+            auto texture = m_device->create_texture(
+                rhi::get_resident_texture_creation_desc(texture_creation_desc, most_detailed_mip),
+                data + rhi::get_mip_offset_in_bytes(texture_creation_desc, most_detailed_mip));
+
+            m_allocated_textures.emplace_back(std::move(texture));
+        }
+        else
+        {
+            m_allocated_textures.emplace_back(m_device->create_texture(texture_creation_desc, data));
+        }
+
+        m_texture_residency_manager.add_texture(index, mip_sizes, evictable, m_frame_number, most_detailed_mip);
+
+        if (evictable)
+        {
+            m_evictable_textures[index] = EvictableTexture{
+                .texture_creation_desc = texture_creation_desc,
+                .texture_data_source = std::move(texture_data_source),
+                .residency_mip_count = static_cast<uint32_t>(mip_sizes.size()),
+            };
+        }
+
+        return index;
+    }
+
+    void Renderer::mark_texture_as_used(const uint32_t index, const float required_resolution)
+    {
+        // The desired mip is the least detailed mip level that still has the required resolution (the residency
+        // manager clamps it to the mip count).
+        auto desired_mip = 0u;
+
+        if (const auto itr = m_evictable_textures.find(index);
+            m_texture_streaming_enabled && itr != m_evictable_textures.end())
+        {
+            const auto &dimension = itr->second.texture_creation_desc.dimension;
+            const auto resolution = static_cast<float>(std::max(dimension.x, dimension.y));
+
+            if (resolution > required_resolution)
+            {
+                desired_mip = static_cast<uint32_t>(std::log2(resolution / std::max(required_resolution, 1.0f)));
+            }
+        }
+
+        m_texture_residency_manager.mark_texture_as_used(index, m_frame_number, desired_mip);
+    }
+
     void Renderer::create_resources()
     {
         // Create command signature.
@@ -227,4 +354,66 @@ namespace serenity::renderer
 
         m_pipeline_reload_buffer.clear();
     }
+
+    void Renderer::update_texture_residency()
+    {
+        // Swap in the resources of the uploads that have completed since the last frame.
+        std::erase_if(m_pending_texture_uploads, [&](auto &pending_texture_upload) {
+            auto &[texture_index, texture_upload] = pending_texture_upload;
+            if (!m_device->is_texture_upload_complete(texture_upload))
+            {
+                return false;
+            }
+
+            m_device->complete_texture_upload(m_allocated_textures.at(texture_index), texture_upload);
+            return true;
+        });
+
+        const auto residency_changes = m_texture_residency_manager.update(m_frame_number);
+
+        for (const auto &residency_change : residency_changes)
+        {
+            const auto &evictable_texture = m_evictable_textures.at(residency_change.texture_index);
+            const auto &texture_creation_desc = evictable_texture.texture_creation_desc;
+
+            auto &texture = m_allocated_textures.at(residency_change.texture_index);
+
+            // An upload that is still in progress is superseded by the new change.
+            if (const auto itr = m_pending_texture_uploads.find(residency_change.texture_index);
+                itr != m_pending_texture_uploads.end())
+            {
+                m_device->release_texture_upload(itr->second);
+                m_pending_texture_uploads.erase(itr);
+            }
+
+            if (residency_change.most_detailed_mip == evictable_texture.residency_mip_count)
+            {
+                m_device->evict_texture(texture, texture_creation_desc);
+                continue;
+            }
+
+            // If the data is no longer available (for ex. if the model the texture belongs to has been unloaded), the
+            // texture is evicted entirely and no longer tracked.
+            const auto data = evictable_texture.texture_data_source();
+            if (data == nullptr)
+            {
+                core::Log::instance().warn(
+                    std::format("Data of texture {} is no longer available, evicting texture",
+                                wstring_to_string(texture_creation_desc.name)));
+
+                m_device->evict_texture(texture, texture_creation_desc);
+
+                m_texture_residency_manager.remove_texture(residency_change.texture_index);
+                m_evictable_textures.erase(residency_change.texture_index);
+
+                continue;
+            }
+
+            // The texture keeps its current mip levels until the upload has completed.
+            m_pending_texture_uploads.emplace(
+                residency_change.texture_index,
+                m_device->upload_texture_resident_mips(texture_creation_desc, residency_change.most_detailed_mip,
+                                                       data.get()));
+        }
+    }
 } // namespace serenity::renderer
\ No newline at end of file
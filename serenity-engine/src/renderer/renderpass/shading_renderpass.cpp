@@ -60,12 +60,24 @@ namespace serenity::renderer::renderpass
 
         const auto scene_rsc = current_scene.get_scene_resources();
 
-        command_list.set_index_buffer(get_buffer_at_index(scene_rsc.index_buffer_index));
+        // The float / quantized vertex buffers are only created if the scene has meshes that use them.
+        const auto get_srv_index = [&](const uint32_t index, const bool is_created) {
+            return is_created ? get_buffer_at_index(index).srv_index : INVALID_INDEX_U32;
+        };
+
+        const auto has_vertices = !scene_rsc.positions.empty();
+        const auto has_quantized_vertices = !scene_rsc.quantized_positions.empty();
 
         const auto render_resources = interop::PBRShadingRenderResources{
-            .position_buffer_srv_index = get_buffer_at_index(scene_rsc.position_buffer_index).srv_index,
-            .normal_buffer_srv_index = get_buffer_at_index(scene_rsc.normal_buffer_index).srv_index,
-            .texture_coord_buffer_srv_index = get_buffer_at_index(scene_rsc.texture_coord_buffer_index).srv_index,
+            .position_buffer_srv_index = get_srv_index(scene_rsc.position_buffer_index, has_vertices),
+            .normal_buffer_srv_index = get_srv_index(scene_rsc.normal_buffer_index, has_vertices),
+            .texture_coord_buffer_srv_index = get_srv_index(scene_rsc.texture_coord_buffer_index, has_vertices),
+            .quantized_position_buffer_srv_index =
+                get_srv_index(scene_rsc.quantized_position_buffer_index, has_quantized_vertices),
+            .quantized_normal_buffer_srv_index =
+                get_srv_index(scene_rsc.quantized_normal_buffer_index, has_quantized_vertices),
+            .quantized_texture_coord_buffer_srv_index =
+                get_srv_index(scene_rsc.quantized_texture_coord_buffer_index, has_quantized_vertices),
             .game_object_srv_index = get_buffer_at_index(scene_rsc.game_object_buffer_index).srv_index,
             .mesh_buffer_srv_index = get_buffer_at_index(scene_rsc.meshes_buffer_index).srv_index,
             .scene_buffer_cbv_index = get_buffer_at_index(scene_rsc.scene_buffer_index).cbv_index,
@@ -75,22 +87,50 @@ namespace serenity::renderer::renderpass
             .atmosphere_texture_srv_index = atmosphere_texture_srv_index,
         };
 
+        // The commands of meshes with 16 bit indices come first, followed by the commands of meshes with 32 bit
+        // indices, as the index buffer can only be switched between the two execute indirect calls.
         auto indirect_commands = std::vector<rhi::IndirectCommandArgs>{};
+        auto index_32_command_offset = size_t{0u};
 
-        for (const auto &mesh : scene_rsc.mesh_buffers)
+        for (const auto index_format : {asset::IndexFormat::Uint16, asset::IndexFormat::Uint32})
         {
-            indirect_commands.emplace_back(rhi::IndirectCommandArgs{
-                .mesh_id = mesh.mesh_index,
-                .draw_arguments =
+            index_32_command_offset = indirect_commands.size();
+
+            for (const auto &mesh : scene_rsc.mesh_buffers)
+            {
+                if (mesh.index_format != static_cast<uint32_t>(index_format))
+                {
+                    continue;
+                }
+
+                // Use the level of detail selected by the scene (if any).
+                auto indices_offset = mesh.indices_offset;
+                auto indices_count = mesh.indices_count;
+
+                if (mesh.mesh_index < scene_rsc.selected_mesh_lods.size())
+                {
+                    if (const auto selected_lod = scene_rsc.selected_mesh_lods[mesh.mesh_index]; selected_lod != 0u)
                     {
-                        .IndexCountPerInstance = mesh.indices_count,
-                        .InstanceCount = 1u,
-                        .StartIndexLocation = mesh.indices_offset,
-                        .BaseVertexLocation = 0u,
-                        .StartInstanceLocation = 0u,
-                    },
-            });
-        };
+                        const auto &lod = scene_rsc.mesh_lods[mesh.lod_offset + selected_lod - 1u];
+
+                        indices_offset = lod.indices_offset;
+                        indices_count = lod.indices_count;
+                    }
+                }
+
+                indirect_commands.emplace_back(rhi::IndirectCommandArgs{
+                    .mesh_id = mesh.mesh_index,
+                    .draw_arguments =
+                        {
+                            .IndexCountPerInstance = indices_count,
+                            .InstanceCount = 1u,
+                            .StartIndexLocation = indices_offset,
+                            .BaseVertexLocation = 0u,
+                            .StartInstanceLocation = 0u,
+                        },
+                });
+            }
+        }
 
         command_list.set_graphics_32_bit_root_constants(reinterpret_cast<const std::byte *>(&render_resources));
 
@@ -99,7 +139,21 @@ namespace serenity::renderer::renderpass
             .update(reinterpret_cast<const std::byte *>(indirect_commands.data()),
                     sizeof(rhi::IndirectCommandArgs) * indirect_commands.size());
 
-        command_list.execute_indirect(command_signature, get_buffer_at_index(command_buffer_index),
-                                      static_cast<uint32_t>(indirect_commands.size()));
+        const auto command_buffer = get_buffer_at_index(command_buffer_index);
+
+        if (index_32_command_offset != 0u)
+        {
+            command_list.set_index_buffer(get_buffer_at_index(scene_rsc.index_buffer_index), DXGI_FORMAT_R16_UINT);
+            command_list.execute_indirect(command_signature, command_buffer,
+                                          static_cast<uint32_t>(index_32_command_offset));
+        }
+
+        if (index_32_command_offset != indirect_commands.size())
+        {
+            command_list.set_index_buffer(get_buffer_at_index(scene_rsc.index_32_buffer_index), DXGI_FORMAT_R32_UINT);
+            command_list.execute_indirect(command_signature, command_buffer,
+                                          static_cast<uint32_t>(indirect_commands.size() - index_32_command_offset),
+                                          sizeof(rhi::IndirectCommandArgs) * index_32_command_offset);
+        }
     }
 } // namespace serenity::renderer::renderpass
\ No newline at end of file
@@ -103,12 +103,12 @@ namespace serenity::renderer::rhi
         m_command_list->IASetPrimitiveTopology(primitive_topology);
     }
 
-    void CommandList::set_index_buffer(const Buffer &buffer) const
+    void CommandList::set_index_buffer(const Buffer &buffer, const DXGI_FORMAT format) const
     {
         const auto index_buffer_view = D3D12_INDEX_BUFFER_VIEW{
             .BufferLocation = buffer.resource.Get()->GetGPUVirtualAddress(),
             .SizeInBytes = static_cast<uint32_t>(buffer.size_in_bytes),
-            .Format = DXGI_FORMAT_R16_UINT,
+            .Format = format,
         };
 
         m_command_list->IASetIndexBuffer(&index_buffer_view);
@@ -162,9 +162,9 @@ namespace serenity::renderer::rhi
     }
 
     void CommandList::execute_indirect(rhi::CommandSignature &command_signature, const Buffer &indirect_argument_buffer,
-                                       const uint32_t command_count) const
+                                       const uint32_t command_count, const uint64_t argument_buffer_offset) const
     {
         m_command_list->ExecuteIndirect(command_signature.m_command_signature.Get(), command_count,
-                                        indirect_argument_buffer.resource.Get(), 0u, nullptr, 0u);
+                                        indirect_argument_buffer.resource.Get(), argument_buffer_offset, nullptr, 0u);
     }
 } // namespace serenity::renderer::rhi
\ No newline at end of file
@@ -50,6 +50,11 @@ namespace serenity::renderer::rhi
         }
     }
 
+    uint64_t CommandQueue::get_completed_value() const
+    {
+        return m_fence->GetCompletedValue();
+    }
+
     uint64_t CommandQueue::flush()
     {
         signal();
@@ -78,4 +78,25 @@ namespace serenity::renderer::rhi
     {
         m_current_descriptor_handle.offset(offset);
     }
+
+    DescriptorHandle DescriptorHeap::allocate_descriptor()
+    {
+        if (!m_free_descriptor_indices.empty())
+        {
+            const auto index = m_free_descriptor_indices.back();
+            m_free_descriptor_indices.pop_back();
+
+            return get_handle_at_index(index);
+        }
+
+        const auto descriptor_handle = m_current_descriptor_handle;
+        offset_current_handle();
+
+        return descriptor_handle;
+    }
+
+    void DescriptorHeap::free_descriptor(const uint32_t index)
+    {
+        m_free_descriptor_indices.push_back(index);
+    }
 } // namespace serenity::renderer::rhi
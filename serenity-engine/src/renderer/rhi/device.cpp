@@ -110,11 +110,233 @@ namespace serenity::renderer::rhi
         // Wait for the previous frame (i.e the new m_current_swapchain_backbuffer_index's previous command's) to finish
         // execution.
         m_direct_command_queue->wait_for_fence_value(m_frame_fence_values.at(m_current_swapchain_backbuffer_index));
+
+        ++m_frame_number;
+        process_deferred_releases();
     }
 
     Texture Device::create_texture(const TextureCreationDesc &texture_creation_desc, const std::byte *data)
     {
         auto texture = Texture{};
+        texture.resource = create_texture_resource(texture_creation_desc, data);
+
+        // Create descriptors based on texture usage.
+        if (texture_creation_desc.usage == TextureUsage::DepthStencilTexture)
+        {
+            // Create the depth stencil view.
+            auto current_dsv_descriptor = m_dsv_descriptor_heap->get_current_handle();
+            const auto dsv_desc = D3D12_DEPTH_STENCIL_VIEW_DESC{
+                .Format = texture_creation_desc.format,
+                .ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D,
+                .Texture2D =
+                    {
+                        .MipSlice = 0u,
+                    },
+            };
+
+            m_device->CreateDepthStencilView(texture.resource.Get(), &dsv_desc,
+                                             current_dsv_descriptor.cpu_descriptor_handle);
+            texture.dsv_index = current_dsv_descriptor.index;
+
+            m_dsv_descriptor_heap->offset_current_handle();
+        }
+
+        // SRV is created for render textures and UAV's as well.
+        if (texture_creation_desc.usage == TextureUsage::ShaderResourceTexture ||
+            texture_creation_desc.usage == TextureUsage::RenderTexture ||
+            texture_creation_desc.usage == TextureUsage::UAVTexture)
+        {
+            // Create the shader resource view.
+            const auto srv_descriptor = m_cbv_srv_uav_descriptor_heap->allocate_descriptor();
+            create_shader_resource_view(texture.resource.Get(), texture_creation_desc,
+                                        srv_descriptor.cpu_descriptor_handle);
+
+            texture.srv_index = srv_descriptor.index;
+        }
+
+        if (texture_creation_desc.usage == TextureUsage::RenderTexture)
+        {
+            // Create the render target view.
+            auto current_rtv_descriptor = m_rtv_descriptor_heap->get_current_handle();
+
+            const auto rtv_desc = D3D12_RENDER_TARGET_VIEW_DESC{
+                .Format = texture_creation_desc.format,
+                .ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D,
+                .Texture2D{
+                    .MipSlice = 0u,
+                    .PlaneSlice = 0u,
+                },
+            };
+
+            m_device->CreateRenderTargetView(texture.resource.Get(), &rtv_desc,
+                                             current_rtv_descriptor.cpu_descriptor_handle);
+            texture.rtv_index = current_rtv_descriptor.index;
+
+            m_rtv_descriptor_heap->offset_current_handle();
+        }
+
+        if (texture_creation_desc.usage == TextureUsage::UAVTexture)
+        {
+            // Create the unordered access view.
+            auto current_uav_descriptor = m_cbv_srv_uav_descriptor_heap->get_current_handle();
+
+            if (texture_creation_desc.array_size == 1u)
+            {
+                const auto uav_desc = D3D12_UNORDERED_ACCESS_VIEW_DESC{
+                    .Format = texture_creation_desc.format,
+                    .ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D,
+                    .Texture2D{
+                        .MipSlice = 0u,
+                        .PlaneSlice = 0u,
+                    },
+                };
+                m_device->CreateUnorderedAccessView(texture.resource.Get(), nullptr, &uav_desc,
+                                                    current_uav_descriptor.cpu_descriptor_handle);
+
+                texture.uav_index = current_uav_descriptor.index;
+
+                m_cbv_srv_uav_descriptor_heap->offset_current_handle();
+            }
+
+            else if (texture_creation_desc.array_size == 6u)
+            {
+                const auto uav_desc = D3D12_UNORDERED_ACCESS_VIEW_DESC{
+                    .Format = texture_creation_desc.format,
+                    .ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2DARRAY,
+                    .Texture2DArray{
+                        .MipSlice = 0u,
+                        .FirstArraySlice = 0u,
+                        .ArraySize = 6u,
+                    },
+                };
+                m_device->CreateUnorderedAccessView(texture.resource.Get(), nullptr, &uav_desc,
+                                                    current_uav_descriptor.cpu_descriptor_handle);
+
+                texture.uav_index = current_uav_descriptor.index;
+
+                m_cbv_srv_uav_descriptor_heap->offset_current_handle();
+            }
+        }
+
+        set_name(texture.resource.Get(), texture_creation_desc.name);
+
+        return texture;
+    }
+
+    void Device::evict_texture(Texture &texture, const TextureCreationDesc &texture_creation_desc)
+    {
+        validate_evictable_texture(texture_creation_desc);
+
+        // Reads from a null descriptor return zero.
+        replace_texture_resource(texture, nullptr, texture_creation_desc);
+    }
+
+    TextureUpload Device::upload_texture_resident_mips(const TextureCreationDesc &texture_creation_desc,
+                                                       const uint32_t most_detailed_mip, const std::byte *data)
+    {
+        validate_evictable_texture(texture_creation_desc);
+
+        auto texture_upload = TextureUpload{
+            .texture_creation_desc = get_resident_texture_creation_desc(texture_creation_desc, most_detailed_mip),
+        };
+
+        texture_upload.resource = create_texture_resource(texture_upload.texture_creation_desc, nullptr);
+        set_name(texture_upload.resource.Get(), texture_creation_desc.name);
+
+        // Reuse a command list whose previous upload has completed.
+        const auto completed_fence_value = m_copy_command_queue->get_completed_value();
+
+        auto upload_command_list = std::ranges::find_if(m_upload_command_lists, [&](const auto &command_list) {
+            return command_list.fence_value <= completed_fence_value;
+        });
+
+        if (upload_command_list == m_upload_command_lists.end())
+        {
+            upload_command_list = m_upload_command_lists.insert(
+                m_upload_command_lists.end(),
+                UploadCommandList{
+                    .command_list = std::make_unique<CommandList>(m_device.Get(), D3D12_COMMAND_LIST_TYPE_COPY),
+                });
+        }
+
+        auto &command_list = *upload_command_list->command_list;
+        command_list.reset();
+
+        const auto data_offset = get_mip_offset_in_bytes(texture_creation_desc, most_detailed_mip);
+        texture_upload.upload_buffer = record_texture_upload(command_list, texture_upload.resource.Get(),
+                                                             texture_upload.texture_creation_desc, data + data_offset);
+
+        const auto command_list_for_execution = std::array{
+            &command_list,
+        };
+
+        m_copy_command_queue->execute(command_list_for_execution);
+
+        texture_upload.fence_value = m_copy_command_queue->signal();
+        upload_command_list->fence_value = texture_upload.fence_value;
+
+        return texture_upload;
+    }
+
+    bool Device::is_texture_upload_complete(const TextureUpload &texture_upload) const
+    {
+        return m_copy_command_queue->get_completed_value() >= texture_upload.fence_value;
+    }
+
+    void Device::complete_texture_upload(Texture &texture, TextureUpload &texture_upload)
+    {
+        // The copy has completed, so the upload buffer is no longer in use.
+        texture_upload.upload_buffer.Reset();
+
+        replace_texture_resource(texture, std::move(texture_upload.resource), texture_upload.texture_creation_desc);
+    }
+
+    void Device::release_texture_upload(TextureUpload &texture_upload)
+    {
+        // The resources were never used by the direct queue, but the copy might still be in progress.
+        m_deferred_releases.push_back(DeferredRelease{
+            .resource = std::move(texture_upload.resource),
+            .frame_number = m_frame_number,
+            .copy_fence_value = texture_upload.fence_value,
+        });
+
+        m_deferred_releases.push_back(DeferredRelease{
+            .resource = std::move(texture_upload.upload_buffer),
+            .frame_number = m_frame_number,
+            .copy_fence_value = texture_upload.fence_value,
+        });
+    }
+
+    void Device::validate_evictable_texture(const TextureCreationDesc &texture_creation_desc) const
+    {
+        if (texture_creation_desc.usage != TextureUsage::ShaderResourceTexture ||
+            texture_creation_desc.array_size != 1u)
+        {
+            core::Log::instance().critical(
+                std::format("Mip levels can only be evicted for (non array) shader resource textures (texture {})",
+                            wstring_to_string(texture_creation_desc.name)));
+        }
+    }
+
+    void Device::replace_texture_resource(Texture &texture, comptr<ID3D12Resource> resource,
+                                          const TextureCreationDesc &texture_creation_desc)
+    {
+        // Frames that are still in flight can use the previous resource and SRV, so both are released after
+        // FRAMES_IN_FLIGHT frames and the texture gets a new SRV.
+        release_resource(std::move(texture.resource), std::array{texture.srv_index});
+
+        const auto srv_descriptor = m_cbv_srv_uav_descriptor_heap->allocate_descriptor();
+        texture.srv_index = srv_descriptor.index;
+
+        texture.resource = std::move(resource);
+        create_shader_resource_view(texture.resource.Get(), texture_creation_desc,
+                                    srv_descriptor.cpu_descriptor_handle);
+    }
+
+    comptr<ID3D12Resource> Device::create_texture_resource(const TextureCreationDesc &texture_creation_desc,
+                                                           const std::byte *data)
+    {
+        auto resource = comptr<ID3D12Resource>{};
 
         // If the texture's data is not nullptr, then a upload buffer must be created to upload the data from cpu -> cpu
         // / gpu accesible memory, and finally copied into gpu only memory. This willl be the case for most textures.
@@ -175,7 +397,7 @@ namespace serenity::renderer::rhi
 
             throw_if_failed(m_device->CreateCommittedResource(&default_heap_properties, D3D12_HEAP_FLAG_NONE,
                                                               &texture_resource_desc, D3D12_RESOURCE_STATE_DEPTH_WRITE,
-                                                              &depth_clear_color, IID_PPV_ARGS(&texture.resource)));
+                                                              &depth_clear_color, IID_PPV_ARGS(&resource)));
         }
         else if (texture_creation_desc.usage == TextureUsage::RenderTexture)
         {
@@ -187,51 +409,30 @@ namespace serenity::renderer::rhi
             throw_if_failed(
                 m_device->CreateCommittedResource(&default_heap_properties, D3D12_HEAP_FLAG_NONE,
                                                   &texture_resource_desc, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-                                                  &render_target_clear_color, IID_PPV_ARGS(&texture.resource)));
+                                                  &render_target_clear_color, IID_PPV_ARGS(&resource)));
         }
         else if (texture_creation_desc.usage == TextureUsage::UAVTexture)
         {
             throw_if_failed(m_device->CreateCommittedResource(
                 &default_heap_properties, D3D12_HEAP_FLAG_NONE, &texture_resource_desc,
-                D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, nullptr, IID_PPV_ARGS(&texture.resource)));
+                D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, nullptr, IID_PPV_ARGS(&resource)));
         }
         else
         {
             throw_if_failed(m_device->CreateCommittedResource(&default_heap_properties, D3D12_HEAP_FLAG_NONE,
                                                               &texture_resource_desc, D3D12_RESOURCE_STATE_COPY_DEST,
-                                                              nullptr, IID_PPV_ARGS(&texture.resource)));
+                                                              nullptr, IID_PPV_ARGS(&resource)));
         }
 
         // If data is to be filled with some initial data, create a CPU / GPU accessible heap - resource and upload the
         // data.
         if (data)
         {
-            // Here, we need to create another texture so as to copy data from CPU / GPU shareable memory to GPU only
-            // memory.
-
-            const auto size = texture_creation_desc.dimension.x * texture_creation_desc.dimension.y *
-                              texture_creation_desc.bytes_per_pixel;
-
-            const auto upload_buffer_resource_desc = CD3DX12_RESOURCE_DESC::Buffer(size);
-
-            const auto upload_heap_properties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-            auto upload_buffer = comptr<ID3D12Resource>{};
-
-            throw_if_failed(m_device->CreateCommittedResource(&upload_heap_properties, D3D12_HEAP_FLAG_NONE,
-                                                              &upload_buffer_resource_desc, D3D12_RESOURCE_STATE_COMMON,
-                                                              nullptr, IID_PPV_ARGS(&upload_buffer)));
-
-            // Copy data from CPU to GPU.
-            const auto subresource_data = D3D12_SUBRESOURCE_DATA{
-                .pData = data,
-                .RowPitch =
-                    static_cast<LONG_PTR>(texture_creation_desc.bytes_per_pixel * texture_creation_desc.dimension.x),
-                .SlicePitch = size,
-            };
-
             m_copy_command_list->reset();
-            UpdateSubresources(m_copy_command_list->get_command_list().Get(), texture.resource.Get(),
-                               upload_buffer.Get(), 0u, 0u, 1u, &subresource_data);
+
+            // The upload buffer has to be kept alive until the copy has completed.
+            const auto upload_buffer =
+                record_texture_upload(*m_copy_command_list, resource.Get(), texture_creation_desc, data);
 
             const auto command_list_for_execution = std::array{
                 m_copy_command_list.get(),
@@ -241,138 +442,98 @@ namespace serenity::renderer::rhi
             m_copy_command_queue->flush();
         }
 
-        // Create descriptors based on texture usage.
-        if (texture_creation_desc.usage == TextureUsage::DepthStencilTexture)
-        {
-            // Create the depth stencil view.
-            auto current_dsv_descriptor = m_dsv_descriptor_heap->get_current_handle();
-            const auto dsv_desc = D3D12_DEPTH_STENCIL_VIEW_DESC{
-                .Format = texture_creation_desc.format,
-                .ViewDimension = D3D12_DSV_DIMENSION_TEXTURE2D,
-                .Texture2D =
-                    {
-                        .MipSlice = 0u,
-                    },
-            };
+        return resource;
+    }
 
-            m_device->CreateDepthStencilView(texture.resource.Get(), &dsv_desc,
-                                             current_dsv_descriptor.cpu_descriptor_handle);
-            texture.dsv_index = current_dsv_descriptor.index;
+    comptr<ID3D12Resource> Device::record_texture_upload(CommandList &command_list, ID3D12Resource *resource,
+                                                         const TextureCreationDesc &texture_creation_desc,
+                                                         const std::byte *data)
+    {
+        // Here, we need to create another texture so as to copy data from CPU / GPU shareable memory to GPU only
+        // memory.
 
-            m_dsv_descriptor_heap->offset_current_handle();
-        }
+        // For non array textures, data contains all mip levels tightly packed one after the other (the dimension
+        // of mip level i being max(dimension >> i, 1)). For array textures, only the first subresource is uploaded.
+        const auto subresource_count = texture_creation_desc.array_size == 1u ? texture_creation_desc.mip_levels : 1u;
 
-        // SRV is created for render textures and UAV's as well.
-        if (texture_creation_desc.usage == TextureUsage::ShaderResourceTexture ||
-            texture_creation_desc.usage == TextureUsage::RenderTexture ||
-            texture_creation_desc.usage == TextureUsage::UAVTexture)
+        auto subresource_data = std::vector<D3D12_SUBRESOURCE_DATA>{};
+        subresource_data.reserve(subresource_count);
+
+        // For block compressed formats, a row is a row of 4x4 blocks.
+        const auto bytes_per_block = get_bytes_per_block(texture_creation_desc.format);
+
+        auto subresource_offset = size_t{0u};
+        for (const auto mip_level : std::views::iota(0u, subresource_count))
         {
-            // Create the shader resource view.
-            auto current_srv_descriptor = m_cbv_srv_uav_descriptor_heap->get_current_handle();
+            auto width = std::max(texture_creation_desc.dimension.x >> mip_level, 1u);
+            auto height = std::max(texture_creation_desc.dimension.y >> mip_level, 1u);
 
-            if (texture_creation_desc.array_size == 1u)
+            if (bytes_per_block != 0u)
             {
-                const auto srv_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
-                    .Format = texture_creation_desc.format,
-                    .ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
-                    .Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
-                    .Texture2D{
-                        .MostDetailedMip = 0u,
-                        .MipLevels = texture_creation_desc.mip_levels,
-                    },
-                };
-
-                m_device->CreateShaderResourceView(texture.resource.Get(), &srv_desc,
-                                                   current_srv_descriptor.cpu_descriptor_handle);
+                width = (width + 3u) / 4u;
+                height = (height + 3u) / 4u;
             }
-            else if (texture_creation_desc.array_size == 6u)
-            {
-                const auto srv_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
-                    .Format = texture_creation_desc.format,
-                    .ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE,
-                    .Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
-                    .TextureCube{
-                        .MostDetailedMip = 0u,
-                        .MipLevels = texture_creation_desc.mip_levels,
-                    },
-                };
 
-                m_device->CreateShaderResourceView(texture.resource.Get(), &srv_desc,
-                                                   current_srv_descriptor.cpu_descriptor_handle);
-            }
+            const auto row_pitch = static_cast<size_t>(width) *
+                                   (bytes_per_block != 0u ? bytes_per_block : texture_creation_desc.bytes_per_pixel);
 
-            texture.srv_index = current_srv_descriptor.index;
+            subresource_data.push_back(D3D12_SUBRESOURCE_DATA{
+                .pData = data + subresource_offset,
+                .RowPitch = static_cast<LONG_PTR>(row_pitch),
+                .SlicePitch = static_cast<LONG_PTR>(row_pitch * height),
+            });
 
-            m_cbv_srv_uav_descriptor_heap->offset_current_handle();
+            subresource_offset += row_pitch * height;
         }
 
-        if (texture_creation_desc.usage == TextureUsage::RenderTexture)
-        {
-            // Create the render target view.
-            auto current_rtv_descriptor = m_rtv_descriptor_heap->get_current_handle();
+        const auto upload_buffer_resource_desc =
+            CD3DX12_RESOURCE_DESC::Buffer(GetRequiredIntermediateSize(resource, 0u, subresource_count));
 
-            const auto rtv_desc = D3D12_RENDER_TARGET_VIEW_DESC{
+        const auto upload_heap_properties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+        auto upload_buffer = comptr<ID3D12Resource>{};
+
+        throw_if_failed(m_device->CreateCommittedResource(&upload_heap_properties, D3D12_HEAP_FLAG_NONE,
+                                                          &upload_buffer_resource_desc, D3D12_RESOURCE_STATE_COMMON,
+                                                          nullptr, IID_PPV_ARGS(&upload_buffer)));
+
+        // Copy data from CPU to GPU (the data is copied into the upload buffer right away).
+        UpdateSubresources(command_list.get_command_list().Get(), resource, upload_buffer.Get(), 0u, 0u,
+                           subresource_count, subresource_data.data());
+
+        return upload_buffer;
+    }
+
+    void Device::create_shader_resource_view(ID3D12Resource *resource, const TextureCreationDesc &texture_creation_desc,
+                                             const D3D12_CPU_DESCRIPTOR_HANDLE descriptor_handle)
+    {
+        if (texture_creation_desc.array_size == 1u)
+        {
+            const auto srv_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
                 .Format = texture_creation_desc.format,
-                .ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D,
+                .ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D,
+                .Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
                 .Texture2D{
-                    .MipSlice = 0u,
-                    .PlaneSlice = 0u,
+                    .MostDetailedMip = 0u,
+                    .MipLevels = texture_creation_desc.mip_levels,
                 },
             };
 
-            m_device->CreateRenderTargetView(texture.resource.Get(), &rtv_desc,
-                                             current_rtv_descriptor.cpu_descriptor_handle);
-            texture.rtv_index = current_rtv_descriptor.index;
-
-            m_rtv_descriptor_heap->offset_current_handle();
+            m_device->CreateShaderResourceView(resource, &srv_desc, descriptor_handle);
         }
-
-        if (texture_creation_desc.usage == TextureUsage::UAVTexture)
+        else if (texture_creation_desc.array_size == 6u)
         {
-            // Create the unordered access view.
-            auto current_uav_descriptor = m_cbv_srv_uav_descriptor_heap->get_current_handle();
-
-            if (texture_creation_desc.array_size == 1u)
-            {
-                const auto uav_desc = D3D12_UNORDERED_ACCESS_VIEW_DESC{
-                    .Format = texture_creation_desc.format,
-                    .ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D,
-                    .Texture2D{
-                        .MipSlice = 0u,
-                        .PlaneSlice = 0u,
-                    },
-                };
-                m_device->CreateUnorderedAccessView(texture.resource.Get(), nullptr, &uav_desc,
-                                                    current_uav_descriptor.cpu_descriptor_handle);
-
-                texture.uav_index = current_uav_descriptor.index;
-
-                m_cbv_srv_uav_descriptor_heap->offset_current_handle();
-            }
-
-            else if (texture_creation_desc.array_size == 6u)
-            {
-                const auto uav_desc = D3D12_UNORDERED_ACCESS_VIEW_DESC{
-                    .Format = texture_creation_desc.format,
-                    .ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2DARRAY,
-                    .Texture2DArray{
-                        .MipSlice = 0u,
-                        .FirstArraySlice = 0u,
-                        .ArraySize = 6u,
-                    },
-                };
-                m_device->CreateUnorderedAccessView(texture.resource.Get(), nullptr, &uav_desc,
-                                                    current_uav_descriptor.cpu_descriptor_handle);
-
-                texture.uav_index = current_uav_descriptor.index;
+            const auto srv_desc = D3D12_SHADER_RESOURCE_VIEW_DESC{
+                .Format = texture_creation_desc.format,
+                .ViewDimension = D3D12_SRV_DIMENSION_TEXTURECUBE,
+                .Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING,
+                .TextureCube{
+                    .MostDetailedMip = 0u,
+                    .MipLevels = texture_creation_desc.mip_levels,
+                },
+            };
 
-                m_cbv_srv_uav_descriptor_heap->offset_current_handle();
-            }
+            m_device->CreateShaderResourceView(resource, &srv_desc, descriptor_handle);
         }
-
-        set_name(texture.resource.Get(), texture_creation_desc.name);
-
-        return texture;
     }
 
     Pipeline Device::create_pipeline(const PipelineCreationDesc &pipeline_creation_desc,
@@ -488,4 +649,52 @@ namespace serenity::renderer::rhi
 
         return pipeline;
     }
+
+    void Device::release_resource(comptr<ID3D12Resource> resource, const std::span<const uint32_t> descriptor_indices)
+    {
+        m_deferred_releases.push_back(DeferredRelease{
+            .resource = std::move(resource),
+            .descriptor_indices = {descriptor_indices.begin(), descriptor_indices.end()},
+            .frame_number = m_frame_number,
+        });
+    }
+
+    void Device::release_buffer(Buffer &buffer)
+    {
+        // Only structured buffers (srv) and constant buffers (cbv) have descriptors (see create_buffer).
+        auto descriptor_indices = std::vector<uint32_t>{};
+        if (buffer.usage == BufferUsage::StructuredBuffer || buffer.usage == BufferUsage::DynamicStructuredBuffer)
+        {
+            descriptor_indices.push_back(buffer.srv_index);
+        }
+        else if (buffer.usage == BufferUsage::ConstantBuffer)
+        {
+            descriptor_indices.push_back(buffer.cbv_index);
+        }
+
+        release_resource(std::move(buffer.resource), descriptor_indices);
+        buffer = Buffer{};
+    }
+
+    void Device::process_deferred_releases()
+    {
+        // frame_end waits for the frame that last used the next backbuffer to finish, so once FRAMES_IN_FLIGHT frames
+        // have ended since the frame a resource was released in, all frames that could have used it have finished.
+        const auto completed_copy_fence_value = m_copy_command_queue->get_completed_value();
+
+        std::erase_if(m_deferred_releases, [&](const DeferredRelease &deferred_release) {
+            if (m_frame_number < deferred_release.frame_number + FRAMES_IN_FLIGHT ||
+                completed_copy_fence_value < deferred_release.copy_fence_value)
+            {
+                return false;
+            }
+
+            for (const auto index : deferred_release.descriptor_indices)
+            {
+                m_cbv_srv_uav_descriptor_heap->free_descriptor(index);
+            }
+
+            return true;
+        });
+    }
 } // namespace serenity::renderer::rhi
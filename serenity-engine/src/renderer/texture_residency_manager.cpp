@@ -0,0 +1,256 @@
+#include "serenity-engine/renderer/texture_residency_manager.hpp"
+
+namespace serenity::renderer
+{
+    namespace
+    {
+        // Textures are streamed / evicted by separate passes of update, so a texture can be changed more than once.
+        // Only the final residency of each texture is returned.
+        void set_residency_change(std::vector<TextureResidencyChange> &changes, const uint32_t texture_index,
+                                  const uint32_t most_detailed_mip)
+        {
+            const auto itr = std::find_if(changes.begin(), changes.end(), [&](const TextureResidencyChange &change) {
+                return change.texture_index == texture_index;
+            });
+
+            if (itr != changes.end())
+            {
+                itr->most_detailed_mip = most_detailed_mip;
+                return;
+            }
+
+            changes.push_back(TextureResidencyChange{
+                .texture_index = texture_index,
+                .most_detailed_mip = most_detailed_mip,
+            });
+        }
+    } // namespace
+
+    TextureResidencyManager::TextureResidencyManager(const uint64_t budget, const uint32_t protected_frame_count,
+                                                     const uint64_t max_streamed_size_per_frame)
+        : m_budget(budget), m_protected_frame_count(std::max(protected_frame_count, 1u)),
+          m_max_streamed_size_per_frame(max_streamed_size_per_frame)
+    {
+    }
+
+    uint32_t TextureResidencyManager::get_most_detailed_resident_mip(const uint32_t texture_index) const
+    {
+        if (texture_index >= m_textures.size() || !m_textures[texture_index].valid)
+        {
+            core::Log::instance().critical(
+                std::format("Texture with index {} is not tracked by the texture residency manager", texture_index));
+        }
+
+        return m_textures[texture_index].most_detailed_mip;
+    }
+
+    void TextureResidencyManager::add_texture(const uint32_t texture_index, const std::span<const uint64_t> mip_sizes,
+                                              const bool evictable, const uint64_t frame,
+                                              const uint32_t most_detailed_mip)
+    {
+        if (!evictable && most_detailed_mip != 0u)
+        {
+            core::Log::instance().critical(
+                std::format("Non evictable texture with index {} must be added with all mip levels resident",
+                            texture_index));
+        }
+
+        if (texture_index >= m_textures.size())
+        {
+            m_textures.resize(texture_index + 1u);
+        }
+
+        remove_texture(texture_index);
+
+        auto &texture = m_textures[texture_index];
+        texture = TextureEntry{
+            .mip_sizes = {mip_sizes.begin(), mip_sizes.end()},
+            .most_detailed_mip = std::min<uint32_t>(most_detailed_mip, static_cast<uint32_t>(mip_sizes.size())),
+            .last_used_frame = frame,
+            .desired_mip = most_detailed_mip,
+            .last_detail_requested_frame = frame,
+            .evictable = evictable,
+            .valid = true,
+        };
+
+        m_resident_size += get_resident_size(texture, texture.most_detailed_mip);
+    }
+
+    void TextureResidencyManager::remove_texture(const uint32_t texture_index)
+    {
+        if (texture_index >= m_textures.size() || !m_textures[texture_index].valid)
+        {
+            return;
+        }
+
+        auto &texture = m_textures[texture_index];
+        m_resident_size -= get_resident_size(texture, texture.most_detailed_mip);
+
+        texture = TextureEntry{};
+    }
+
+    void TextureResidencyManager::mark_texture_as_used(const uint32_t texture_index, const uint64_t frame,
+                                                       const uint32_t desired_mip)
+    {
+        if (texture_index >= m_textures.size() || !m_textures[texture_index].valid)
+        {
+            return;
+        }
+
+        auto &texture = m_textures[texture_index];
+
+        // The least detailed mip level is always desired, so that the texture is resident if it is used at all.
+        const auto mip = texture.evictable ? std::min(desired_mip, static_cast<uint32_t>(texture.mip_sizes.size()) - 1u)
+                                           : 0u;
+
+        if (frame > texture.last_used_frame)
+        {
+            texture.desired_mip = mip;
+        }
+        else if (frame == texture.last_used_frame)
+        {
+            texture.desired_mip = std::min(texture.desired_mip, mip);
+        }
+
+        texture.last_used_frame = std::max(texture.last_used_frame, frame);
+
+        if (texture.desired_mip <= texture.most_detailed_mip)
+        {
+            texture.last_detail_requested_frame = std::max(texture.last_detail_requested_frame, frame);
+        }
+    }
+
+    std::vector<TextureResidencyChange> TextureResidencyManager::update(const uint64_t frame)
+    {
+        auto changes = std::vector<TextureResidencyChange>{};
+
+        stream_in_textures(frame, changes);
+        stream_out_textures(frame, changes);
+
+        if (m_resident_size <= m_budget)
+        {
+            return changes;
+        }
+
+        // Evict the least recently used textures (that are not used in any of the protected frames) until the resident
+        // size is within the budget. Ties are broken by texture index so that eviction is deterministic.
+        auto eviction_candidates = std::vector<uint32_t>{};
+        for (const auto i : std::views::iota(size_t{0u}, m_textures.size()))
+        {
+            const auto &texture = m_textures[i];
+            if (texture.valid && texture.evictable && texture.most_detailed_mip < texture.mip_sizes.size() &&
+                texture.last_used_frame + m_protected_frame_count <= frame)
+            {
+                eviction_candidates.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        std::sort(eviction_candidates.begin(), eviction_candidates.end(), [&](const uint32_t a, const uint32_t b) {
+            return std::pair{m_textures[a].last_used_frame, a} < std::pair{m_textures[b].last_used_frame, b};
+        });
+
+        for (const auto texture_index : eviction_candidates)
+        {
+            if (m_resident_size <= m_budget)
+            {
+                break;
+            }
+
+            auto &texture = m_textures[texture_index];
+            while (m_resident_size > m_budget && texture.most_detailed_mip < texture.mip_sizes.size())
+            {
+                m_resident_size -= texture.mip_sizes[texture.most_detailed_mip++];
+            }
+
+            set_residency_change(changes, texture_index, texture.most_detailed_mip);
+        }
+
+        return changes;
+    }
+
+    void TextureResidencyManager::stream_in_textures(const uint64_t frame, std::vector<TextureResidencyChange> &changes)
+    {
+        auto stream_in_candidates = std::vector<uint32_t>{};
+        for (const auto i : std::views::iota(size_t{0u}, m_textures.size()))
+        {
+            const auto &texture = m_textures[i];
+            if (texture.valid && texture.last_used_frame >= frame && texture.most_detailed_mip > texture.desired_mip)
+            {
+                stream_in_candidates.push_back(static_cast<uint32_t>(i));
+            }
+        }
+
+        // The textures that are missing the most mip levels are streamed in first (textures that are evicted entirely
+        // are not visible at all). Ties are broken by texture index so that streaming is deterministic.
+        std::sort(stream_in_candidates.begin(), stream_in_candidates.end(), [&](const uint32_t a, const uint32_t b) {
+            const auto &texture_a = m_textures[a];
+            const auto &texture_b = m_textures[b];
+
+            return std::pair{texture_b.most_detailed_mip - texture_b.desired_mip, a} <
+                   std::pair{texture_a.most_detailed_mip - texture_a.desired_mip, b};
+        });
+
+        // Textures are recreated with all resident mip levels when streamed in, so the streamed size of a texture is
+        // its resident size after the change.
+        auto streamed_size = uint64_t{0u};
+
+        for (const auto texture_index : stream_in_candidates)
+        {
+            auto &texture = m_textures[texture_index];
+
+            // Stream in as many mip levels (at least one) as fit in the remaining streaming size of this frame.
+            auto most_detailed_mip = texture.most_detailed_mip - 1u;
+            while (most_detailed_mip > texture.desired_mip &&
+                   streamed_size + get_resident_size(texture, most_detailed_mip - 1u) <= m_max_streamed_size_per_frame)
+            {
+                --most_detailed_mip;
+            }
+
+            const auto resident_size = get_resident_size(texture, most_detailed_mip);
+            if (streamed_size != 0u && streamed_size + resident_size > m_max_streamed_size_per_frame)
+            {
+                continue;
+            }
+
+            streamed_size += resident_size;
+
+            m_resident_size += resident_size - get_resident_size(texture, texture.most_detailed_mip);
+            texture.most_detailed_mip = most_detailed_mip;
+
+            if (texture.desired_mip <= texture.most_detailed_mip)
+            {
+                texture.last_detail_requested_frame = frame;
+            }
+
+            set_residency_change(changes, texture_index, most_detailed_mip);
+        }
+    }
+
+    void TextureResidencyManager::stream_out_textures(const uint64_t frame,
+                                                      std::vector<TextureResidencyChange> &changes)
+    {
+        for (const auto i : std::views::iota(size_t{0u}, m_textures.size()))
+        {
+            auto &texture = m_textures[i];
+            if (!texture.valid || !texture.evictable || texture.most_detailed_mip >= texture.desired_mip ||
+                texture.last_detail_requested_frame + m_protected_frame_count > frame)
+            {
+                continue;
+            }
+
+            m_resident_size -= get_resident_size(texture, texture.most_detailed_mip) -
+                               get_resident_size(texture, texture.desired_mip);
+            texture.most_detailed_mip = texture.desired_mip;
+
+            set_residency_change(changes, static_cast<uint32_t>(i), texture.most_detailed_mip);
+        }
+    }
+
+    uint64_t TextureResidencyManager::get_resident_size(const TextureEntry &texture,
+                                                         const uint32_t most_detailed_mip) const
+    {
+        const auto first_resident_mip = std::min<size_t>(most_detailed_mip, texture.mip_sizes.size());
+
+        return std::accumulate(texture.mip_sizes.begin() + first_resident_mip, texture.mip_sizes.end(), uint64_t{0u});
+    }
+} // namespace serenity::renderer
\ No newline at end of file
@@ -20,13 +20,26 @@ namespace serenity::scene
     {
         if (script_index != INVALID_INDEX_U32)
         {
-            scripting::ScriptManager::instance().execute_script(script_index);
+            // The script is compiled once by the script manager, so only the cached update function is called here.
+            if (auto &update_function = scripting::ScriptManager::instance().get_update_function(script_index);
+                update_function.valid())
+            {
+                auto &transform = transform_component;
 
-            auto &transform = transform_component;
-
-            std::tie(transform.scale, transform.rotation, transform.translation) =
-                scripting::ScriptManager::instance().call_function()["update_transform"](
-                    transform.scale, transform.rotation, transform.translation, delta_time, frame_count);
+                if (const sol::protected_function_result result = update_function(
+                        transform.scale, transform.rotation, transform.translation, delta_time, frame_count);
+                    result.valid())
+                {
+                    std::tie(transform.scale, transform.rotation, transform.translation) =
+                        result.get<std::tuple<math::XMFLOAT3, math::XMFLOAT3, math::XMFLOAT3>>();
+                }
+                else
+                {
+                    const sol::error error = result;
+                    core::Log::instance().warn(
+                        std::format("Error in update function of game object {} : {}", game_object_name, error.what()));
+                }
+            }
         }
 
         transform_component.update(delta_time, frame_count);
@@ -6,6 +6,121 @@
 
 namespace serenity::scene
 {
+    namespace
+    {
+        // Unit cube (centered at the origin) with a single untextured grey material. Game objects use this model
+        // while their own model is still being loaded.
+        std::shared_ptr<const asset::ModelData> create_placeholder_model()
+        {
+            using namespace math;
+
+            auto mesh_data = asset::MeshData{
+                .mesh_local_transform_matrix = XMMatrixIdentity(),
+                .inverse_mesh_local_transform_matrix = XMMatrixIdentity(),
+                .bounding_sphere = XMFLOAT4{0.0f, 0.0f, 0.0f, std::sqrt(0.75f)},
+                .bounding_box_min = XMFLOAT3{-0.5f, -0.5f, -0.5f},
+                .bounding_box_max = XMFLOAT3{0.5f, 0.5f, 0.5f},
+            };
+
+            const auto face_normals = std::array{
+                XMFLOAT3{1.0f, 0.0f, 0.0f},  XMFLOAT3{-1.0f, 0.0f, 0.0f}, XMFLOAT3{0.0f, 1.0f, 0.0f},
+                XMFLOAT3{0.0f, -1.0f, 0.0f}, XMFLOAT3{0.0f, 0.0f, 1.0f},  XMFLOAT3{0.0f, 0.0f, -1.0f},
+            };
+
+            for (const auto &face_normal : face_normals)
+            {
+                // The face is spanned by axis_u and axis_v (both perpendicular to the normal, with length 0.5).
+                const auto normal = XMLoadFloat3(&face_normal);
+                const auto axis_u = XMVectorSwizzle<2, 0, 1, 3>(normal) * 0.5f;
+                const auto axis_v = XMVector3Cross(normal, axis_u);
+                const auto center = normal * 0.5f;
+
+                const auto first_vertex = static_cast<uint32_t>(mesh_data.positions.size());
+
+                const auto corners = std::array{
+                    std::pair{center - axis_u - axis_v, XMFLOAT2{0.0f, 1.0f}},
+                    std::pair{center - axis_u + axis_v, XMFLOAT2{0.0f, 0.0f}},
+                    std::pair{center + axis_u + axis_v, XMFLOAT2{1.0f, 0.0f}},
+                    std::pair{center + axis_u - axis_v, XMFLOAT2{1.0f, 1.0f}},
+                };
+
+                for (const auto &[position, texture_coord] : corners)
+                {
+                    XMStoreFloat3(&mesh_data.positions.emplace_back(), position);
+                    mesh_data.normals.emplace_back(face_normal);
+                    mesh_data.texture_coords.emplace_back(texture_coord);
+                }
+
+                // Since (axis_u x axis_v) points along the normal, these triangles face outwards.
+                for (const auto index : {0u, 2u, 1u, 0u, 3u, 2u})
+                {
+                    mesh_data.indices.emplace_back(first_vertex + index);
+                }
+            }
+
+            auto model_data = asset::ModelData{};
+            model_data.mesh_data.emplace_back(std::move(mesh_data));
+            model_data.material_data.emplace_back(asset::MaterialData{
+                .base_color = XMFLOAT4{0.5f, 0.5f, 0.5f, 1.0f},
+                .metallic_roughness_factor = XMFLOAT2{0.0f, 1.0f},
+            });
+
+            return std::make_shared<const asset::ModelData>(std::move(model_data));
+        }
+
+        uint32_t get_index_count(const asset::IndicesView &indices)
+        {
+            return std::visit([](const auto typed_indices) { return static_cast<uint32_t>(typed_indices.size()); },
+                              indices);
+        }
+
+        // Color textures use the sRGB formats, so they are converted to linear when sampled.
+        DXGI_FORMAT get_texture_format(const asset::TextureCompression texture_compression, const bool is_srgb)
+        {
+            switch (texture_compression)
+            {
+            case asset::TextureCompression::BC1: {
+                return is_srgb ? DXGI_FORMAT_BC1_UNORM_SRGB : DXGI_FORMAT_BC1_UNORM;
+            }
+            break;
+
+            case asset::TextureCompression::BC3: {
+                return is_srgb ? DXGI_FORMAT_BC3_UNORM_SRGB : DXGI_FORMAT_BC3_UNORM;
+            }
+            break;
+
+            case asset::TextureCompression::BC5: {
+                return DXGI_FORMAT_BC5_UNORM;
+            }
+            break;
+
+            case asset::TextureCompression::BC7: {
+                return is_srgb ? DXGI_FORMAT_BC7_UNORM_SRGB : DXGI_FORMAT_BC7_UNORM;
+            }
+            break;
+
+            default: {
+                return is_srgb ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB : DXGI_FORMAT_R8G8B8A8_UNORM;
+            }
+            break;
+            }
+        }
+
+        // FNV-1a hash of the material buffer. Material buffers are created with designated initializers, so the
+        // padding is always zero and identical materials have identical bytes.
+        uint64_t get_material_buffer_hash(const interop::MaterialBuffer &material_buffer)
+        {
+            auto hash = uint64_t{14695981039346656037u};
+            for (const auto byte : std::as_bytes(std::span{&material_buffer, 1u}))
+            {
+                hash ^= static_cast<uint8_t>(byte);
+                hash *= uint64_t{1099511628211u};
+            }
+
+            return hash;
+        }
+    } // namespace
+
     Scene::Scene(const std::string_view scene_name, const std::string_view scene_init_script_path)
     {
         m_scene_name = scene_name;
@@ -18,8 +133,12 @@ namespace serenity::scene
         m_scene_init_script_index = scripting::ScriptManager::instance().create_script(scripting::Script{
             .script_name = std::string(scene_name) + " init script",
             .script_path = script_path,
+            .execute_on_load = false,
         });
 
+        m_placeholder_scene_model.model = create_placeholder_model();
+        create_scene_model_materials("Placeholder Model", m_placeholder_scene_model);
+
         load_scene_from_script();
 
         core::Log::instance().info(std::format("Created scene {}", scene_name));
@@ -27,20 +146,45 @@ namespace serenity::scene
 
     void Scene::reload()
     {
-        m_scene_resources.game_object_buffers.clear();
-        m_scene_resources.indices.clear();
-        m_scene_resources.material_buffers.clear();
-        m_scene_resources.mesh_buffers.clear();
-        m_scene_resources.normals.clear();
-        m_scene_resources.positions.clear();
-        m_scene_resources.texture_coords.clear();
-
         m_game_objects.clear();
-
         m_game_objects.reserve(Scene::MAX_GAME_OBJECTS);
-        m_scene_resources.game_object_buffers.resize(Scene::MAX_GAME_OBJECTS);
+
+        // The models are requested again (the import settings may have changed). The scene models (and their textures
+        // / parsed model data) are retained, so models that are still used after the reload are not loaded again.
+        m_scene_model_keys.clear();
+        m_pending_models.clear();
 
         load_scene_from_script();
+
+        // Release models that are no longer used by any game object after the reload.
+        std::erase_if(m_scene_models, [](const auto &scene_model) { return scene_model.second.reference_count == 0u; });
+    }
+
+    void Scene::update_material_buffer(const uint32_t material_index, const interop::MaterialBuffer &material_buffer)
+    {
+        auto &scene_material_buffer = m_scene_resources.material_buffers.at(material_index);
+        if (std::memcmp(&scene_material_buffer, &material_buffer, sizeof(interop::MaterialBuffer)) == 0)
+        {
+            return;
+        }
+
+        // The material keeps its slot (so the mesh buffers that use it need not be updated), but is no longer found
+        // under its old hash. This can leave duplicate materials until the scene resources are rebuilt.
+        const auto [begin, end] =
+            m_material_buffer_indices.equal_range(get_material_buffer_hash(scene_material_buffer));
+        for (auto itr = begin; itr != end; ++itr)
+        {
+            if (itr->second == material_index)
+            {
+                m_material_buffer_indices.erase(itr);
+                break;
+            }
+        }
+
+        scene_material_buffer = material_buffer;
+        m_material_buffer_indices.emplace(get_material_buffer_hash(scene_material_buffer), material_index);
+
+        m_material_buffers_dirty = true;
     }
 
     void Scene::update(const math::XMMATRIX projection_matrix, const float delta_time, const uint32_t frame_count,
@@ -48,6 +192,15 @@ namespace serenity::scene
     {
         m_camera.update(delta_time, input);
 
+        // Add the models that have finished loading since the last frame to the scene.
+        if (integrate_loaded_models())
+        {
+            rebuild_scene_resources();
+        }
+
+        // Pick up changes made to scripts (for ex. via the editor) before the game objects are updated.
+        scripting::ScriptManager::instance().reload_modified_scripts();
+
         m_lights.update(m_scene_resources.scene_buffer.view_matrix);
 
         // Update scene buffer.
@@ -78,22 +231,46 @@ namespace serenity::scene
             m_scene_resources.game_object_buffers.push_back(game_object_data);
         }
 
+        select_mesh_lods(projection_matrix);
+        request_texture_mips(projection_matrix);
+
+        // Residency changes of the previous frame are picked up here. Until then, the previous SRVs of the textures
+        // remain valid, as they are only released after FRAMES_IN_FLIGHT frames.
+        for (const auto i : std::views::iota(size_t{0u}, m_scene_resources.material_buffers.size()))
+        {
+            if (update_texture_srv_indices(m_scene_resources.material_buffers[i], m_material_texture_indices[i]))
+            {
+                m_material_buffers_dirty = true;
+            }
+        }
+
         renderer::Renderer::instance()
             .get_buffer_at_index(m_scene_resources.game_object_buffer_index)
             .update(reinterpret_cast<const std::byte *>(m_scene_resources.game_object_buffers.data()),
                     sizeof(interop::GameObjectBuffer) * m_scene_resources.game_object_buffers.size());
 
-        renderer::Renderer::instance()
-            .get_buffer_at_index(m_scene_resources.materal_buffer_index)
-            .update(reinterpret_cast<const std::byte *>(m_scene_resources.material_buffers.data()),
-                    sizeof(interop::MaterialBuffer) * m_scene_resources.material_buffers.size());
+        // The material buffers are uploaded when the scene buffers are created, so they only have to be uploaded again
+        // if they are modified.
+        if (m_material_buffers_dirty)
+        {
+            renderer::Renderer::instance()
+                .get_buffer_at_index(m_scene_resources.materal_buffer_index)
+                .update(reinterpret_cast<const std::byte *>(m_scene_resources.material_buffers.data()),
+                        sizeof(interop::MaterialBuffer) * m_scene_resources.material_buffers.size());
+
+            m_material_buffers_dirty = false;
+        }
     }
 
     void Scene::load_scene_from_script()
     {
         scripting::ScriptManager::instance().execute_script(m_scene_init_script_index);
 
-        sol::table game_objects = scripting::ScriptManager::instance().get_state()["game_objects"];
+        auto &environment = scripting::ScriptManager::instance().get_environment(m_scene_init_script_index);
+
+        m_quantize_vertices = environment["quantize_vertices"].get_or(false);
+
+        sol::table game_objects = environment["game_objects"];
 
         for (auto &key_value_pair : game_objects)
         {
@@ -137,6 +314,58 @@ namespace serenity::scene
             m_game_objects[game_object_name] = std::move(new_game_object);
         }
 
+        rebuild_scene_resources();
+    }
+
+    template <typename T>
+    uint32_t Scene::create_scene_buffer(const renderer::rhi::BufferCreationDesc &buffer_creation_desc,
+                                        const std::span<const T> data)
+    {
+        const auto index = renderer::Renderer::instance().create_buffer<T>(buffer_creation_desc, data);
+        m_scene_buffer_indices.push_back(index);
+
+        return index;
+    }
+
+    void Scene::rebuild_scene_resources()
+    {
+        m_scene_resources.indices.clear();
+        m_scene_resources.indices_32.clear();
+        m_scene_resources.material_buffers.clear();
+        m_material_buffer_indices.clear();
+        m_material_texture_indices.clear();
+        m_scene_resources.mesh_buffers.clear();
+        m_scene_resources.mesh_lods.clear();
+        m_scene_resources.meshlets.clear();
+        m_scene_resources.meshlet_triangles.clear();
+        m_scene_resources.meshlet_vertices.clear();
+        m_scene_resources.normals.clear();
+        m_scene_resources.positions.clear();
+        m_scene_resources.quantized_normals.clear();
+        m_scene_resources.quantized_positions.clear();
+        m_scene_resources.quantized_texture_coords.clear();
+        m_scene_resources.selected_mesh_lods.clear();
+        m_scene_resources.texture_coords.clear();
+
+        m_scene_resources.game_object_buffers.resize(Scene::MAX_GAME_OBJECTS);
+
+        // The geometry / materials of the scene models have to be added to the scene resources again.
+        m_placeholder_scene_model.mesh_buffers.clear();
+        m_placeholder_scene_model.material_indices.clear();
+        m_placeholder_scene_model.reference_count = 0u;
+
+        for (auto &[model_key, scene_model] : m_scene_models)
+        {
+            scene_model.mesh_buffers.clear();
+            scene_model.material_indices.clear();
+            scene_model.reference_count = 0u;
+        }
+
+        for (auto &[name, game_object] : m_game_objects)
+        {
+            add_game_object_to_scene_resources(game_object);
+        }
+
         create_scene_buffers();
     }
 
@@ -144,55 +373,157 @@ namespace serenity::scene
     {
         auto &scene_rsc = m_scene_resources;
 
+        // The buffers of the previous scene resources might still be used by the frames in flight, so they are
+        // destroyed (i.e released once the GPU no longer uses them) rather than overwritten.
+        for (const auto index : m_scene_buffer_indices)
+        {
+            renderer::Renderer::instance().destroy_buffer(index);
+        }
+
+        m_scene_buffer_indices.clear();
+
         // Create the scene buffer.
-        scene_rsc.scene_buffer_index =
-            renderer::Renderer::instance().create_buffer<interop::SceneBuffer>(renderer::rhi::BufferCreationDesc{
-                .usage = renderer::rhi::BufferUsage::ConstantBuffer,
-                .name = string_to_wstring(m_scene_name) + L" Scene Buffer",
-            });
+        scene_rsc.scene_buffer_index = create_scene_buffer<interop::SceneBuffer>(renderer::rhi::BufferCreationDesc{
+            .usage = renderer::rhi::BufferUsage::ConstantBuffer,
+            .name = string_to_wstring(m_scene_name) + L" Scene Buffer",
+        });
 
-        // Create scene positions buffer.
-        scene_rsc.position_buffer_index = renderer::Renderer::instance().create_buffer<math::XMFLOAT3>(
-            renderer::rhi::BufferCreationDesc{
-                .usage = renderer::rhi::BufferUsage::StructuredBuffer,
-                .name = string_to_wstring(m_scene_name) + L" Position Buffer",
-            },
-            scene_rsc.positions);
+        // Create the scene vertex buffers (if all meshes of the scene are quantized, the float vertex buffers are not
+        // required).
+        if (!scene_rsc.positions.empty())
+        {
+            // Create scene positions buffer.
+            scene_rsc.position_buffer_index = create_scene_buffer<math::XMFLOAT3>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Position Buffer",
+                },
+                scene_rsc.positions);
 
-        // Create scene normal buffer.
-        scene_rsc.normal_buffer_index = renderer::Renderer::instance().create_buffer<math::XMFLOAT3>(
-            renderer::rhi::BufferCreationDesc{
-                .usage = renderer::rhi::BufferUsage::StructuredBuffer,
-                .name = string_to_wstring(m_scene_name) + L" Normal Buffer",
-            },
-            scene_rsc.normals);
+            // Create scene normal buffer.
+            scene_rsc.normal_buffer_index = create_scene_buffer<math::XMFLOAT3>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Normal Buffer",
+                },
+                scene_rsc.normals);
 
-        // Create scene teture coords buffer.
-        scene_rsc.texture_coord_buffer_index = renderer::Renderer::instance().create_buffer<math::XMFLOAT2>(
-            renderer::rhi::BufferCreationDesc{
-                .usage = renderer::rhi::BufferUsage::StructuredBuffer,
-                .name = string_to_wstring(m_scene_name) + L" Texture Coords Buffer",
-            },
-            scene_rsc.texture_coords);
+            // Create scene teture coords buffer.
+            scene_rsc.texture_coord_buffer_index = create_scene_buffer<math::XMFLOAT2>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Texture Coords Buffer",
+                },
+                scene_rsc.texture_coords);
+        }
+
+        if (!scene_rsc.quantized_positions.empty())
+        {
+            scene_rsc.quantized_position_buffer_index = create_scene_buffer<asset::QuantizedPosition>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Quantized Position Buffer",
+                },
+                scene_rsc.quantized_positions);
+
+            scene_rsc.quantized_normal_buffer_index = create_scene_buffer<uint32_t>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Quantized Normal Buffer",
+                },
+                scene_rsc.quantized_normals);
+
+            scene_rsc.quantized_texture_coord_buffer_index = create_scene_buffer<uint32_t>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Quantized Texture Coords Buffer",
+                },
+                scene_rsc.quantized_texture_coords);
+        }
+
+        // Report the vertex memory of the scene, and the memory saved by the quantized vertex streams (the size of the
+        // quantized normals depends on their encoding).
+        constexpr auto vertex_size = sizeof(math::XMFLOAT3) * 2u + sizeof(math::XMFLOAT2);
+
+        const auto quantized_vertex_count = scene_rsc.quantized_positions.size();
+        const auto quantized_word_count =
+            scene_rsc.quantized_normals.size() + scene_rsc.quantized_texture_coords.size();
+        const auto quantized_vertex_memory =
+            quantized_vertex_count * sizeof(asset::QuantizedPosition) + quantized_word_count * sizeof(uint32_t);
+        const auto vertex_memory = scene_rsc.positions.size() * vertex_size + quantized_vertex_memory;
+
+        core::Log::instance().info(std::format(
+            "Vertex memory of scene {} : {:.3f} MB ({} of {} vertices quantized, {:.3f} MB saved)", m_scene_name,
+            vertex_memory / (1024.0f * 1024.0f), quantized_vertex_count,
+            scene_rsc.positions.size() + quantized_vertex_count,
+            (quantized_vertex_count * vertex_size - quantized_vertex_memory) / (1024.0f * 1024.0f)));
 
         // Create scene indices buffer.
-        scene_rsc.index_buffer_index = renderer::Renderer::instance().create_buffer<uint16_t>(
+        scene_rsc.index_buffer_index = create_scene_buffer<uint16_t>(
             renderer::rhi::BufferCreationDesc{
                 .usage = renderer::rhi::BufferUsage::IndexBuffer,
                 .name = string_to_wstring(m_scene_name) + L" Index Buffer",
             },
             scene_rsc.indices);
 
+        if (!scene_rsc.indices_32.empty())
+        {
+            scene_rsc.index_32_buffer_index = create_scene_buffer<uint32_t>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::IndexBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" 32 Bit Index Buffer",
+                },
+                scene_rsc.indices_32);
+        }
+
+        // Create the scene meshlet buffers.
+        if (!scene_rsc.meshlets.empty())
+        {
+            scene_rsc.meshlet_buffer_index = create_scene_buffer<interop::MeshletBuffer>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Meshlet Buffer",
+                },
+                scene_rsc.meshlets);
+
+            scene_rsc.meshlet_vertex_buffer_index = create_scene_buffer<uint32_t>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Meshlet Vertex Buffer",
+                },
+                scene_rsc.meshlet_vertices);
+
+            scene_rsc.meshlet_triangle_buffer_index = create_scene_buffer<uint32_t>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Meshlet Triangle Buffer",
+                },
+                scene_rsc.meshlet_triangles);
+        }
+
+        // Create the scene mesh LOD buffer.
+        if (!scene_rsc.mesh_lods.empty())
+        {
+            scene_rsc.mesh_lod_buffer_index = create_scene_buffer<interop::MeshLodBuffer>(
+                renderer::rhi::BufferCreationDesc{
+                    .usage = renderer::rhi::BufferUsage::StructuredBuffer,
+                    .name = string_to_wstring(m_scene_name) + L" Mesh LOD Buffer",
+                },
+                scene_rsc.mesh_lods);
+        }
+
         // Create scene materials buffer.
-        scene_rsc.materal_buffer_index = renderer::Renderer::instance().create_buffer<interop::MaterialBuffer>(
+        scene_rsc.materal_buffer_index = create_scene_buffer<interop::MaterialBuffer>(
             renderer::rhi::BufferCreationDesc{
                 .usage = renderer::rhi::BufferUsage::DynamicStructuredBuffer,
                 .name = string_to_wstring(m_scene_name) + L" Material Buffer",
             },
             scene_rsc.material_buffers);
 
+        m_material_buffers_dirty = false;
+
         // Create scene game object buffer.
-        scene_rsc.game_object_buffer_index = renderer::Renderer::instance().create_buffer<interop::GameObjectBuffer>(
+        scene_rsc.game_object_buffer_index = create_scene_buffer<interop::GameObjectBuffer>(
             renderer::rhi::BufferCreationDesc{
                 .usage = renderer::rhi::BufferUsage::DynamicStructuredBuffer,
                 .name = string_to_wstring(m_scene_name) + L" Game Object Buffer",
@@ -200,7 +531,7 @@ namespace serenity::scene
             scene_rsc.game_object_buffers);
 
         // Create scene meshes buffer.
-        scene_rsc.meshes_buffer_index = renderer::Renderer::instance().create_buffer<interop::MeshBuffer>(
+        scene_rsc.meshes_buffer_index = create_scene_buffer<interop::MeshBuffer>(
             renderer::rhi::BufferCreationDesc{
                 .usage = renderer::rhi::BufferUsage::StructuredBuffer,
                 .name = string_to_wstring(m_scene_name) + L" Scene Meshes Buffer",
@@ -208,95 +539,708 @@ namespace serenity::scene
             scene_rsc.mesh_buffers);
     }
 
-    GameObject Scene::create_game_object(const std::string_view game_object_name,
-                                         const std::string_view gltf_scene_path)
+    GameObject Scene::create_game_object(const std::string_view game_object_name, const std::string_view model_path)
     {
         auto game_object = GameObject{};
 
         game_object.game_object_index = m_game_objects.size();
         game_object.game_object_name = game_object_name;
+        game_object.model_path = model_path;
 
-        // Load the model data (meshes + materials) and create GPU buffers / textures for them.
-        const auto model_data = asset::ModelLoader::load_model(gltf_scene_path);
+        request_scene_model(model_path);
 
-        game_object.mesh_count = model_data.mesh_data.size();
-        game_object.material_count = model_data.material_data.size();
+        return game_object;
+    }
 
+    void Scene::add_game_object_to_scene_resources(GameObject &game_object)
+    {
+        // Add the meshes / materials of the (shared) model to the scene resources if this is the first game object
+        // using it.
+        auto &scene_model = get_scene_model(game_object.model_path);
+        if (scene_model.reference_count == 0u)
+        {
+            add_scene_model_to_scene_resources(scene_model);
+        }
+
+        ++scene_model.reference_count;
+
+        game_object.mesh_count = scene_model.mesh_buffers.size();
         game_object.mesh_buffer_offset = m_scene_resources.mesh_buffers.size();
-        game_object.material_buffer_offset = m_scene_resources.material_buffers.size();
 
-        auto meshes = std::vector<interop::MeshBuffer>{};
-        for (const auto &mesh_data : model_data.mesh_data)
+        game_object.material_indices = scene_model.material_indices;
+
+        // Each game object still requires its own mesh buffers (since the mesh buffer has the game object index), but
+        // these point to the vertex / index ranges shared by all game objects using the model.
+        for (const auto &scene_model_mesh_buffer : scene_model.mesh_buffers)
         {
-            // Setup mesh_part.
-            auto mesh_buffer = interop::MeshBuffer{
-                .mesh_index = static_cast<uint32_t>(m_scene_resources.mesh_buffers.size() + meshes.size()),
-                .game_object_index = game_object.game_object_index,
+            auto mesh_buffer = scene_model_mesh_buffer;
+            mesh_buffer.mesh_index = static_cast<uint32_t>(m_scene_resources.mesh_buffers.size());
+            mesh_buffer.game_object_index = game_object.game_object_index;
 
-                .position_offset = static_cast<uint32_t>(m_scene_resources.positions.size()),
-                .normal_offset = static_cast<uint32_t>(m_scene_resources.normals.size()),
-                .texture_coord_offset = static_cast<uint32_t>(m_scene_resources.texture_coords.size()),
+            m_scene_resources.mesh_buffers.emplace_back(mesh_buffer);
+        }
+    }
 
-                .indices_offset = static_cast<uint32_t>(m_scene_resources.indices.size()),
-                .indices_count = static_cast<uint32_t>(mesh_data.indices.size()),
+    void Scene::request_scene_model(const std::string_view model_path)
+    {
+        const auto path = std::string(model_path);
+        if (m_scene_model_keys.contains(path) || m_pending_models.contains(path))
+        {
+            return;
+        }
 
-                .mesh_local_transform_matrix = mesh_data.mesh_local_transform_matrix,
-                .inverse_mesh_local_transform_matrix = mesh_data.inverse_mesh_local_transform_matrix,
+        // Cooked models are memory mapped (the data is only read when it is accessed), so they are loaded right away.
+        if (std::filesystem::path(model_path).extension() == ".smesh")
+        {
+            add_scene_model(model_path, asset::ModelLoader::load_shared_cooked_model(model_path));
+            return;
+        }
 
-                .material_index =
-                    static_cast<uint32_t>(m_scene_resources.material_buffers.size() + mesh_data.material_index),
-            };
+        const auto import_config = asset::ModelImportConfig{
+            .quantize_vertices = m_quantize_vertices,
+        };
 
-            meshes.emplace_back(mesh_buffer);
+        // If the model is already loaded (for ex. by another scene, or before a reload), it is added right away so the
+        // placeholder is not shown at all.
+        const auto model_handle = asset::ModelLoader::load_model_async(model_path, import_config);
+        if (model_handle.is_ready())
+        {
+            add_loaded_scene_model(model_path, model_handle);
+            return;
+        }
 
-            // Add data to the scene buffers.
-            m_scene_resources.positions.insert(m_scene_resources.positions.end(), mesh_data.positions.begin(),
-                                               mesh_data.positions.end());
-            m_scene_resources.normals.insert(m_scene_resources.normals.end(), mesh_data.normals.begin(),
-                                             mesh_data.normals.end());
-            m_scene_resources.texture_coords.insert(m_scene_resources.texture_coords.end(),
-                                                    mesh_data.texture_coords.begin(), mesh_data.texture_coords.end());
+        m_pending_models[path] = model_handle;
+    }
+
+    bool Scene::integrate_loaded_models()
+    {
+        // Creating the GPU textures of a model is done on the main thread, so to avoid long frames when many models
+        // finish loading at once, at most MAX_MODEL_INTEGRATION_TIME_PER_FRAME ms per frame are spent on it. At least
+        // one model is integrated per frame though, so that loading always makes progress.
+        const auto start_time = std::chrono::high_resolution_clock::now();
+
+        auto models_integrated = false;
+        for (auto itr = m_pending_models.begin(); itr != m_pending_models.end();)
+        {
+            const auto elapsed_time = std::chrono::duration<float, std::milli>(
+                std::chrono::high_resolution_clock::now() - start_time);
+            if (models_integrated && elapsed_time.count() >= MAX_MODEL_INTEGRATION_TIME_PER_FRAME)
+            {
+                break;
+            }
+
+            if (!itr->second.is_ready())
+            {
+                ++itr;
+                continue;
+            }
+
+            add_loaded_scene_model(itr->first, itr->second);
+            models_integrated = true;
+
+            itr = m_pending_models.erase(itr);
+        }
+
+        return models_integrated;
+    }
 
-            m_scene_resources.indices.insert(m_scene_resources.indices.end(), mesh_data.indices.begin(),
-                                             mesh_data.indices.end());
+    void Scene::add_loaded_scene_model(const std::string_view model_path,
+                                       const core::AsyncHandle<asset::ModelData> &model_handle)
+    {
+        // If the model failed to load, game objects using it keep using the placeholder model.
+        try
+        {
+            add_scene_model(model_path, model_handle.get());
+        }
+        catch (const std::exception &exception)
+        {
+            core::Log::instance().error(std::format("Failed to load model {} : {}", model_path, exception.what()));
+        }
+    }
+
+    SceneModel &Scene::get_scene_model(const std::string_view model_path)
+    {
+        if (const auto itr = m_scene_model_keys.find(std::string(model_path)); itr != m_scene_model_keys.end())
+        {
+            return m_scene_models.at(itr->second);
         }
-        m_scene_resources.mesh_buffers.insert(m_scene_resources.mesh_buffers.end(), meshes.begin(), meshes.end());
 
-        auto materials = std::vector<interop::MaterialBuffer>{};
-        for (const auto &material_data : model_data.material_data)
+        return m_placeholder_scene_model;
+    }
+
+    void Scene::add_scene_model(const std::string_view model_path, decltype(SceneModel::model) model)
+    {
+        const auto model_key =
+            std::visit([](const auto &shared_model) { return static_cast<const void *>(shared_model.get()); }, model);
+
+        m_scene_model_keys[std::string(model_path)] = model_key;
+
+        auto &scene_model = m_scene_models[model_key];
+        if (std::visit([](const auto &shared_model) { return shared_model != nullptr; }, scene_model.model))
         {
-            auto material = interop::MaterialBuffer{};
+            return;
+        }
 
-            const auto &base_color_texture_data = std::get<std::vector<uint8_t>>(material_data.base_color_texture.data);
+        scene_model.model = std::move(model);
+        create_scene_model_materials(model_path, scene_model);
+    }
 
-            material.albedo_texture_srv_index = INVALID_INDEX_U32;
+    void Scene::create_scene_model_materials(const std::string_view model_path, SceneModel &scene_model)
+    {
+        auto textures = std::vector<SceneTextureView>{};
+        auto materials = std::vector<SceneMaterialView>{};
 
-            if (material_data.base_color_texture.dimension.x != 0 && material_data.base_color_texture.dimension.y != 0)
+        // The texture data sources only hold a weak reference to the model, so that the model data is released once
+        // the model is no longer used by the scene.
+        if (const auto model_data = std::get_if<std::shared_ptr<const asset::ModelData>>(&scene_model.model))
+        {
+            for (const auto texture_index : std::views::iota(size_t{0u}, (*model_data)->textures.size()))
             {
-                const auto albedo_texture_index = renderer::Renderer::instance().create_texture(
-                    renderer::rhi::TextureCreationDesc{
-                        .usage = renderer::rhi::TextureUsage::ShaderResourceTexture,
-                        .format = DXGI_FORMAT_R8G8B8A8_UNORM_SRGB,
-                        .bytes_per_pixel = 4u,
-                        .dimension = material_data.base_color_texture.dimension,
-                        .name = string_to_wstring(game_object_name) + L" Albedo Texture Material " +
-                                std::to_wstring(materials.size()),
+                const auto &texture_data = (*model_data)->textures[texture_index];
+
+                textures.push_back(SceneTextureView{
+                    .dimension = texture_data.dimension,
+                    .mip_levels = texture_data.mip_levels,
+                    .compression = texture_data.compression,
+                    .data_source = [model = std::weak_ptr{*model_data}, texture_index]() {
+                        const auto shared_model = model.lock();
+                        if (shared_model == nullptr)
+                        {
+                            return std::shared_ptr<const std::byte>{};
+                        }
+
+                        const auto &shared_texture_data =
+                            std::get<std::vector<uint8_t>>(shared_model->textures[texture_index].data);
+
+                        return std::shared_ptr<const std::byte>(
+                            shared_model, reinterpret_cast<const std::byte *>(shared_texture_data.data()));
                     },
-                    reinterpret_cast<const std::byte *>(base_color_texture_data.data()));
+                });
+            }
+
+            for (const auto &material_data : (*model_data)->material_data)
+            {
+                materials.push_back(SceneMaterialView{
+                    .base_color = material_data.base_color,
+                    .metallic_roughness_factor = material_data.metallic_roughness_factor,
+                    .emissive_factor = material_data.emissive_factor,
+                    .normal_scale = material_data.normal_scale,
+                    .occlusion_strength = material_data.occlusion_strength,
+                    .texture_coord_transform = material_data.texture_coord_transform,
+                    .texture_indices = material_data.texture_indices,
+                });
+            }
+        }
+        else if (const auto cooked_model = std::get_if<std::shared_ptr<const asset::CookedModel>>(&scene_model.model))
+        {
+            for (const auto texture_index : std::views::iota(size_t{0u}, (*cooked_model)->get_textures().size()))
+            {
+                const auto &cooked_texture = (*cooked_model)->get_textures()[texture_index];
 
-                material.albedo_texture_srv_index =
-                    renderer::Renderer::instance().get_texture_at_index(albedo_texture_index).srv_index;
+                textures.push_back(SceneTextureView{
+                    .dimension = cooked_texture.dimension,
+                    .mip_levels = cooked_texture.mip_levels,
+                    .compression = cooked_texture.compression,
+                    .data_source = [model = std::weak_ptr{*cooked_model}, texture_index]() {
+                        const auto shared_model = model.lock();
+                        if (shared_model == nullptr)
+                        {
+                            return std::shared_ptr<const std::byte>{};
+                        }
+
+                        return std::shared_ptr<const std::byte>(
+                            shared_model,
+                            shared_model->get_texture_data(shared_model->get_textures()[texture_index]).data());
+                    },
+                });
             }
 
-            material.base_color = material_data.base_color;
-            material.metallic_roughness_factor = material_data.metallic_roughness_factor;
+            for (const auto &cooked_material : (*cooked_model)->get_materials())
+            {
+                materials.push_back(SceneMaterialView{
+                    .base_color = cooked_material.base_color,
+                    .metallic_roughness_factor = cooked_material.metallic_roughness_factor,
+                    .emissive_factor = cooked_material.emissive_factor,
+                    .normal_scale = cooked_material.normal_scale,
+                    .occlusion_strength = cooked_material.occlusion_strength,
+                    .texture_coord_transform = cooked_material.texture_coord_transform,
+                    .texture_indices = cooked_material.texture_indices,
+                });
+            }
+        }
 
-            materials.push_back(material);
+        // Whether a texture is sRGB depends on how the materials use it (textures are never shared between color and
+        // non color texture types, see asset::ModelLoader).
+        auto is_srgb = std::vector<bool>(textures.size());
+        for (const auto &material : materials)
+        {
+            for (const auto texture_type : std::views::iota(0u, asset::MATERIAL_TEXTURE_TYPE_COUNT))
+            {
+                if (const auto texture_index = material.texture_indices[texture_type]; texture_index < textures.size())
+                {
+                    is_srgb[texture_index] =
+                        asset::is_material_texture_srgb(static_cast<asset::MaterialTextureType>(texture_type));
+                }
+            }
         }
 
-        m_scene_resources.material_buffers.insert(m_scene_resources.material_buffers.end(), materials.begin(),
-                                                  materials.end());
+        // Create the GPU textures for the model's materials.
+        auto texture_srv_indices = std::vector<uint32_t>{};
+        texture_srv_indices.reserve(textures.size());
 
-        return game_object;
+        for (const auto texture_index : std::views::iota(size_t{0u}, textures.size()))
+        {
+            texture_srv_indices.push_back(
+                create_texture(string_to_wstring(model_path) + L" Texture " + std::to_wstring(texture_index),
+                               textures[texture_index], is_srgb[texture_index], scene_model.texture_indices));
+        }
+
+        for (const auto &material : materials)
+        {
+            scene_model.material_buffers.push_back(create_material_buffer(material, texture_srv_indices));
+
+            auto &material_texture_indices = scene_model.material_texture_indices.emplace_back();
+            for (const auto texture_type : std::views::iota(0u, asset::MATERIAL_TEXTURE_TYPE_COUNT))
+            {
+                const auto texture_index = material.texture_indices[texture_type];
+                material_texture_indices[texture_type] = texture_index < textures.size()
+                                                             ? scene_model.texture_indices[texture_index]
+                                                             : INVALID_INDEX_U32;
+            }
+        }
+    }
+
+    void Scene::add_scene_model_to_scene_resources(SceneModel &scene_model)
+    {
+        scene_model.material_indices.clear();
+        for (const auto i : std::views::iota(size_t{0u}, scene_model.material_buffers.size()))
+        {
+            update_texture_srv_indices(scene_model.material_buffers[i], scene_model.material_texture_indices[i]);
+
+            scene_model.material_indices.push_back(
+                intern_material_buffer(scene_model.material_buffers[i], scene_model.material_texture_indices[i]));
+        }
+
+        scene_model.mesh_buffers.clear();
+
+        if (const auto model_data = std::get_if<std::shared_ptr<const asset::ModelData>>(&scene_model.model))
+        {
+            for (const auto &mesh_data : (*model_data)->mesh_data)
+            {
+                const auto quantized_vertex_data = mesh_data.quantized_vertex_data.positions.empty()
+                                                       ? nullptr
+                                                       : &mesh_data.quantized_vertex_data;
+
+                auto lods = std::vector<SceneMeshLodView>{};
+                for (const auto &lod : mesh_data.lods)
+                {
+                    lods.emplace_back(SceneMeshLodView{
+                        .indices = std::span<const uint32_t>(lod.indices),
+                        .error = lod.error,
+                    });
+                }
+
+                add_mesh_to_scene_resources(scene_model,
+                                            SceneMeshView{
+                                                .positions = mesh_data.positions,
+                                                .normals = mesh_data.normals,
+                                                .texture_coords = mesh_data.texture_coords,
+                                                .indices = std::span<const uint32_t>(mesh_data.indices),
+                                                .index_format = mesh_data.index_format,
+                                                .meshlets = mesh_data.meshlet_data.meshlets,
+                                                .meshlet_vertices = mesh_data.meshlet_data.vertices,
+                                                .meshlet_triangles = mesh_data.meshlet_data.triangles,
+                                                .lods = std::move(lods),
+                                                .bounding_sphere = mesh_data.bounding_sphere,
+                                                .bounding_box_min = mesh_data.bounding_box_min,
+                                                .bounding_box_max = mesh_data.bounding_box_max,
+                                                .quantized_vertex_data = quantized_vertex_data,
+                                                .mesh_local_transform_matrix = mesh_data.mesh_local_transform_matrix,
+                                                .inverse_mesh_local_transform_matrix =
+                                                    mesh_data.inverse_mesh_local_transform_matrix,
+                                                .material_index = mesh_data.material_index,
+                                            });
+            }
+        }
+        else if (const auto cooked_model = std::get_if<std::shared_ptr<const asset::CookedModel>>(&scene_model.model))
+        {
+            // The streams are read directly from the memory mapped cooked model file.
+            for (const auto &mesh : (*cooked_model)->get_meshes())
+            {
+                auto lods = std::vector<SceneMeshLodView>{};
+                for (const auto &lod : (*cooked_model)->get_lods(mesh))
+                {
+                    lods.emplace_back(SceneMeshLodView{
+                        .indices = (*cooked_model)->get_lod_indices(mesh, lod),
+                        .error = lod.error,
+                    });
+                }
+
+                add_mesh_to_scene_resources(
+                    scene_model, SceneMeshView{
+                                     .positions = (*cooked_model)->get_positions(mesh),
+                                     .normals = (*cooked_model)->get_normals(mesh),
+                                     .texture_coords = (*cooked_model)->get_texture_coords(mesh),
+                                     .indices = (*cooked_model)->get_indices(mesh),
+                                     .index_format = mesh.index_format,
+                                     .meshlets = (*cooked_model)->get_meshlets(mesh),
+                                     .meshlet_vertices = (*cooked_model)->get_meshlet_vertices(mesh),
+                                     .meshlet_triangles = (*cooked_model)->get_meshlet_triangles(mesh),
+                                     .lods = std::move(lods),
+                                     .bounding_sphere = mesh.bounding_sphere,
+                                     .bounding_box_min = mesh.bounding_box_min,
+                                     .bounding_box_max = mesh.bounding_box_max,
+                                     .mesh_local_transform_matrix =
+                                         math::XMLoadFloat4x4(&mesh.mesh_local_transform_matrix),
+                                     .inverse_mesh_local_transform_matrix =
+                                         math::XMLoadFloat4x4(&mesh.inverse_mesh_local_transform_matrix),
+                                     .material_index = mesh.material_index,
+                                 });
+            }
+        }
+    }
+
+    void Scene::add_mesh_to_scene_resources(SceneModel &scene_model, const SceneMeshView &mesh)
+    {
+        // Append indices to the scene index buffer of the mesh's index format (model data indices are always 32 bit,
+        // and are narrowed if the mesh uses 16 bit indices). Returns the offset of the indices in the index buffer.
+        const auto add_indices = [&](const asset::IndicesView &indices) {
+            return std::visit(
+                [&](const auto typed_indices) {
+                    const auto add_indices_to = [&]<typename T>(std::vector<T> &scene_indices) {
+                        const auto indices_offset = static_cast<uint32_t>(scene_indices.size());
+                        std::transform(typed_indices.begin(), typed_indices.end(), std::back_inserter(scene_indices),
+                                       [](const auto index) { return static_cast<T>(index); });
+
+                        return indices_offset;
+                    };
+
+                    return mesh.index_format == asset::IndexFormat::Uint32
+                               ? add_indices_to(m_scene_resources.indices_32)
+                               : add_indices_to(m_scene_resources.indices);
+                },
+                indices);
+        };
+
+        // Setup mesh_part.
+        auto mesh_buffer = interop::MeshBuffer{
+            .position_offset = static_cast<uint32_t>(m_scene_resources.positions.size()),
+            .normal_offset = static_cast<uint32_t>(m_scene_resources.normals.size()),
+            .texture_coord_offset = static_cast<uint32_t>(m_scene_resources.texture_coords.size()),
+
+            .indices_count = get_index_count(mesh.indices),
+
+            .lod_offset = static_cast<uint32_t>(m_scene_resources.mesh_lods.size()),
+
+            .mesh_local_transform_matrix = mesh.mesh_local_transform_matrix,
+            .inverse_mesh_local_transform_matrix = mesh.inverse_mesh_local_transform_matrix,
+
+            .material_index = scene_model.material_indices.at(mesh.material_index),
+
+            .meshlet_offset = static_cast<uint32_t>(m_scene_resources.meshlets.size()),
+            .meshlet_count = static_cast<uint32_t>(mesh.meshlets.size()),
+
+            .lod_count = static_cast<uint32_t>(mesh.lods.size()),
+
+            .bounding_sphere = mesh.bounding_sphere,
+
+            .bounding_box_min = mesh.bounding_box_min,
+            .bounding_box_max = mesh.bounding_box_max,
+
+            .index_format = static_cast<uint32_t>(mesh.index_format),
+        };
+
+        // Add data to the scene buffers. The vertex offsets of quantized meshes are into the quantized vertex buffers.
+        if (const auto quantized_vertex_data = mesh.quantized_vertex_data)
+        {
+            mesh_buffer.position_offset = static_cast<uint32_t>(m_scene_resources.quantized_positions.size());
+            mesh_buffer.normal_offset = static_cast<uint32_t>(m_scene_resources.quantized_normals.size());
+            mesh_buffer.texture_coord_offset = static_cast<uint32_t>(m_scene_resources.quantized_texture_coords.size());
+
+            mesh_buffer.position_dequantization_offset = quantized_vertex_data->position_dequantization_offset;
+            mesh_buffer.position_dequantization_scale = quantized_vertex_data->position_dequantization_scale;
+            mesh_buffer.vertices_quantized = 1u;
+
+            static_assert(static_cast<uint32_t>(asset::NormalEncoding::Snorm8) == interop::NORMAL_ENCODING_SNORM8 &&
+                          static_cast<uint32_t>(asset::NormalEncoding::Snorm16) == interop::NORMAL_ENCODING_SNORM16);
+            static_assert(static_cast<uint32_t>(asset::TextureCoordEncoding::Unorm16) ==
+                          interop::TEXTURE_COORD_ENCODING_UNORM16);
+
+            mesh_buffer.normal_encoding = static_cast<uint32_t>(quantized_vertex_data->normal_encoding);
+            mesh_buffer.texture_coord_encoding = static_cast<uint32_t>(quantized_vertex_data->texture_coord_encoding);
+            mesh_buffer.texture_coord_dequantization_offset =
+                quantized_vertex_data->texture_coord_dequantization_offset;
+            mesh_buffer.texture_coord_dequantization_scale = quantized_vertex_data->texture_coord_dequantization_scale;
+
+            m_scene_resources.quantized_positions.insert(m_scene_resources.quantized_positions.end(),
+                                                         quantized_vertex_data->positions.begin(),
+                                                         quantized_vertex_data->positions.end());
+            m_scene_resources.quantized_normals.insert(m_scene_resources.quantized_normals.end(),
+                                                       quantized_vertex_data->normals.begin(),
+                                                       quantized_vertex_data->normals.end());
+            m_scene_resources.quantized_texture_coords.insert(m_scene_resources.quantized_texture_coords.end(),
+                                                              quantized_vertex_data->texture_coords.begin(),
+                                                              quantized_vertex_data->texture_coords.end());
+        }
+        else
+        {
+            m_scene_resources.positions.insert(m_scene_resources.positions.end(), mesh.positions.begin(),
+                                               mesh.positions.end());
+            m_scene_resources.normals.insert(m_scene_resources.normals.end(), mesh.normals.begin(),
+                                             mesh.normals.end());
+            m_scene_resources.texture_coords.insert(m_scene_resources.texture_coords.end(),
+                                                    mesh.texture_coords.begin(), mesh.texture_coords.end());
+        }
+
+        mesh_buffer.indices_offset = add_indices(mesh.indices);
+
+        scene_model.mesh_buffers.emplace_back(mesh_buffer);
+
+        // The LOD indices reference the vertices of the full detail mesh, so no vertex data has to be added for them.
+        for (const auto &lod : mesh.lods)
+        {
+            m_scene_resources.mesh_lods.emplace_back(interop::MeshLodBuffer{
+                .indices_offset = add_indices(lod.indices),
+                .indices_count = get_index_count(lod.indices),
+                .error = lod.error,
+            });
+        }
+
+        // The meshlet offsets are relative to the mesh's meshlet vertex / triangle ranges, so rebase them onto the
+        // scene meshlet streams. The meshlet vertices themselves stay relative to the mesh's position offset.
+        const auto meshlet_vertex_offset = static_cast<uint32_t>(m_scene_resources.meshlet_vertices.size());
+        const auto meshlet_triangle_offset = static_cast<uint32_t>(m_scene_resources.meshlet_triangles.size());
+
+        for (const auto &meshlet : mesh.meshlets)
+        {
+            m_scene_resources.meshlets.emplace_back(interop::MeshletBuffer{
+                .vertex_offset = meshlet_vertex_offset + meshlet.vertex_offset,
+                .triangle_offset = meshlet_triangle_offset + meshlet.triangle_offset,
+                .vertex_count = meshlet.vertex_count,
+                .triangle_count = meshlet.triangle_count,
+                .center = meshlet.center,
+                .radius = meshlet.radius,
+                .cone_axis = meshlet.cone_axis,
+                .cone_cutoff = meshlet.cone_cutoff,
+                .cone_apex = meshlet.cone_apex,
+            });
+        }
+
+        m_scene_resources.meshlet_vertices.insert(m_scene_resources.meshlet_vertices.end(),
+                                                  mesh.meshlet_vertices.begin(), mesh.meshlet_vertices.end());
+        m_scene_resources.meshlet_triangles.insert(m_scene_resources.meshlet_triangles.end(),
+                                                   mesh.meshlet_triangles.begin(), mesh.meshlet_triangles.end());
+    }
+
+    void Scene::select_mesh_lods(const math::XMMATRIX projection_matrix)
+    {
+        using namespace math;
+
+        auto &scene_rsc = m_scene_resources;
+        scene_rsc.selected_mesh_lods.assign(scene_rsc.mesh_buffers.size(), 0u);
+
+        // The projection matrix's [1][1] element is cot(fov_y / 2), and NDC space spans 2 units vertically, so error *
+        // scale * projection_scale / distance is the projected error of a LOD as a fraction of the screen height.
+        const auto projection_scale = XMVectorGetY(projection_matrix.r[1]) * 0.5f;
+        const auto camera_position = XMLoadFloat3(&scene_rsc.scene_buffer.camera_position);
+
+        for (const auto &[name, game_object] : m_game_objects)
+        {
+            const auto &model_matrix = game_object.transform_component.transform_buffer_data.model_matrix;
+
+            for (const auto i : std::views::iota(game_object.mesh_buffer_offset,
+                                                 game_object.mesh_buffer_offset + game_object.mesh_count))
+            {
+                const auto &mesh_buffer = scene_rsc.mesh_buffers[i];
+                if (mesh_buffer.lod_count == 0u)
+                {
+                    continue;
+                }
+
+                const auto world_matrix = mesh_buffer.mesh_local_transform_matrix * model_matrix;
+
+                // Conservative (i.e largest) scale of the world matrix, used to scale the bounding sphere radius and
+                // the LOD errors.
+                const auto scale = std::sqrt(std::max({XMVectorGetX(XMVector3LengthSq(world_matrix.r[0])),
+                                                       XMVectorGetX(XMVector3LengthSq(world_matrix.r[1])),
+                                                       XMVectorGetX(XMVector3LengthSq(world_matrix.r[2]))}));
+
+                const auto center = XMVector3Transform(XMLoadFloat4(&mesh_buffer.bounding_sphere), world_matrix);
+                const auto radius = mesh_buffer.bounding_sphere.w * scale;
+
+                // If the camera is inside the bounding sphere, the full detail mesh is used.
+                const auto distance = XMVectorGetX(XMVector3Length(center - camera_position)) - radius;
+                if (distance <= 0.0f)
+                {
+                    continue;
+                }
+
+                // LODs are sorted by increasing error, so select the coarsest LOD whose projected error is acceptable.
+                for (const auto lod_index : std::views::iota(0u, mesh_buffer.lod_count))
+                {
+                    const auto &lod = scene_rsc.mesh_lods[mesh_buffer.lod_offset + lod_index];
+                    if (lod.error * scale * projection_scale / distance > LOD_SCREEN_SPACE_ERROR_THRESHOLD)
+                    {
+                        break;
+                    }
+
+                    scene_rsc.selected_mesh_lods[i] = lod_index + 1u;
+                }
+            }
+        }
+    }
+
+    void Scene::request_texture_mips(const math::XMMATRIX projection_matrix)
+    {
+        using namespace math;
+
+        const auto &scene_rsc = m_scene_resources;
+
+        // Projected size (in pixels) of a unit length at a distance of one unit (see select_mesh_lods).
+        const auto projection_scale =
+            XMVectorGetY(projection_matrix.r[1]) * 0.5f *
+            static_cast<float>(renderer::Renderer::instance().get_render_area_dimensions().y);
+        const auto camera_position = XMLoadFloat3(&scene_rsc.scene_buffer.camera_position);
+
+        for (const auto &[name, game_object] : m_game_objects)
+        {
+            const auto &model_matrix = game_object.transform_component.transform_buffer_data.model_matrix;
+
+            for (const auto i : std::views::iota(game_object.mesh_buffer_offset,
+                                                 game_object.mesh_buffer_offset + game_object.mesh_count))
+            {
+                const auto &mesh_buffer = scene_rsc.mesh_buffers[i];
+
+                const auto world_matrix = mesh_buffer.mesh_local_transform_matrix * model_matrix;
+                const auto scale = std::sqrt(std::max({XMVectorGetX(XMVector3LengthSq(world_matrix.r[0])),
+                                                       XMVectorGetX(XMVector3LengthSq(world_matrix.r[1])),
+                                                       XMVectorGetX(XMVector3LengthSq(world_matrix.r[2]))}));
+
+                const auto center = XMVector3Transform(XMLoadFloat4(&mesh_buffer.bounding_sphere), world_matrix);
+                const auto radius = mesh_buffer.bounding_sphere.w * scale;
+
+                // The textures are assumed to be mapped once across the mesh, so the required resolution is the
+                // projected diameter of the bounding sphere (textures that repeat across the mesh are underestimated).
+                // If the camera is inside the bounding sphere, the full resolution is required.
+                const auto distance = XMVectorGetX(XMVector3Length(center - camera_position)) - radius;
+                auto required_resolution = distance > 0.0f ? 2.0f * radius * projection_scale / distance
+                                                           : std::numeric_limits<float>::max();
+
+                // Materials whose textures are in a texture atlas only use part of the texture.
+                const auto &texture_coord_transform =
+                    scene_rsc.material_buffers[mesh_buffer.material_index].texture_coord_transform;
+                const auto texture_coord_scale = std::min(texture_coord_transform.x, texture_coord_transform.y);
+
+                if (texture_coord_scale > 0.0f && texture_coord_scale < 1.0f)
+                {
+                    required_resolution /= texture_coord_scale;
+                }
+
+                for (const auto texture_index : m_material_texture_indices[mesh_buffer.material_index])
+                {
+                    if (texture_index != INVALID_INDEX_U32)
+                    {
+                        renderer::Renderer::instance().mark_texture_as_used(texture_index, required_resolution);
+                    }
+                }
+            }
+        }
+    }
+
+    uint32_t Scene::create_texture(const std::wstring_view texture_name, const SceneTextureView &texture,
+                                   const bool is_srgb, std::vector<uint32_t> &texture_indices)
+    {
+        const auto texture_index = renderer::Renderer::instance().create_texture(
+            renderer::rhi::TextureCreationDesc{
+                .usage = renderer::rhi::TextureUsage::ShaderResourceTexture,
+                .format = get_texture_format(texture.compression, is_srgb),
+                .mip_levels = texture.mip_levels,
+                .bytes_per_pixel = 4u,
+                .dimension = texture.dimension,
+                .name = std::wstring(texture_name),
+            },
+            texture.data_source().get(), texture.data_source);
+
+        texture_indices.push_back(texture_index);
+
+        return renderer::Renderer::instance().get_texture_at_index(texture_index).srv_index;
+    }
+
+    interop::MaterialBuffer Scene::create_material_buffer(const SceneMaterialView &material,
+                                                          const std::span<const uint32_t> texture_srv_indices)
+    {
+        const auto get_texture_srv_index = [&](const asset::MaterialTextureType texture_type) {
+            const auto texture_index = material.texture_indices[static_cast<uint32_t>(texture_type)];
+            return texture_index < texture_srv_indices.size() ? texture_srv_indices[texture_index] : INVALID_INDEX_U32;
+        };
+
+        return interop::MaterialBuffer{
+            .base_color = material.base_color,
+            .texture_coord_transform = material.texture_coord_transform,
+            .metallic_roughness_factor = material.metallic_roughness_factor,
+            .albedo_texture_srv_index = get_texture_srv_index(asset::MaterialTextureType::BaseColor),
+            .normal_texture_srv_index = get_texture_srv_index(asset::MaterialTextureType::Normal),
+            .emissive_factor = material.emissive_factor,
+            .occlusion_roughness_metallic_texture_srv_index =
+                get_texture_srv_index(asset::MaterialTextureType::OcclusionRoughnessMetallic),
+            .emissive_texture_srv_index = get_texture_srv_index(asset::MaterialTextureType::Emissive),
+            .normal_scale = material.normal_scale,
+            .occlusion_strength = material.occlusion_strength,
+        };
+    }
+
+    bool Scene::update_texture_srv_indices(
+        interop::MaterialBuffer &material_buffer,
+        const std::array<uint32_t, asset::MATERIAL_TEXTURE_TYPE_COUNT> &material_texture_indices)
+    {
+        auto srv_indices_changed = false;
+
+        const auto update_texture_srv_index = [&](uint32_t &texture_srv_index,
+                                                  const asset::MaterialTextureType texture_type) {
+            const auto texture_index = material_texture_indices[static_cast<uint32_t>(texture_type)];
+            if (texture_index == INVALID_INDEX_U32)
+            {
+                return;
+            }
+
+            const auto srv_index = renderer::Renderer::instance().get_texture_at_index(texture_index).srv_index;
+            if (texture_srv_index != srv_index)
+            {
+                texture_srv_index = srv_index;
+                srv_indices_changed = true;
+            }
+        };
+
+        update_texture_srv_index(material_buffer.albedo_texture_srv_index, asset::MaterialTextureType::BaseColor);
+        update_texture_srv_index(material_buffer.normal_texture_srv_index, asset::MaterialTextureType::Normal);
+        update_texture_srv_index(material_buffer.occlusion_roughness_metallic_texture_srv_index,
+                                 asset::MaterialTextureType::OcclusionRoughnessMetallic);
+        update_texture_srv_index(material_buffer.emissive_texture_srv_index, asset::MaterialTextureType::Emissive);
+
+        return srv_indices_changed;
+    }
+
+    uint32_t Scene::intern_material_buffer(
+        const interop::MaterialBuffer &material_buffer,
+        const std::array<uint32_t, asset::MATERIAL_TEXTURE_TYPE_COUNT> &material_texture_indices)
+    {
+        const auto hash = get_material_buffer_hash(material_buffer);
+
+        const auto [begin, end] = m_material_buffer_indices.equal_range(hash);
+        for (auto itr = begin; itr != end; ++itr)
+        {
+            if (std::memcmp(&m_scene_resources.material_buffers[itr->second], &material_buffer,
+                            sizeof(interop::MaterialBuffer)) == 0)
+            {
+                return itr->second;
+            }
+        }
+
+        const auto material_index = static_cast<uint32_t>(m_scene_resources.material_buffers.size());
+        m_scene_resources.material_buffers.push_back(material_buffer);
+        m_material_buffer_indices.emplace(hash, material_index);
+        m_material_texture_indices.push_back(material_texture_indices);
+
+        return material_index;
     }
 } // namespace serenity::scene
\ No newline at end of file
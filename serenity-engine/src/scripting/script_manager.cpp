@@ -27,7 +27,7 @@ namespace serenity::scripting
         const auto script_path = core::FileSystem::instance().get_absolute_path(script.script_path);
 
         if (const auto itr = std::find_if(m_scripts.begin(), m_scripts.end(),
-                                          [&](const auto a) { return a.script_path == script_path; });
+                                          [&](const auto &a) { return a.script_path == script_path; });
             itr != m_scripts.end())
         {
             return std::distance(m_scripts.begin(), itr);
@@ -35,7 +35,13 @@ namespace serenity::scripting
 
         const auto script_index = m_scripts.size();
 
-        m_scripts.emplace_back(script);
+        auto &new_script = m_scripts.emplace_back(Script{
+            .script_name = script.script_name,
+            .script_path = script_path,
+            .execute_on_load = script.execute_on_load,
+        });
+
+        load_script(new_script);
 
         core::Log::instance().info(std::format("Created script with path : {}", script_path));
 
@@ -44,13 +50,71 @@ namespace serenity::scripting
 
     void ScriptManager::execute_script(const uint32_t script_index)
     {
-        m_lua.script_file(m_scripts.at(script_index).script_path, [&](lua_State *, sol::protected_function_result pfr) {
-            if (const auto script_path = m_scripts.at(script_index).script_path; !pfr.valid())
+        auto &script = m_scripts.at(script_index);
+        if (!script.chunk.valid())
+        {
+            core::Log::instance().warn(std::format("Script {} has no valid compiled chunk", script.script_path));
+            return;
+        }
+
+        if (const sol::protected_function_result result = script.chunk(); !result.valid())
+        {
+            const sol::error error = result;
+            core::Log::instance().warn(std::format("Error in script : {}\n{}", script.script_path, error.what()));
+        }
+    }
+
+    void ScriptManager::reload_modified_scripts()
+    {
+        for (auto &script : m_scripts)
+        {
+            auto error_code = std::error_code{};
+            const auto last_write_time = std::filesystem::last_write_time(script.script_path, error_code);
+
+            if (!error_code && last_write_time != script.last_write_time)
             {
-                core::Log::instance().warn(std::format("Error in script : {}", script_path));
+                load_script(script);
+                core::Log::instance().info(std::format("Reloaded modified script with path : {}", script.script_path));
             }
+        }
+    }
 
-            return pfr;
-        });
+    void ScriptManager::load_script(Script &script)
+    {
+        auto error_code = std::error_code{};
+        script.last_write_time = std::filesystem::last_write_time(script.script_path, error_code);
+
+        // Compile the script. If compilation fails (for ex. due to a syntax error introduced while editing the script
+        // in the editor), the previously compiled chunk (if any) is retained.
+        const sol::load_result load_result = m_lua.load_file(script.script_path);
+        if (!load_result.valid())
+        {
+            const sol::error error = load_result;
+            core::Log::instance().warn(
+                std::format("Failed to compile script : {}\n{}", script.script_path, error.what()));
+            return;
+        }
+
+        // Each script gets its own environment. Reads fall back to the global table (for the engine provided functions
+        // and usertypes), while writes go into the script's environment.
+        script.environment = sol::environment(m_lua, sol::create, m_lua.globals());
+
+        script.chunk = load_result.get<sol::protected_function>();
+        sol::set_environment(script.environment, script.chunk);
+
+        script.update_function = sol::protected_function{};
+        if (!script.execute_on_load)
+        {
+            return;
+        }
+
+        execute_script(static_cast<uint32_t>(std::distance(m_scripts.data(), &script)));
+
+        // Cache the update function (raw_get so that a function in the global table is not picked up instead).
+        if (const auto update_function = script.environment.raw_get<sol::object>("update_transform");
+            update_function.get_type() == sol::type::function)
+        {
+            script.update_function = update_function.as<sol::protected_function>();
+        }
     }
 } // namespace serenity::scripting
\ No newline at end of file
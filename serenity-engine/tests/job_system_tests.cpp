@@ -0,0 +1,312 @@
+#include "test_framework.hpp"
+
+#include "serenity-engine/core/job_system.hpp"
+
+using namespace serenity;
+
+namespace
+{
+    constexpr auto WORKER_THREAD_COUNT = 3u;
+} // namespace
+
+SERENITY_TEST(job_system, work_stealing_queue_order)
+{
+    auto queue = std::make_unique<core::WorkStealingQueue>();
+    auto jobs = std::array<core::Job, 3u>{};
+
+    CHECK(queue->pop() == nullptr);
+    CHECK(queue->steal() == nullptr);
+
+    for (auto &job : jobs)
+    {
+        CHECK(queue->push(&job));
+    }
+
+    // The owning thread pops the most recently pushed job, while other threads steal the oldest job.
+    CHECK(queue->pop() == &jobs[2]);
+    CHECK(queue->steal() == &jobs[0]);
+    CHECK(queue->pop() == &jobs[1]);
+    CHECK(queue->pop() == nullptr);
+    CHECK(queue->steal() == nullptr);
+}
+
+SERENITY_TEST(job_system, work_stealing_queue_full)
+{
+    auto queue = std::make_unique<core::WorkStealingQueue>();
+    auto jobs = std::vector<core::Job>(core::WorkStealingQueue::CAPACITY + 1u);
+
+    for (const auto i : std::views::iota(int64_t{0}, core::WorkStealingQueue::CAPACITY))
+    {
+        CHECK(queue->push(&jobs[i]));
+    }
+
+    CHECK(!queue->push(&jobs.back()));
+
+    // Stealing a job frees up a slot (the queue is a ring buffer).
+    CHECK(queue->steal() == &jobs[0]);
+    CHECK(queue->push(&jobs.back()));
+    CHECK(queue->pop() == &jobs.back());
+}
+
+SERENITY_TEST(job_system, work_stealing_queue_races)
+{
+    // The owning thread pushes and pops jobs while other threads steal them. Every job must be taken exactly once.
+    constexpr auto JOB_COUNT = 200'000u;
+    constexpr auto STEALING_THREAD_COUNT = 3u;
+
+    auto queue = std::make_unique<core::WorkStealingQueue>();
+    auto jobs = std::vector<core::Job>(JOB_COUNT);
+    auto job_taken_counts = std::vector<std::atomic<uint32_t>>(JOB_COUNT);
+
+    const auto take_job = [&](const core::Job *job) {
+        job_taken_counts[static_cast<size_t>(job - jobs.data())].fetch_add(1u, std::memory_order_relaxed);
+    };
+
+    auto taken_job_count = std::atomic<uint32_t>{0u};
+    auto stealing_threads = std::vector<std::thread>{};
+
+    for ([[maybe_unused]] const auto i : std::views::iota(0u, STEALING_THREAD_COUNT))
+    {
+        stealing_threads.emplace_back([&]() {
+            while (taken_job_count.load(std::memory_order_relaxed) < JOB_COUNT)
+            {
+                if (const auto job = queue->steal(); job)
+                {
+                    take_job(job);
+                    taken_job_count.fetch_add(1u, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (auto i = 0u; i < JOB_COUNT; ++i)
+    {
+        while (!queue->push(&jobs[i]))
+        {
+            std::this_thread::yield();
+        }
+
+        // Pop every other job, so that the owning thread often races the stealing threads for the last job.
+        if (i % 2u == 0u)
+        {
+            if (const auto job = queue->pop(); job)
+            {
+                take_job(job);
+                taken_job_count.fetch_add(1u, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    while (const auto job = queue->pop())
+    {
+        take_job(job);
+        taken_job_count.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    for (auto &stealing_thread : stealing_threads)
+    {
+        stealing_thread.join();
+    }
+
+    CHECK(taken_job_count.load() == JOB_COUNT);
+    CHECK(std::all_of(job_taken_counts.begin(), job_taken_counts.end(),
+                      [](const std::atomic<uint32_t> &count) { return count.load() == 1u; }));
+}
+
+SERENITY_TEST(job_system, counter_wait)
+{
+    auto job_system = core::JobSystem(WORKER_THREAD_COUNT);
+    CHECK(job_system.get_thread_count() == WORKER_THREAD_COUNT + 1u);
+
+    constexpr auto JOB_COUNT = 10'000u;
+
+    auto executed_job_count = std::atomic<uint32_t>{0u};
+    auto counter = core::JobCounter{};
+    CHECK(counter.is_complete());
+
+    for ([[maybe_unused]] const auto i : std::views::iota(0u, JOB_COUNT))
+    {
+        job_system.schedule([&]() { executed_job_count.fetch_add(1u, std::memory_order_relaxed); }, counter);
+    }
+
+    job_system.wait(counter);
+
+    CHECK(counter.is_complete());
+    CHECK(executed_job_count.load() == JOB_COUNT);
+
+    // Waiting on a counter with no jobs returns immediately.
+    auto empty_counter = core::JobCounter{};
+    job_system.wait(empty_counter);
+}
+
+SERENITY_TEST(job_system, counter_wait_rethrows_exception)
+{
+    auto job_system = core::JobSystem(WORKER_THREAD_COUNT);
+
+    auto executed_job_count = std::atomic<uint32_t>{0u};
+    auto counter = core::JobCounter{};
+
+    for (const auto i : std::views::iota(0u, 64u))
+    {
+        job_system.schedule(
+            [&, i]() {
+                executed_job_count.fetch_add(1u);
+                if (i == 17u)
+                {
+                    throw std::runtime_error("Job failed");
+                }
+            },
+            counter);
+    }
+
+    CHECK_THROWS(job_system.wait(counter));
+
+    // The remaining jobs are still executed, and the exception is only rethrown once.
+    CHECK(counter.is_complete());
+    CHECK(executed_job_count.load() == 64u);
+    job_system.wait(counter);
+}
+
+SERENITY_TEST(job_system, wait_from_within_job)
+{
+    // The threads waiting on a counter execute jobs while waiting, so jobs waiting on other jobs do not deadlock
+    // (even if there are more waiting jobs than threads).
+    auto job_system = core::JobSystem(1u);
+
+    auto executed_job_count = std::atomic<uint32_t>{0u};
+    auto counter = core::JobCounter{};
+
+    for ([[maybe_unused]] const auto i : std::views::iota(0u, 8u))
+    {
+        job_system.schedule(
+            [&]() {
+                auto inner_counter = core::JobCounter{};
+                for ([[maybe_unused]] const auto j : std::views::iota(0u, 8u))
+                {
+                    job_system.schedule([&]() { executed_job_count.fetch_add(1u); }, inner_counter);
+                }
+
+                job_system.wait(inner_counter);
+            },
+            counter);
+    }
+
+    job_system.wait(counter);
+    CHECK(executed_job_count.load() == 64u);
+}
+
+SERENITY_TEST(job_system, parallel_for)
+{
+    auto job_system = core::JobSystem(WORKER_THREAD_COUNT);
+
+    for (const auto count : {size_t{0u}, size_t{1u}, size_t{7u}, size_t{100'000u}})
+    {
+        for (const auto batch_size : {size_t{0u}, size_t{1u}, size_t{64u}})
+        {
+            auto call_counts = std::vector<std::atomic<uint32_t>>(count);
+            job_system.parallel_for(count, [&](const size_t index) { call_counts[index].fetch_add(1u); }, batch_size);
+
+            CHECK(std::all_of(call_counts.begin(), call_counts.end(),
+                              [](const std::atomic<uint32_t> &call_count) { return call_count.load() == 1u; }));
+        }
+    }
+
+    auto data = std::vector<uint32_t>(1000u);
+    job_system.parallel_for(std::span(data), [](uint32_t &element, const size_t index) {
+        element = static_cast<uint32_t>(index * 2u);
+    });
+
+    for (const auto i : std::views::iota(size_t{0u}, data.size()))
+    {
+        CHECK(data[i] == i * 2u);
+    }
+
+    CHECK_THROWS(job_system.parallel_for(100u, [](const size_t index) {
+        if (index == 99u)
+        {
+            throw std::runtime_error("Iteration failed");
+        }
+    }));
+}
+
+SERENITY_TEST(job_system, nested_parallel_for)
+{
+    auto job_system = core::JobSystem(WORKER_THREAD_COUNT);
+
+    constexpr auto OUTER_COUNT = size_t{64u};
+    constexpr auto INNER_COUNT = size_t{1000u};
+
+    auto sums = std::vector<uint64_t>(OUTER_COUNT);
+    job_system.parallel_for(
+        OUTER_COUNT,
+        [&](const size_t i) {
+            auto sum = std::atomic<uint64_t>{0u};
+            job_system.parallel_for(
+                INNER_COUNT, [&](const size_t j) { sum.fetch_add(i * INNER_COUNT + j, std::memory_order_relaxed); },
+                16u);
+
+            sums[i] = sum.load();
+        },
+        1u);
+
+    for (const auto i : std::views::iota(size_t{0u}, OUTER_COUNT))
+    {
+        // Sum of [i * INNER_COUNT, (i + 1) * INNER_COUNT).
+        const auto expected_sum = i * INNER_COUNT * INNER_COUNT + INNER_COUNT * (INNER_COUNT - 1u) / 2u;
+        CHECK(sums[i] == expected_sum);
+    }
+}
+
+SERENITY_TEST(job_system, schedule_from_external_threads)
+{
+    // Threads not owned by the job system (for ex. the async file loader's thread) schedule jobs into the shared
+    // queue, and execute jobs from it while waiting.
+    auto job_system = core::JobSystem(WORKER_THREAD_COUNT);
+
+    constexpr auto EXTERNAL_THREAD_COUNT = 4u;
+    constexpr auto JOB_COUNT_PER_THREAD = 5'000u;
+
+    auto executed_job_counts = std::array<std::atomic<uint32_t>, EXTERNAL_THREAD_COUNT>{};
+    auto counter_completed = std::array<bool, EXTERNAL_THREAD_COUNT>{};
+
+    auto external_threads = std::vector<std::thread>{};
+    for (const auto i : std::views::iota(0u, EXTERNAL_THREAD_COUNT))
+    {
+        external_threads.emplace_back([&, i]() {
+            auto counter = core::JobCounter{};
+            for ([[maybe_unused]] const auto j : std::views::iota(0u, JOB_COUNT_PER_THREAD))
+            {
+                job_system.schedule([&, i]() { executed_job_counts[i].fetch_add(1u); }, counter);
+            }
+
+            job_system.wait(counter);
+            counter_completed[i] = counter.is_complete();
+
+            // parallel_for is usable from external threads as well.
+            job_system.parallel_for(JOB_COUNT_PER_THREAD, [&, i](size_t) { executed_job_counts[i].fetch_add(1u); });
+        });
+    }
+
+    // Jobs scheduled by an external thread that never waits are executed by the worker threads.
+    auto detached_job_executed = std::atomic<bool>{false};
+    auto detached_counter = core::JobCounter{};
+    std::thread([&]() { job_system.schedule([&]() { detached_job_executed.store(true); }, detached_counter); }).join();
+
+    for (auto &external_thread : external_threads)
+    {
+        external_thread.join();
+    }
+
+    while (!detached_counter.is_complete())
+    {
+        std::this_thread::yield();
+    }
+
+    CHECK(detached_job_executed.load());
+
+    for (const auto i : std::views::iota(0u, EXTERNAL_THREAD_COUNT))
+    {
+        CHECK(counter_completed[i]);
+        CHECK(executed_job_counts[i].load() == JOB_COUNT_PER_THREAD * 2u);
+    }
+}
\ No newline at end of file
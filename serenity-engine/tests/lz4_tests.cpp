@@ -0,0 +1,103 @@
+#include "test_framework.hpp"
+
+#include "serenity-engine/core/lz4.hpp"
+
+using namespace serenity;
+
+namespace
+{
+    // Deterministic pseudo random bytes (incompressible).
+    std::vector<std::byte> create_random_data(const size_t size)
+    {
+        auto data = std::vector<std::byte>(size);
+
+        auto state = uint32_t{0x12345678u};
+        for (auto &byte : data)
+        {
+            state = state * 1664525u + 1013904223u;
+            byte = static_cast<std::byte>(state >> 24u);
+        }
+
+        return data;
+    }
+
+    // Compress the data, and check that it decompresses to the original data.
+    std::vector<std::byte> check_round_trip(const std::span<const std::byte> data)
+    {
+        const auto compressed_data = core::Lz4::compress(data);
+        CHECK(compressed_data.size() <= core::Lz4::get_max_compressed_size(data.size()));
+
+        auto decompressed_data = std::vector<std::byte>(data.size());
+        CHECK(core::Lz4::decompress(compressed_data, decompressed_data));
+        CHECK(std::ranges::equal(decompressed_data, data));
+
+        return compressed_data;
+    }
+} // namespace
+
+SERENITY_TEST(lz4, round_trip)
+{
+    // Blocks with no data or too little data for a match only have a (possibly empty) literal sequence.
+    check_round_trip({});
+    check_round_trip(create_random_data(1u));
+    check_round_trip(create_random_data(12u));
+    check_round_trip(create_random_data(13u));
+
+    // Literal lengths that need extra length bytes (15 + 255 * n).
+    for (const auto size : {15u, 270u, 525u, 100'000u})
+    {
+        check_round_trip(create_random_data(size));
+    }
+
+    // A repeated byte is encoded as a single long match that overlaps the bytes it produces (offset 1).
+    const auto repeated_data = std::vector<std::byte>(100'000u, std::byte{42u});
+    CHECK(check_round_trip(repeated_data).size() < 1'000u);
+
+    // Repeated random blocks : matches with offsets up to (and past) the maximum match offset of 65535.
+    for (const auto block_size : {7u, 64u, 4'096u, 70'000u})
+    {
+        const auto block = create_random_data(block_size);
+
+        auto data = std::vector<std::byte>{};
+        for ([[maybe_unused]] const auto i : std::views::iota(0u, 4u))
+        {
+            data.insert(data.end(), block.begin(), block.end());
+        }
+
+        check_round_trip(data);
+    }
+}
+
+SERENITY_TEST(lz4, corrupt_data)
+{
+    const auto block = create_random_data(1'000u);
+
+    auto data = std::vector<std::byte>{};
+    for ([[maybe_unused]] const auto i : std::views::iota(0u, 8u))
+    {
+        data.insert(data.end(), block.begin(), block.end());
+    }
+
+    const auto compressed_data = core::Lz4::compress(data);
+
+    // The destination must be exactly the size of the uncompressed data.
+    auto smaller_destination = std::vector<std::byte>(data.size() - 1u);
+    auto larger_destination = std::vector<std::byte>(data.size() + 1u);
+    CHECK(!core::Lz4::decompress(compressed_data, smaller_destination));
+    CHECK(!core::Lz4::decompress(compressed_data, larger_destination));
+
+    // Truncated blocks are rejected, without reading / writing out of bounds.
+    auto destination = std::vector<std::byte>(data.size());
+    for (const auto size : std::views::iota(size_t{0u}, compressed_data.size()))
+    {
+        CHECK(!core::Lz4::decompress(std::span(compressed_data).first(size), destination));
+    }
+
+    // A match offset of 0 (or one that points before the start of the output) is invalid.
+    const auto invalid_offset_data = std::array{std::byte{0x10u}, std::byte{1u}, std::byte{0u}, std::byte{0u}};
+    auto invalid_offset_destination = std::vector<std::byte>(5u);
+    CHECK(!core::Lz4::decompress(invalid_offset_data, invalid_offset_destination));
+
+    const auto out_of_bounds_offset_data = std::array{std::byte{0x10u}, std::byte{1u}, std::byte{2u}, std::byte{0u}};
+    CHECK(!core::Lz4::decompress(out_of_bounds_offset_data, invalid_offset_destination));
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "test_framework.hpp"
+
+#include "serenity-engine/core/file_system.hpp"
+
+// serenity-engine-core-tests : Unit tests of the core systems and the asset pipeline. Must be run from within the
+// project directory (ctest does so).
+//
+// Usage : serenity-engine-core-tests [test group ...]
+// If no test groups are given, all tests are run. Returns a non zero exit code if any test failed.
+
+using namespace serenity;
+
+namespace serenity::tests
+{
+    std::vector<Test> &get_tests()
+    {
+        static auto tests = std::vector<Test>{};
+        return tests;
+    }
+} // namespace serenity::tests
+
+int main(int argc, char **argv)
+{
+    const auto test_groups = std::vector<std::string_view>(argv + 1, argv + argc);
+
+    const auto log = std::make_unique<core::Log>(true, false);
+    const auto file_system = std::make_unique<core::FileSystem>();
+
+    auto test_count = 0u;
+    auto failed_test_count = 0u;
+
+    for (const auto &test : tests::get_tests())
+    {
+        if (!test_groups.empty() && std::find(test_groups.begin(), test_groups.end(), test.group) == test_groups.end())
+        {
+            continue;
+        }
+
+        ++test_count;
+
+        // Tests create the systems they test (for ex. the job system) themselves.
+        try
+        {
+            test.function();
+            std::cout << std::format("[ PASSED ] {}.{}\n", test.group, test.name);
+        }
+        catch (const std::exception &exception)
+        {
+            ++failed_test_count;
+            std::cout << std::format("[ FAILED ] {}.{} : {}\n", test.group, test.name, exception.what());
+        }
+    }
+
+    std::cout << std::format("\n{} / {} tests passed\n", test_count - failed_test_count, test_count);
+
+    return failed_test_count == 0u ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include "test_framework.hpp"
+
+#include "serenity-engine/asset/mesh_optimizer.hpp"
+
+using namespace serenity;
+
+namespace
+{
+    struct TestMesh
+    {
+        std::vector<math::XMFLOAT3> positions{};
+        std::vector<uint32_t> indices{};
+    };
+
+    math::XMFLOAT3 subtract(const math::XMFLOAT3 &a, const math::XMFLOAT3 &b)
+    {
+        return math::XMFLOAT3(a.x - b.x, a.y - b.y, a.z - b.z);
+    }
+
+    float dot(const math::XMFLOAT3 &a, const math::XMFLOAT3 &b)
+    {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    math::XMFLOAT3 cross(const math::XMFLOAT3 &a, const math::XMFLOAT3 &b)
+    {
+        return math::XMFLOAT3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+    }
+
+    // Unit sphere with outward facing (counter clockwise) triangles.
+    TestMesh create_sphere(const uint32_t ring_count, const uint32_t segment_count)
+    {
+        auto mesh = TestMesh{};
+
+        for (const auto ring : std::views::iota(0u, ring_count + 1u))
+        {
+            for (const auto segment : std::views::iota(0u, segment_count + 1u))
+            {
+                const auto theta = math::XM_PI * static_cast<float>(ring) / static_cast<float>(ring_count);
+                const auto phi = math::XM_2PI * static_cast<float>(segment) / static_cast<float>(segment_count);
+
+                mesh.positions.emplace_back(std::sin(theta) * std::cos(phi), std::cos(theta),
+                                            std::sin(theta) * std::sin(phi));
+            }
+        }
+
+        const auto add_triangle = [&](const uint32_t a, uint32_t b, uint32_t c) {
+            const auto &position_a = mesh.positions[a];
+            const auto normal =
+                cross(subtract(mesh.positions[b], position_a), subtract(mesh.positions[c], position_a));
+
+            // Triangles touching the poles are degenerate, and are skipped.
+            if (dot(normal, normal) < 1e-12f)
+            {
+                return;
+            }
+
+            if (dot(normal, position_a) < 0.0f)
+            {
+                std::swap(b, c);
+            }
+
+            mesh.indices.insert(mesh.indices.end(), {a, b, c});
+        };
+
+        for (const auto ring : std::views::iota(0u, ring_count))
+        {
+            for (const auto segment : std::views::iota(0u, segment_count))
+            {
+                const auto vertex = ring * (segment_count + 1u) + segment;
+                add_triangle(vertex, vertex + segment_count + 1u, vertex + 1u);
+                add_triangle(vertex + 1u, vertex + segment_count + 1u, vertex + segment_count + 2u);
+            }
+        }
+
+        return mesh;
+    }
+
+    // Triangle of the meshlet, as indices into the vertices of the mesh.
+    std::array<uint32_t, 3u> get_meshlet_triangle(const asset::MeshletData &meshlet_data,
+                                                  const asset::Meshlet &meshlet, const uint32_t triangle_index)
+    {
+        const auto packed_triangle = meshlet_data.triangles[meshlet.triangle_offset + triangle_index];
+
+        return {
+            meshlet_data.vertices[meshlet.vertex_offset + (packed_triangle & 0xffu)],
+            meshlet_data.vertices[meshlet.vertex_offset + ((packed_triangle >> 8u) & 0xffu)],
+            meshlet_data.vertices[meshlet.vertex_offset + ((packed_triangle >> 16u) & 0xffu)],
+        };
+    }
+} // namespace
+
+SERENITY_TEST(mesh_optimizer, meshlet_limits)
+{
+    auto mesh = create_sphere(64u, 96u);
+    asset::MeshOptimizer::optimize_vertex_cache(mesh.indices, mesh.positions.size());
+
+    // Vertex limits above 256 are clamped, as local vertex indices are stored in 8 bits.
+    constexpr auto LIMITS = std::array<std::pair<uint32_t, uint32_t>, 5u>{
+        {{64u, 124u}, {32u, 32u}, {3u, 1u}, {128u, 256u}, {1024u, 4096u}}};
+
+    for (const auto &[max_vertices, max_triangles] : LIMITS)
+    {
+        const auto meshlet_data =
+            asset::MeshOptimizer::build_meshlets(mesh.indices, mesh.positions, max_vertices, max_triangles);
+
+        CHECK(!meshlet_data.meshlets.empty());
+
+        auto vertex_offset = 0u;
+        auto triangle_offset = 0u;
+        for (const auto &meshlet : meshlet_data.meshlets)
+        {
+            CHECK(meshlet.vertex_count >= 3u && meshlet.vertex_count <= std::min(max_vertices, 256u));
+            CHECK(meshlet.triangle_count >= 1u && meshlet.triangle_count <= max_triangles);
+
+            // The meshlets are stored back to back in the vertex / triangle streams.
+            CHECK(meshlet.vertex_offset == vertex_offset);
+            CHECK(meshlet.triangle_offset == triangle_offset);
+
+            vertex_offset += meshlet.vertex_count;
+            triangle_offset += meshlet.triangle_count;
+        }
+
+        CHECK(vertex_offset == meshlet_data.vertices.size());
+        CHECK(triangle_offset == meshlet_data.triangles.size());
+        CHECK(meshlet_data.triangles.size() * 3u == mesh.indices.size());
+    }
+}
+
+SERENITY_TEST(mesh_optimizer, meshlet_triangle_packing)
+{
+    auto mesh = create_sphere(48u, 64u);
+    asset::MeshOptimizer::optimize_vertex_cache(mesh.indices, mesh.positions.size());
+
+    const auto meshlet_data = asset::MeshOptimizer::build_meshlets(mesh.indices, mesh.positions, 255u, 512u);
+
+    auto triangle = size_t{0u};
+    for (const auto &meshlet : meshlet_data.meshlets)
+    {
+        // Each vertex is only present once per meshlet.
+        const auto meshlet_vertices =
+            std::span(meshlet_data.vertices).subspan(meshlet.vertex_offset, meshlet.vertex_count);
+        CHECK(std::unordered_set<uint32_t>(meshlet_vertices.begin(), meshlet_vertices.end()).size() ==
+              meshlet.vertex_count);
+
+        for (const auto i : std::views::iota(0u, meshlet.triangle_count))
+        {
+            // Three 8 bit local indices, with the highest byte unused.
+            const auto packed_triangle = meshlet_data.triangles[meshlet.triangle_offset + i];
+            CHECK((packed_triangle >> 24u) == 0u);
+            CHECK((packed_triangle & 0xffu) < meshlet.vertex_count);
+            CHECK(((packed_triangle >> 8u) & 0xffu) < meshlet.vertex_count);
+            CHECK(((packed_triangle >> 16u) & 0xffu) < meshlet.vertex_count);
+
+            // Triangles are consumed in index buffer order, with their winding preserved.
+            const auto meshlet_triangle = get_meshlet_triangle(meshlet_data, meshlet, i);
+            CHECK(std::equal(meshlet_triangle.begin(), meshlet_triangle.end(), mesh.indices.begin() + triangle * 3u));
+
+            ++triangle;
+        }
+    }
+
+    CHECK(triangle * 3u == mesh.indices.size());
+}
+
+SERENITY_TEST(mesh_optimizer, meshlet_bounding_sphere)
+{
+    auto mesh = create_sphere(32u, 48u);
+    asset::MeshOptimizer::optimize_vertex_cache(mesh.indices, mesh.positions.size());
+
+    const auto meshlet_data = asset::MeshOptimizer::build_meshlets(mesh.indices, mesh.positions);
+
+    for (const auto &meshlet : meshlet_data.meshlets)
+    {
+        CHECK(meshlet.radius > 0.0f);
+
+        for (const auto vertex : std::span(meshlet_data.vertices).subspan(meshlet.vertex_offset, meshlet.vertex_count))
+        {
+            const auto offset = subtract(mesh.positions[vertex], meshlet.center);
+            CHECK(std::sqrt(dot(offset, offset)) <= meshlet.radius * (1.0f + 1e-5f) + 1e-6f);
+        }
+
+        // A meshlet is never outside a plane that passes through its center, and always outside a plane that has it
+        // (with its bounding sphere) behind it.
+        const auto center_plane = math::XMFLOAT4(0.0f, 1.0f, 0.0f, -meshlet.center.y);
+        const auto far_plane = math::XMFLOAT4(0.0f, 1.0f, 0.0f, -(meshlet.center.y + meshlet.radius * 1.01f));
+
+        CHECK(!asset::MeshOptimizer::is_meshlet_outside_planes(meshlet, std::span(&center_plane, 1u)));
+        CHECK(asset::MeshOptimizer::is_meshlet_outside_planes(meshlet, std::span(&far_plane, 1u)));
+    }
+}
+
+SERENITY_TEST(mesh_optimizer, meshlet_normal_cone)
+{
+    auto mesh = create_sphere(32u, 48u);
+    asset::MeshOptimizer::optimize_vertex_cache(mesh.indices, mesh.positions.size());
+
+    const auto meshlet_data = asset::MeshOptimizer::build_meshlets(mesh.indices, mesh.positions, 64u, 124u);
+
+    // Most meshlets of a finely tessellated sphere only span a small part of it, so they have a valid cone. The last
+    // meshlets can be scattered over the sphere (they collect the triangles left over by the vertex cache
+    // optimization), in which case they can not be cone culled.
+    const auto cone_meshlet_count = std::ranges::count_if(
+        meshlet_data.meshlets, [](const asset::Meshlet &meshlet) { return meshlet.cone_cutoff < 1.0f; });
+    CHECK(static_cast<size_t>(cone_meshlet_count) * 10u >= meshlet_data.meshlets.size() * 9u);
+
+    // If the cone test reports a meshlet as back facing from a camera position, every triangle of the meshlet must be
+    // back facing from there (the test is conservative, so the reverse does not hold). The camera positions are on a
+    // grid around (and inside) the sphere.
+    auto camera_positions = std::vector<math::XMFLOAT3>{};
+    for (const auto x : std::views::iota(-4, 5))
+    {
+        for (const auto y : std::views::iota(-4, 5))
+        {
+            for (const auto z : std::views::iota(-4, 5))
+            {
+                camera_positions.emplace_back(static_cast<float>(x) * 0.75f, static_cast<float>(y) * 0.75f,
+                                              static_cast<float>(z) * 0.75f);
+            }
+        }
+    }
+
+    auto back_facing_count = 0u;
+    for (const auto &camera_position : camera_positions)
+    {
+        for (const auto &meshlet : meshlet_data.meshlets)
+        {
+            if (!asset::MeshOptimizer::is_meshlet_back_facing(meshlet, camera_position))
+            {
+                continue;
+            }
+
+            ++back_facing_count;
+
+            for (const auto triangle_index : std::views::iota(0u, meshlet.triangle_count))
+            {
+                const auto [a, b, c] = get_meshlet_triangle(meshlet_data, meshlet, triangle_index);
+                const auto normal = cross(subtract(mesh.positions[b], mesh.positions[a]),
+                                          subtract(mesh.positions[c], mesh.positions[a]));
+
+                CHECK(dot(normal, subtract(mesh.positions[a], camera_position)) >= -1e-6f);
+            }
+        }
+    }
+
+    // Roughly half of the sphere is back facing from any camera outside of it.
+    CHECK(back_facing_count > 0u);
+
+    // All triangles of a flat grid have the same normal, so the cone only culls from behind the grid.
+    auto grid_positions = std::vector<math::XMFLOAT3>{};
+    auto grid_indices = std::vector<uint32_t>{};
+    for (const auto z : std::views::iota(0u, 8u))
+    {
+        for (const auto x : std::views::iota(0u, 8u))
+        {
+            grid_positions.emplace_back(static_cast<float>(x), 0.0f, static_cast<float>(z));
+
+            if (x < 7u && z < 7u)
+            {
+                const auto vertex = z * 8u + x;
+                grid_indices.insert(grid_indices.end(), {vertex, vertex + 8u, vertex + 1u});
+                grid_indices.insert(grid_indices.end(), {vertex + 1u, vertex + 8u, vertex + 9u});
+            }
+        }
+    }
+
+    const auto grid_meshlet = asset::MeshOptimizer::build_meshlets(grid_indices, grid_positions).meshlets.front();
+    CHECK(std::abs(grid_meshlet.cone_axis.y - 1.0f) < 1e-5f);
+    CHECK(grid_meshlet.cone_cutoff < 1e-3f);
+    CHECK(asset::MeshOptimizer::is_meshlet_back_facing(grid_meshlet, math::XMFLOAT3(3.0f, -1.0f, 3.0f)));
+    CHECK(!asset::MeshOptimizer::is_meshlet_back_facing(grid_meshlet, math::XMFLOAT3(3.0f, 1.0f, 3.0f)));
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+// Unit tests of serenity-engine-core. Each test file registers its tests with SERENITY_TEST (grouped by the system
+// they test), and CHECK / CHECK_THROWS fail the test (by throwing a TestFailure) if the check does not hold.
+#define SERENITY_TEST(group, name)                                                                                     \
+    static void group##_##name##_test();                                                                               \
+    static const serenity::tests::TestRegistrar group##_##name##_test_registrar{#group, #name,                       \
+                                                                               &group##_##name##_test};                \
+    static void group##_##name##_test()
+
+#define CHECK(condition) serenity::tests::check(static_cast<bool>(condition), #condition)
+#define CHECK_THROWS(expression) serenity::tests::check_throws([&]() { (void)(expression); }, #expression)
+
+namespace serenity::tests
+{
+    struct Test
+    {
+        std::string_view group{};
+        std::string_view name{};
+        void (*function)(){};
+    };
+
+    // All registered tests, in registration order.
+    std::vector<Test> &get_tests();
+
+    struct TestRegistrar
+    {
+        explicit TestRegistrar(const std::string_view group, const std::string_view name, void (*function)())
+        {
+            get_tests().push_back(Test{
+                .group = group,
+                .name = name,
+                .function = function,
+            });
+        }
+    };
+
+    class TestFailure : public std::runtime_error
+    {
+      public:
+        using std::runtime_error::runtime_error;
+    };
+
+    inline void check(const bool condition, const std::string_view expression,
+                      const std::source_location source_location = std::source_location::current())
+    {
+        if (!condition)
+        {
+            throw TestFailure(std::format("{}({}) : CHECK({}) failed", source_location.file_name(),
+                                          source_location.line(), expression));
+        }
+    }
+
+    // The engine reports errors with core::Log::critical, which throws.
+    template <typename Function>
+    inline void check_throws(Function &&function, const std::string_view expression,
+                             const std::source_location source_location = std::source_location::current())
+    {
+        try
+        {
+            function();
+        }
+        catch (const TestFailure &)
+        {
+            throw;
+        }
+        catch (...)
+        {
+            return;
+        }
+
+        throw TestFailure(std::format("{}({}) : CHECK_THROWS({}) did not throw", source_location.file_name(),
+                                      source_location.line(), expression));
+    }
+} // namespace serenity::tests
\ No newline at end of file
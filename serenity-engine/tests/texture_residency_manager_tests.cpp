@@ -0,0 +1,241 @@
+#include "test_framework.hpp"
+
+#include "serenity-engine/renderer/texture_residency_manager.hpp"
+
+using namespace serenity;
+
+namespace
+{
+    // Mip sizes of a 64 x 64 RGBA8 texture with 5 mip levels (down to 4 x 4).
+    constexpr auto MIP_SIZES = std::array<uint64_t, 5u>{16384u, 4096u, 1024u, 256u, 64u};
+    constexpr auto TEXTURE_SIZE = uint64_t{16384u + 4096u + 1024u + 256u + 64u};
+
+    // Mip sizes of a 16 x 16 BC7 texture : mip levels smaller than a 4 x 4 block still take up an entire block.
+    constexpr auto BC7_MIP_SIZES = std::array<uint64_t, 5u>{256u, 64u, 16u, 16u, 16u};
+
+    constexpr auto PROTECTED_FRAME_COUNT = 2u;
+    constexpr auto UNLIMITED = std::numeric_limits<uint64_t>::max();
+
+    // Most detailed mip of the texture after the changes, if the texture has changed.
+    std::optional<uint32_t> find_change(const std::vector<renderer::TextureResidencyChange> &changes,
+                                        const uint32_t texture_index)
+    {
+        const auto itr = std::ranges::find(changes, texture_index, &renderer::TextureResidencyChange::texture_index);
+        if (itr == changes.end())
+        {
+            return std::nullopt;
+        }
+
+        return itr->most_detailed_mip;
+    }
+} // namespace
+
+SERENITY_TEST(texture_residency_manager, lru_eviction_order)
+{
+    auto residency_manager = renderer::TextureResidencyManager(UNLIMITED, PROTECTED_FRAME_COUNT, UNLIMITED);
+
+    for (const auto i : std::views::iota(0u, 3u))
+    {
+        residency_manager.add_texture(i, MIP_SIZES, true, 0u);
+    }
+
+    CHECK(residency_manager.get_resident_size() == TEXTURE_SIZE * 3u);
+    CHECK(residency_manager.update(0u).empty());
+
+    // Texture 2 is the most recently used texture. Textures 0 and 1 were last used in the same frame, in which case
+    // the texture with the lower index is evicted first.
+    residency_manager.mark_texture_as_used(2u, 1u);
+    CHECK(residency_manager.update(1u).empty());
+
+    residency_manager.set_budget(TEXTURE_SIZE * 3u - MIP_SIZES[0]);
+
+    auto changes = residency_manager.update(3u);
+    CHECK(changes.size() == 1u);
+    CHECK(find_change(changes, 0u) == 1u);
+    CHECK(residency_manager.get_resident_size() == TEXTURE_SIZE * 3u - MIP_SIZES[0]);
+
+    // A texture is evicted entirely before the next least recently used texture is evicted.
+    residency_manager.set_budget(TEXTURE_SIZE * 2u - MIP_SIZES[0] + 1u);
+
+    changes = residency_manager.update(3u);
+    CHECK(changes.size() == 2u);
+    CHECK(find_change(changes, 0u) == MIP_SIZES.size());
+    CHECK(find_change(changes, 1u) == 1u);
+    CHECK(residency_manager.get_most_detailed_resident_mip(2u) == 0u);
+    CHECK(residency_manager.get_resident_size() == TEXTURE_SIZE * 2u - MIP_SIZES[0]);
+
+    // Removed textures no longer count towards the resident size.
+    residency_manager.remove_texture(1u);
+    residency_manager.remove_texture(0u);
+    CHECK(residency_manager.get_resident_size() == TEXTURE_SIZE);
+    CHECK_THROWS(residency_manager.get_most_detailed_resident_mip(1u));
+}
+
+SERENITY_TEST(texture_residency_manager, protected_frames)
+{
+    auto residency_manager = renderer::TextureResidencyManager(0u, PROTECTED_FRAME_COUNT, UNLIMITED);
+
+    residency_manager.add_texture(0u, MIP_SIZES, true, 10u);
+    residency_manager.add_texture(1u, MIP_SIZES, false, 10u);
+
+    // Textures used in the last PROTECTED_FRAME_COUNT frames are not evicted, even though the budget is exceeded.
+    CHECK(residency_manager.update(10u).empty());
+    CHECK(residency_manager.update(11u).empty());
+    CHECK(residency_manager.get_resident_size() == TEXTURE_SIZE * 2u);
+
+    residency_manager.mark_texture_as_used(0u, 12u);
+    CHECK(residency_manager.update(12u).empty());
+    CHECK(residency_manager.update(13u).empty());
+
+    auto changes = residency_manager.update(14u);
+    CHECK(changes.size() == 1u);
+    CHECK(find_change(changes, 0u) == MIP_SIZES.size());
+
+    // Non evictable textures are never evicted (and must be added with all mip levels resident).
+    CHECK(residency_manager.update(100u).empty());
+    CHECK(residency_manager.get_most_detailed_resident_mip(1u) == 0u);
+    CHECK(residency_manager.get_resident_size() == TEXTURE_SIZE);
+
+    CHECK_THROWS(residency_manager.add_texture(2u, MIP_SIZES, false, 100u, 1u));
+}
+
+SERENITY_TEST(texture_residency_manager, per_mip_eviction)
+{
+    auto residency_manager = renderer::TextureResidencyManager(UNLIMITED, PROTECTED_FRAME_COUNT, UNLIMITED);
+    residency_manager.add_texture(0u, BC7_MIP_SIZES, true, 0u);
+
+    // Only as many mip levels as required to be within the budget are evicted.
+    const auto bc7_texture_size = std::accumulate(BC7_MIP_SIZES.begin(), BC7_MIP_SIZES.end(), uint64_t{0u});
+    auto resident_size = bc7_texture_size;
+
+    for (const auto mip : std::views::iota(0u, static_cast<uint32_t>(BC7_MIP_SIZES.size())))
+    {
+        resident_size -= BC7_MIP_SIZES[mip];
+        residency_manager.set_budget(resident_size);
+
+        const auto changes = residency_manager.update(PROTECTED_FRAME_COUNT);
+        CHECK(changes.size() == 1u);
+        CHECK(find_change(changes, 0u) == mip + 1u);
+        CHECK(residency_manager.get_resident_size() == resident_size);
+    }
+
+    // The block sized tail mip levels (2 x 2 and 1 x 1) are evicted with the size of a block each.
+    CHECK(residency_manager.get_resident_size() == 0u);
+    CHECK(residency_manager.get_most_detailed_resident_mip(0u) == BC7_MIP_SIZES.size());
+    CHECK(residency_manager.update(PROTECTED_FRAME_COUNT).empty());
+}
+
+SERENITY_TEST(texture_residency_manager, reload_on_use)
+{
+    auto residency_manager = renderer::TextureResidencyManager(0u, PROTECTED_FRAME_COUNT, UNLIMITED);
+    residency_manager.add_texture(0u, MIP_SIZES, true, 0u);
+
+    CHECK(find_change(residency_manager.update(PROTECTED_FRAME_COUNT), 0u) == MIP_SIZES.size());
+    CHECK(residency_manager.get_resident_size() == 0u);
+
+    // When an evicted texture is used again, the desired mip levels are reloaded in the same frame (and the texture
+    // is protected from eviction, even though the budget is exceeded).
+    residency_manager.mark_texture_as_used(0u, 10u, 2u);
+
+    auto changes = residency_manager.update(10u);
+    CHECK(changes.size() == 1u);
+    CHECK(find_change(changes, 0u) == 2u);
+    CHECK(residency_manager.get_resident_size() == MIP_SIZES[2] + MIP_SIZES[3] + MIP_SIZES[4]);
+
+    // If a texture is used multiple times in a frame, the most detailed desired mip is used.
+    residency_manager.mark_texture_as_used(0u, 11u, 3u);
+    residency_manager.mark_texture_as_used(0u, 11u);
+    residency_manager.mark_texture_as_used(0u, 11u, 4u);
+
+    changes = residency_manager.update(11u);
+    CHECK(find_change(changes, 0u) == 0u);
+    CHECK(residency_manager.get_resident_size() == TEXTURE_SIZE);
+}
+
+SERENITY_TEST(texture_residency_manager, stream_in_limit)
+{
+    // The streamed size of a texture is its resident size after the change (textures are recreated with all resident
+    // mip levels). The limit fits mip levels 1 - 4 of one texture and mip levels 3 - 4 of another, but never the most
+    // detailed mip level.
+    const auto get_streamed_size = [&](const uint32_t most_detailed_mip) {
+        return std::accumulate(MIP_SIZES.begin() + most_detailed_mip, MIP_SIZES.end(), uint64_t{0u});
+    };
+
+    const auto max_streamed_size_per_frame = get_streamed_size(1u) + get_streamed_size(3u);
+
+    auto residency_manager =
+        renderer::TextureResidencyManager(UNLIMITED, PROTECTED_FRAME_COUNT, max_streamed_size_per_frame);
+    CHECK(residency_manager.get_max_streamed_size_per_frame() == max_streamed_size_per_frame);
+
+    // Streamed textures start with only their least detailed mip level resident.
+    const auto least_detailed_mip = static_cast<uint32_t>(MIP_SIZES.size()) - 1u;
+    residency_manager.add_texture(0u, MIP_SIZES, true, 0u, least_detailed_mip);
+    residency_manager.add_texture(1u, MIP_SIZES, true, 0u, least_detailed_mip);
+    CHECK(residency_manager.get_resident_size() == MIP_SIZES[least_detailed_mip] * 2u);
+
+    // Both textures are missing the same number of mip levels, so texture 0 is streamed in first, with as many mip
+    // levels as fit. Texture 1 gets what is left of the limit.
+    residency_manager.mark_texture_as_used(0u, 1u);
+    residency_manager.mark_texture_as_used(1u, 1u);
+
+    auto changes = residency_manager.update(1u);
+    CHECK(changes.size() == 2u);
+    CHECK(find_change(changes, 0u) == 1u);
+    CHECK(find_change(changes, 1u) == 3u);
+
+    // Texture 1 is now missing more mip levels than texture 0, so it is streamed in first. Texture 0 does not fit in
+    // the remaining limit.
+    residency_manager.mark_texture_as_used(0u, 2u);
+    residency_manager.mark_texture_as_used(1u, 2u);
+
+    changes = residency_manager.update(2u);
+    CHECK(changes.size() == 1u);
+    CHECK(find_change(changes, 1u) == 1u);
+
+    // At least one texture is streamed in per frame, even if it exceeds the limit.
+    residency_manager.mark_texture_as_used(0u, 3u);
+    residency_manager.mark_texture_as_used(1u, 3u);
+
+    changes = residency_manager.update(3u);
+    CHECK(changes.size() == 1u);
+    CHECK(find_change(changes, 0u) == 0u);
+
+    residency_manager.set_max_streamed_size_per_frame(UNLIMITED);
+    residency_manager.mark_texture_as_used(0u, 4u);
+    residency_manager.mark_texture_as_used(1u, 4u);
+
+    changes = residency_manager.update(4u);
+    CHECK(find_change(changes, 1u) == 0u);
+    CHECK(residency_manager.get_resident_size() == TEXTURE_SIZE * 2u);
+}
+
+SERENITY_TEST(texture_residency_manager, stream_out)
+{
+    auto residency_manager = renderer::TextureResidencyManager(UNLIMITED, PROTECTED_FRAME_COUNT, UNLIMITED);
+    residency_manager.add_texture(0u, MIP_SIZES, true, 0u);
+
+    // Mip levels more detailed than the desired mip are dropped once they have not been requested for
+    // PROTECTED_FRAME_COUNT frames (even though the budget is not exceeded).
+    for (const auto frame : std::views::iota(1u, PROTECTED_FRAME_COUNT))
+    {
+        residency_manager.mark_texture_as_used(0u, frame, 2u);
+        CHECK(residency_manager.update(frame).empty());
+    }
+
+    residency_manager.mark_texture_as_used(0u, PROTECTED_FRAME_COUNT, 2u);
+
+    auto changes = residency_manager.update(PROTECTED_FRAME_COUNT);
+    CHECK(changes.size() == 1u);
+    CHECK(find_change(changes, 0u) == 2u);
+    CHECK(residency_manager.get_resident_size() == MIP_SIZES[2] + MIP_SIZES[3] + MIP_SIZES[4]);
+
+    // Requesting the resident mip levels again (or less detailed ones) keeps them resident.
+    residency_manager.mark_texture_as_used(0u, 10u, 2u);
+    CHECK(residency_manager.update(10u).empty());
+
+    residency_manager.mark_texture_as_used(0u, 11u, 4u);
+    CHECK(residency_manager.update(11u).empty());
+
+    residency_manager.mark_texture_as_used(0u, 12u, 4u);
+    CHECK(find_change(residency_manager.update(12u), 0u) == 4u);
+}
\ No newline at end of file
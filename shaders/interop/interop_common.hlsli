@@ -31,6 +31,14 @@ namespace interop
     static const uint INVALID_INDEX_U32 = -1;
     static const uint MAX_LIGHT_COUNT = 25u;
     static const uint SUN_LIGHT_INDEX = 0u;
+
+    // Encodings of the quantized vertex streams (values match asset::NormalEncoding and asset::TextureCoordEncoding).
+    static const uint NORMAL_ENCODING_OCTAHEDRAL = 0u;
+    static const uint NORMAL_ENCODING_SNORM8 = 1u;
+    static const uint NORMAL_ENCODING_SNORM16 = 2u;
+
+    static const uint TEXTURE_COORD_ENCODING_HALF = 0u;
+    static const uint TEXTURE_COORD_ENCODING_UNORM16 = 1u;
 }
 
 #endif
\ No newline at end of file
@@ -47,6 +47,9 @@ namespace interop
         uint position_buffer_srv_index;
         uint normal_buffer_srv_index;
         uint texture_coord_buffer_srv_index;
+        uint quantized_position_buffer_srv_index;
+        uint quantized_normal_buffer_srv_index;
+        uint quantized_texture_coord_buffer_srv_index;
         uint game_object_srv_index;
         uint mesh_buffer_srv_index;
         uint scene_buffer_cbv_index;
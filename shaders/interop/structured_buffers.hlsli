@@ -30,22 +30,105 @@ namespace interop
         uint indices_offset;
         uint indices_count;
 
-        uint padding;
+        // Range of the mesh's levels of detail in the scene mesh lod buffer (lod_count is zero if the mesh has no
+        // LODs). The full detail mesh is given by indices_offset / indices_count.
+        uint lod_offset;
         
         float4x4 mesh_local_transform_matrix;
         float4x4 inverse_mesh_local_transform_matrix;
         
         uint material_index;
-        float3 padding2;
-        float4 padding3;
+
+        // Range of the mesh's meshlets in the scene meshlet buffer (meshlet_count is zero if the mesh has no
+        // meshlets).
+        uint meshlet_offset;
+        uint meshlet_count;
+
+        uint lod_count;
+
+        // Bounding sphere (center in xyz, radius in w) in mesh local space.
+        float4 bounding_sphere;
+
+        // Axis aligned bounding box in mesh local space.
+        float3 bounding_box_min;
+        float padding1;
+
+        float3 bounding_box_max;
+        float padding2;
+
+        // If vertices_quantized is non zero, the position / normal / texture coord offsets are into the scene's
+        // quantized vertex buffers, and position = position_dequantization_offset + quantized position *
+        // position_dequantization_scale.
+        float3 position_dequantization_offset;
+        uint vertices_quantized;
+
+        float3 position_dequantization_scale;
+
+        // Index format (see asset::IndexFormat) of the mesh and its levels of detail : 0 if the indices are in the
+        // scene's 16 bit index buffer, 1 if they are in the scene's 32 bit index buffer.
+        uint index_format;
+
+        // Encodings of the quantized normals / texture coords (the normal offset is in uint's, as 16 bit snorm normals
+        // take two uint's per vertex). For 16 bit unorm texture coords, texture coord =
+        // texture_coord_dequantization_offset + quantized texture coord * texture_coord_dequantization_scale.
+        uint normal_encoding;
+        uint texture_coord_encoding;
+        float2 texture_coord_dequantization_offset;
+
+        float2 texture_coord_dequantization_scale;
+        float2 padding3;
     };
 
+    // A level of detail of a mesh, i.e a range of the scene index buffer (that references the vertices of the full
+    // detail mesh) and the geometric error of the simplified mesh in mesh local units.
+    struct MeshLodBuffer
+    {
+        uint indices_offset;
+        uint indices_count;
+
+        float error;
+        float padding;
+    };
+
+    // Layout matches asset::Meshlet. The vertex offset / triangle offset are into the scene meshlet vertex and
+    // meshlet triangle buffers, and the meshlet vertices are relative to the position offset of the mesh.
+    struct MeshletBuffer
+    {
+        uint vertex_offset;
+        uint triangle_offset;
+        uint vertex_count;
+        uint triangle_count;
+
+        float3 center;
+        float radius;
+
+        float3 cone_axis;
+        float cone_cutoff;
+
+        float3 cone_apex;
+        float padding;
+    };
+
+    // Texture SRV indices are INVALID_INDEX_U32 if the material does not have the texture.
     struct MaterialBuffer
     {
         float4 base_color;
+
+        // Scale (xy) and offset (zw) of the texture coords, which map into the material's rect for materials whose
+        // textures are in a texture atlas.
+        float4 texture_coord_transform;
         
         float2 metallic_roughness_factor;
         uint albedo_texture_srv_index;
+        uint normal_texture_srv_index;
+
+        float3 emissive_factor;
+        uint occlusion_roughness_metallic_texture_srv_index;
+
+        uint emissive_texture_srv_index;
+        float normal_scale;
+        float occlusion_strength;
+        float padding;
     };
        
 }
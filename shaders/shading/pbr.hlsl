@@ -22,13 +22,60 @@ ConstantBuffer<interop::PBRShadingRenderResources> render_resources : register(b
 
 VsOutput vs_main(uint vertex_id : SV_VertexID)  
 {
-    StructuredBuffer<float3> position_buffer = ResourceDescriptorHeap[render_resources.position_buffer_srv_index];
-    StructuredBuffer<float2> texture_coord_buffer = ResourceDescriptorHeap[render_resources.texture_coord_buffer_srv_index];
-    StructuredBuffer<float3> normal_buffer = ResourceDescriptorHeap[render_resources.normal_buffer_srv_index];
-
     StructuredBuffer<interop::MeshBuffer> mesh_buffers = ResourceDescriptorHeap[render_resources.mesh_buffer_srv_index];
     interop::MeshBuffer mesh_buffer = mesh_buffers[render_resources.mesh_index];
 
+    float3 position;
+    float3 normal;
+    float2 texture_coord;
+
+    // The mesh's vertices are either in the float or in the quantized vertex buffers (the descriptor indices of the
+    // buffers that are not used by any mesh of the scene are invalid, so they must not be accessed).
+    if (mesh_buffer.vertices_quantized)
+    {
+        StructuredBuffer<uint2> quantized_position_buffer = ResourceDescriptorHeap[render_resources.quantized_position_buffer_srv_index];
+        StructuredBuffer<uint> quantized_normal_buffer = ResourceDescriptorHeap[render_resources.quantized_normal_buffer_srv_index];
+        StructuredBuffer<uint> quantized_texture_coord_buffer = ResourceDescriptorHeap[render_resources.quantized_texture_coord_buffer_srv_index];
+
+        position = decode_quantized_position(quantized_position_buffer[vertex_id + mesh_buffer.position_offset],
+                                             mesh_buffer.position_dequantization_offset, mesh_buffer.position_dequantization_scale);
+
+        if (mesh_buffer.normal_encoding == interop::NORMAL_ENCODING_SNORM16)
+        {
+            const uint normal_index = vertex_id * 2u + mesh_buffer.normal_offset;
+            normal = decode_snorm16_normal(uint2(quantized_normal_buffer[normal_index], quantized_normal_buffer[normal_index + 1u]));
+        }
+        else if (mesh_buffer.normal_encoding == interop::NORMAL_ENCODING_SNORM8)
+        {
+            normal = decode_snorm8_normal(quantized_normal_buffer[vertex_id + mesh_buffer.normal_offset]);
+        }
+        else
+        {
+            normal = decode_octahedral_normal(quantized_normal_buffer[vertex_id + mesh_buffer.normal_offset]);
+        }
+
+        const uint quantized_texture_coord = quantized_texture_coord_buffer[vertex_id + mesh_buffer.texture_coord_offset];
+        if (mesh_buffer.texture_coord_encoding == interop::TEXTURE_COORD_ENCODING_UNORM16)
+        {
+            texture_coord = decode_unorm16_texture_coord(quantized_texture_coord, mesh_buffer.texture_coord_dequantization_offset,
+                                                         mesh_buffer.texture_coord_dequantization_scale);
+        }
+        else
+        {
+            texture_coord = decode_half_texture_coord(quantized_texture_coord);
+        }
+    }
+    else
+    {
+        StructuredBuffer<float3> position_buffer = ResourceDescriptorHeap[render_resources.position_buffer_srv_index];
+        StructuredBuffer<float2> texture_coord_buffer = ResourceDescriptorHeap[render_resources.texture_coord_buffer_srv_index];
+        StructuredBuffer<float3> normal_buffer = ResourceDescriptorHeap[render_resources.normal_buffer_srv_index];
+
+        position = position_buffer[vertex_id + mesh_buffer.position_offset];
+        normal = normal_buffer[mesh_buffer.normal_offset + vertex_id];
+        texture_coord = texture_coord_buffer[vertex_id + mesh_buffer.texture_coord_offset];
+    }
+
     StructuredBuffer<interop::GameObjectBuffer> scene_game_object_buffer = ResourceDescriptorHeap[render_resources.game_object_srv_index];
     interop::GameObjectBuffer game_object_buffer = scene_game_object_buffer[mesh_buffer.game_object_index];
 
@@ -39,11 +86,11 @@ VsOutput vs_main(uint vertex_id : SV_VertexID)
     const float4x4 transform_matrix = mul(mesh_buffer.mesh_local_transform_matrix, game_object_buffer.transform_buffer.model_matrix);
     const float4x4 normal_matrix = transpose(mul(game_object_buffer.transform_buffer.inverse_model_matrix, mesh_buffer.inverse_mesh_local_transform_matrix));
 
-    output.position = mul(float4(position_buffer[vertex_id + mesh_buffer.position_offset], 1.0f), mul(transform_matrix, scene_buffer.view_projection_matrix));
-    output.pixel_position = mul(float4(position_buffer[vertex_id + mesh_buffer.position_offset], 1.0f), transform_matrix).xyz;
+    output.position = mul(float4(position, 1.0f), mul(transform_matrix, scene_buffer.view_projection_matrix));
+    output.pixel_position = mul(float4(position, 1.0f), transform_matrix).xyz;
     
-    output.texture_coord = texture_coord_buffer[vertex_id + mesh_buffer.texture_coord_offset];
-    output.normal = mul(normal_buffer[mesh_buffer.normal_offset + vertex_id], (float3x3)(normal_matrix));
+    output.texture_coord = texture_coord;
+    output.normal = mul(normal, (float3x3)(normal_matrix));
     
     output.camera_position = scene_buffer.camera_position;
 
@@ -76,18 +123,89 @@ float3 compute_pbr_lighting(PBRShadingParams params, const float3 light_color)
 
 }
 
+// Materials whose textures are in a texture atlas have a texture coord transform (scale in xy, offset in zw) into their
+// rect of the atlas. frac() makes repeating texture coords wrap within the rect (the gutter around the rect is filled
+// with wrapped texels), and the gradients of the untransformed texture coords are used so that the discontinuity of
+// frac() does not affect mip selection.
+float4 sample_material_texture(Texture2D<float4> material_texture, float2 texture_coord, float4 texture_coord_transform)
+{
+    const float2 atlas_texture_coord = frac(texture_coord) * texture_coord_transform.xy + texture_coord_transform.zw;
+
+    return material_texture.SampleGrad(anisotropic_sampler, atlas_texture_coord, ddx(texture_coord) * texture_coord_transform.xy, ddy(texture_coord) * texture_coord_transform.xy);
+}
+
+// Perturb the (world space) normal with the tangent space normal from the normal map. The vertices do not have
+// tangents, so the tangent frame is computed from the screen space derivatives of the position and texture coords.
+// Reference : http://www.thetenthplanet.de/archives/1180
+float3 apply_normal_map(float3 normal, float3 position, float2 texture_coord, float3 tangent_space_normal)
+{
+    const float3 dp1 = ddx(position);
+    const float3 dp2 = ddy(position);
+    const float2 duv1 = ddx(texture_coord);
+    const float2 duv2 = ddy(texture_coord);
+
+    const float3 dp2_perpendicular = cross(dp2, normal);
+    const float3 dp1_perpendicular = cross(normal, dp1);
+
+    const float3 tangent = dp2_perpendicular * duv1.x + dp1_perpendicular * duv2.x;
+    const float3 bitangent = dp2_perpendicular * duv1.y + dp1_perpendicular * duv2.y;
+
+    // The texture coord v axis points down (gltf), while the normal map's +Y points up, hence the negated bitangent.
+    const float inverse_scale = rsqrt(max(max(dot(tangent, tangent), dot(bitangent, bitangent)), 1e-20f));
+    const float3x3 tangent_frame = float3x3(tangent * inverse_scale, -bitangent * inverse_scale, normal);
+
+    return normalize(mul(tangent_space_normal, tangent_frame));
+}
+
 float4 ps_main(VsOutput input) : SV_Target0
 {
-    StructuredBuffer<interop::MaterialBuffer> material_buffer = ResourceDescriptorHeap[render_resources.material_buffer_srv_index];
-    float4 color = material_buffer[input.material_index].base_color;
+    StructuredBuffer<interop::MaterialBuffer> material_buffers = ResourceDescriptorHeap[render_resources.material_buffer_srv_index];
+    interop::MaterialBuffer material_buffer = material_buffers[input.material_index];
+
+    float4 color = material_buffer.base_color;
     
-    if (material_buffer[input.material_index].albedo_texture_srv_index != interop::INVALID_INDEX_U32)
+    if (material_buffer.albedo_texture_srv_index != interop::INVALID_INDEX_U32)
     {
-        Texture2D<float4> albedo_texture = ResourceDescriptorHeap[material_buffer[input.material_index].albedo_texture_srv_index];
-        color *= albedo_texture.Sample(anisotropic_sampler, input.texture_coord);
+        Texture2D<float4> albedo_texture = ResourceDescriptorHeap[material_buffer.albedo_texture_srv_index];
+        color *= sample_material_texture(albedo_texture, input.texture_coord, material_buffer.texture_coord_transform);
     }   
 
-    const float3 normal = normalize(input.normal);
+    // Occlusion (R), roughness (G) and metallic (B).
+    float metallic_factor = material_buffer.metallic_roughness_factor.x;
+    float roughness_factor = material_buffer.metallic_roughness_factor.y;
+    float occlusion = 1.0f;
+
+    if (material_buffer.occlusion_roughness_metallic_texture_srv_index != interop::INVALID_INDEX_U32)
+    {
+        Texture2D<float4> orm_texture = ResourceDescriptorHeap[material_buffer.occlusion_roughness_metallic_texture_srv_index];
+        const float3 orm = sample_material_texture(orm_texture, input.texture_coord, material_buffer.texture_coord_transform).xyz;
+
+        occlusion = lerp(1.0f, orm.x, material_buffer.occlusion_strength);
+        roughness_factor *= orm.y;
+        metallic_factor *= orm.z;
+    }
+
+    float3 normal = normalize(input.normal);
+
+    if (material_buffer.normal_texture_srv_index != interop::INVALID_INDEX_U32)
+    {
+        // The normal map only has the XY components (BC5), Z is reconstructed.
+        Texture2D<float4> normal_texture = ResourceDescriptorHeap[material_buffer.normal_texture_srv_index];
+
+        float3 tangent_space_normal;
+        tangent_space_normal.xy = (sample_material_texture(normal_texture, input.texture_coord, material_buffer.texture_coord_transform).xy * 2.0f - 1.0f) * material_buffer.normal_scale;
+        tangent_space_normal.z = sqrt(saturate(1.0f - dot(tangent_space_normal.xy, tangent_space_normal.xy)));
+
+        normal = apply_normal_map(normal, input.pixel_position, input.texture_coord, tangent_space_normal);
+    }
+
+    float3 emissive = material_buffer.emissive_factor;
+
+    if (material_buffer.emissive_texture_srv_index != interop::INVALID_INDEX_U32)
+    {
+        Texture2D<float4> emissive_texture = ResourceDescriptorHeap[material_buffer.emissive_texture_srv_index];
+        emissive *= sample_material_texture(emissive_texture, input.texture_coord, material_buffer.texture_coord_transform).xyz;
+    }
 
     // Perform shading.
     TextureCube<float4> atmosphere_texture = ResourceDescriptorHeap[render_resources.atmosphere_texture_srv_index];
@@ -107,8 +225,8 @@ float4 ps_main(VsOutput input) : SV_Target0
             params.pixel_to_light_direction = normalize(light.world_space_position_or_direction - input.pixel_position);
             params.pixel_to_camera_direction = normalize(input.camera_position - input.pixel_position);
             params.albedo = color.xyz;
-            params.metallic_factor = material_buffer[input.material_index].metallic_roughness_factor.x;
-            params.roughness_factor = material_buffer[input.material_index].metallic_roughness_factor.y;
+            params.metallic_factor = metallic_factor;
+            params.roughness_factor = roughness_factor;
 
             const float attenuation_factor = 1.0f / length(light.world_space_position_or_direction - input.pixel_position);
             
@@ -121,12 +239,15 @@ float4 ps_main(VsOutput input) : SV_Target0
             params.pixel_to_light_direction = normalize(light.world_space_position_or_direction);
             params.pixel_to_camera_direction = normalize(input.camera_position - input.pixel_position);
             params.albedo = color.xyz;
-            params.metallic_factor = material_buffer[input.material_index].metallic_roughness_factor.x;
-            params.roughness_factor = material_buffer[input.material_index].metallic_roughness_factor.y;
+            params.metallic_factor = metallic_factor;
+            params.roughness_factor = roughness_factor;
 
-            shading_result += compute_pbr_lighting(params, atmosphere_texture.Sample(linear_wrap_sampler, input.pixel_position).xyz * light.intensity);   
+            // There is no ambient / image based lighting yet, so occlusion is applied to the light from the atmosphere.
+            shading_result += compute_pbr_lighting(params, atmosphere_texture.Sample(linear_wrap_sampler, input.pixel_position).xyz * light.intensity) * occlusion;
         }
     }
 
+    shading_result += emissive;
+
     return float4(shading_result, 1.0f);
 }
\ No newline at end of file
@@ -71,4 +71,49 @@ float random_float_in_range_0_1(inout uint seed)
     seed = wang_hash(seed);
     return float(rand_xor_shift(seed)) * (1.f / 4294967296.f);
 }
+
+// Decode functions for the quantized vertex streams (see asset/vertex_quantization.hpp).
+float3 decode_quantized_position(uint2 position, float3 dequantization_offset, float3 dequantization_scale)
+{
+    const float3 quantized_position = float3(position.x & 0xffff, position.x >> 16, position.y & 0xffff);
+    return dequantization_offset + quantized_position * dequantization_scale;
+}
+
+// Reference : https://knarkowicz.wordpress.com/2014/04/16/octahedron-normal-vector-encoding/
+float3 decode_octahedral_normal(uint normal)
+{
+    // Sign extend the two 16 bit snorm values.
+    const int2 snorm_values = int2(normal << 16, normal) >> 16;
+    const float2 encoded_normal = max(float2(snorm_values) / 32767.0f, -1.0f);
+
+    float3 decoded_normal = float3(encoded_normal, 1.0f - abs(encoded_normal.x) - abs(encoded_normal.y));
+    const float t = saturate(-decoded_normal.z);
+    decoded_normal.xy += (1.0f - 2.0f * step(0.0f, decoded_normal.xy)) * t;
+
+    return normalize(decoded_normal);
+}
+
+float3 decode_snorm8_normal(uint normal)
+{
+    // Sign extend the three 8 bit snorm values.
+    const int3 snorm_values = int3(normal << 24, normal << 16, normal << 8) >> 24;
+    return normalize(max(float3(snorm_values) / 127.0f, -1.0f));
+}
+
+float3 decode_snorm16_normal(uint2 normal)
+{
+    const int3 snorm_values = int3(normal.x << 16, normal.x, normal.y << 16) >> 16;
+    return normalize(max(float3(snorm_values) / 32767.0f, -1.0f));
+}
+
+float2 decode_unorm16_texture_coord(uint texture_coord, float2 dequantization_offset, float2 dequantization_scale)
+{
+    const float2 quantized_texture_coord = float2(texture_coord & 0xffff, texture_coord >> 16);
+    return dequantization_offset + quantized_texture_coord * dequantization_scale;
+}
+
+float2 decode_half_texture_coord(uint texture_coord)
+{
+    return f16tof32(uint2(texture_coord, texture_coord >> 16));
+}
 #endif
\ No newline at end of file
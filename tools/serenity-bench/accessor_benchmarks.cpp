@@ -0,0 +1,230 @@
+#include "benchmark.hpp"
+
+#include "serenity-engine/asset/model_loader.hpp"
+#include "serenity-engine/core/job_system.hpp"
+
+#include <fastgltf/parser.hpp>
+#include <fastgltf/tools.hpp>
+#include <fastgltf/types.hpp>
+
+// Same specializations as in the model loader, so that the accessors can be read with fastgltf's per element iteration.
+namespace fastgltf
+{
+    template <>
+    struct ElementTraits<math::XMFLOAT3>
+        : fastgltf::ElementTraitsBase<math::XMFLOAT3, fastgltf::AccessorType::Vec3, float>
+    {
+    };
+
+    template <>
+    struct ElementTraits<math::XMFLOAT2>
+        : fastgltf::ElementTraitsBase<math::XMFLOAT2, fastgltf::AccessorType::Vec2, float>
+    {
+    };
+} // namespace fastgltf
+
+using namespace serenity;
+
+namespace
+{
+    // A grid of GRID_DIMENSION x GRID_DIMENSION vertices (i.e a million vertices).
+    constexpr auto GRID_DIMENSION = 1000u;
+    constexpr auto VERTEX_COUNT = GRID_DIMENSION * GRID_DIMENSION;
+    constexpr auto INDEX_COUNT = (GRID_DIMENSION - 1u) * (GRID_DIMENSION - 1u) * 6u;
+
+    // Byte sizes of the vertex streams. Normals are normalized 16 bit integers (padded to 8 bytes, as required by the
+    // gltf spec), and texture coords are normalized 16 bit unsigned integers (as written by KHR_mesh_quantization
+    // exporters), so both go through the bulk conversion path rather than a plain copy.
+    constexpr auto POSITIONS_BYTE_SIZE = size_t{VERTEX_COUNT} * sizeof(math::XMFLOAT3);
+    constexpr auto NORMALS_BYTE_SIZE = size_t{VERTEX_COUNT} * 4u * sizeof(int16_t);
+    constexpr auto TEXTURE_COORDS_BYTE_SIZE = size_t{VERTEX_COUNT} * 2u * sizeof(uint16_t);
+    constexpr auto INDICES_BYTE_SIZE = size_t{INDEX_COUNT} * sizeof(uint32_t);
+
+    // Writes the grid mesh as a gltf file (with an external buffer) to model_path.
+    void write_grid_model(const std::filesystem::path &model_path)
+    {
+        auto buffer = std::vector<std::byte>(POSITIONS_BYTE_SIZE + NORMALS_BYTE_SIZE + TEXTURE_COORDS_BYTE_SIZE +
+                                             INDICES_BYTE_SIZE);
+
+        const auto positions = reinterpret_cast<math::XMFLOAT3 *>(buffer.data());
+        const auto normals = reinterpret_cast<int16_t *>(buffer.data() + POSITIONS_BYTE_SIZE);
+        const auto texture_coords =
+            reinterpret_cast<uint16_t *>(buffer.data() + POSITIONS_BYTE_SIZE + NORMALS_BYTE_SIZE);
+        const auto indices = reinterpret_cast<uint32_t *>(buffer.data() + POSITIONS_BYTE_SIZE + NORMALS_BYTE_SIZE +
+                                                          TEXTURE_COORDS_BYTE_SIZE);
+
+        for (const auto y : std::views::iota(0u, GRID_DIMENSION))
+        {
+            for (const auto x : std::views::iota(0u, GRID_DIMENSION))
+            {
+                const auto vertex_index = y * GRID_DIMENSION + x;
+                const auto u = static_cast<float>(x) / static_cast<float>(GRID_DIMENSION - 1u);
+                const auto v = static_cast<float>(y) / static_cast<float>(GRID_DIMENSION - 1u);
+
+                positions[vertex_index] = math::XMFLOAT3(u, 0.1f * std::sin(u * 20.0f) * std::cos(v * 20.0f), v);
+
+                normals[vertex_index * 4u + 0u] = 0;
+                normals[vertex_index * 4u + 1u] = std::numeric_limits<int16_t>::max();
+                normals[vertex_index * 4u + 2u] = 0;
+                normals[vertex_index * 4u + 3u] = 0;
+
+                texture_coords[vertex_index * 2u + 0u] = static_cast<uint16_t>(u * 65535.0f);
+                texture_coords[vertex_index * 2u + 1u] = static_cast<uint16_t>(v * 65535.0f);
+            }
+        }
+
+        auto index = size_t{0u};
+        for (const auto y : std::views::iota(0u, GRID_DIMENSION - 1u))
+        {
+            for (const auto x : std::views::iota(0u, GRID_DIMENSION - 1u))
+            {
+                const auto vertex_index = y * GRID_DIMENSION + x;
+                for (const auto corner : {0u, GRID_DIMENSION, 1u, 1u, GRID_DIMENSION, GRID_DIMENSION + 1u})
+                {
+                    indices[index++] = vertex_index + corner;
+                }
+            }
+        }
+
+        const auto buffer_path = std::filesystem::path(model_path).replace_extension(".bin");
+        auto buffer_file = std::ofstream(buffer_path, std::ios::binary);
+        buffer_file.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+        const auto normals_offset = POSITIONS_BYTE_SIZE;
+        const auto texture_coords_offset = normals_offset + NORMALS_BYTE_SIZE;
+        const auto indices_offset = texture_coords_offset + TEXTURE_COORDS_BYTE_SIZE;
+
+        auto model_file = std::ofstream(model_path);
+        model_file << std::format(R"({{
+  "asset" : {{ "version" : "2.0" }},
+  "scene" : 0,
+  "scenes" : [ {{ "nodes" : [ 0 ] }} ],
+  "nodes" : [ {{ "mesh" : 0 }} ],
+  "meshes" : [ {{ "primitives" : [ {{
+    "attributes" : {{ "POSITION" : 0, "NORMAL" : 1, "TEXCOORD_0" : 2 }},
+    "indices" : 3
+  }} ] }} ],
+  "buffers" : [ {{ "uri" : "{}", "byteLength" : {} }} ],
+  "bufferViews" : [
+    {{ "buffer" : 0, "byteOffset" : 0, "byteLength" : {} }},
+    {{ "buffer" : 0, "byteOffset" : {}, "byteLength" : {}, "byteStride" : 8 }},
+    {{ "buffer" : 0, "byteOffset" : {}, "byteLength" : {} }},
+    {{ "buffer" : 0, "byteOffset" : {}, "byteLength" : {} }}
+  ],
+  "accessors" : [
+    {{ "bufferView" : 0, "componentType" : 5126, "count" : {}, "type" : "VEC3",
+       "min" : [ 0.0, -0.1, 0.0 ], "max" : [ 1.0, 0.1, 1.0 ] }},
+    {{ "bufferView" : 1, "componentType" : 5122, "normalized" : true, "count" : {}, "type" : "VEC3" }},
+    {{ "bufferView" : 2, "componentType" : 5123, "normalized" : true, "count" : {}, "type" : "VEC2" }},
+    {{ "bufferView" : 3, "componentType" : 5125, "count" : {}, "type" : "SCALAR" }}
+  ]
+}})",
+                                  buffer_path.filename().string(), buffer.size(), POSITIONS_BYTE_SIZE, normals_offset,
+                                  NORMALS_BYTE_SIZE, texture_coords_offset, TEXTURE_COORDS_BYTE_SIZE, indices_offset,
+                                  INDICES_BYTE_SIZE, VERTEX_COUNT, VERTEX_COUNT, VERTEX_COUNT, INDEX_COUNT);
+    }
+
+    // Parses the model with fastgltf, with the external buffer loaded into memory (so that the accessors can be read
+    // with fastgltf's per element iteration).
+    fastgltf::Asset parse_model(const std::filesystem::path &model_path)
+    {
+        auto data = fastgltf::GltfDataBuffer();
+        if (!data.loadFromFile(model_path))
+        {
+            core::Log::instance().critical(std::format("Failed to load GLTF data from model {}", model_path.string()));
+        }
+
+        auto parser = fastgltf::Parser();
+        auto gltf = parser.loadGLTF(&data, model_path.parent_path(), fastgltf::Options::LoadExternalBuffers);
+        if (const auto error = gltf.error(); error != fastgltf::Error::None)
+        {
+            core::Log::instance().critical(std::format("Error while loading model {}. GLTF error code : {}",
+                                                       model_path.string(), static_cast<uint32_t>(error)));
+        }
+
+        return std::move(gltf.get());
+    }
+
+    // The accessor path used before the bulk copy fast path : one callback per element.
+    template <typename T> std::vector<T> iterate_accessor(const fastgltf::Asset &asset, const size_t accessor_index)
+    {
+        const auto &accessor = asset.accessors[accessor_index];
+
+        auto data = std::vector<T>(accessor.count);
+        fastgltf::iterateAccessorWithIndex<T>(asset, accessor, [&](T element, size_t index) { data[index] = element; });
+
+        return data;
+    }
+} // namespace
+
+SERENITY_BENCHMARK(accessor_copy, "Reading million vertex gltf accessors : per element iteration vs bulk copy")
+{
+    const auto job_system = std::make_unique<core::JobSystem>();
+
+    const auto model_path = std::filesystem::temp_directory_path() / "serenity_bench_accessor_copy.gltf";
+    write_grid_model(model_path);
+
+    // Per element iteration, timed after parsing so that only the accessor reads are measured.
+    const auto asset = parse_model(model_path);
+
+    const auto iteration_time_ms = bench::measure_ms([&]() {
+        const auto positions = iterate_accessor<math::XMFLOAT3>(asset, 0u);
+        const auto normals = iterate_accessor<math::XMFLOAT3>(asset, 1u);
+        const auto texture_coords = iterate_accessor<math::XMFLOAT2>(asset, 2u);
+        const auto indices = iterate_accessor<uint32_t>(asset, 3u);
+    });
+
+    // The model loader with all import time processing disabled, so that the time is dominated by reading the
+    // accessors through the bulk copy / conversion path. This includes parsing the json and mapping the buffer,
+    // which are timed separately below.
+    const auto import_config = asset::ModelImportConfig{
+        .optimize_vertex_cache = false,
+        .optimize_overdraw = false,
+        .optimize_vertex_fetch = false,
+        .generate_meshlets = false,
+        .generate_lods = false,
+        .texture_compression = asset::TextureCompression::None,
+        .normal_texture_compression = asset::TextureCompression::None,
+        .generate_texture_atlases = false,
+    };
+
+    auto loaded_vertex_count = size_t{0u};
+    const auto model_loader_time_ms = bench::measure_ms([&]() {
+        const auto model = asset::ModelLoader::load_model(model_path.string(), import_config);
+        loaded_vertex_count = model.mesh_data.front().positions.size();
+    });
+
+    const auto parse_time_ms = bench::measure_ms([&]() {
+        auto data = fastgltf::GltfDataBuffer();
+        data.loadFromFile(model_path);
+
+        auto parser = fastgltf::Parser();
+        [[maybe_unused]] const auto gltf = parser.loadGLTF(&data, model_path.parent_path(), fastgltf::Options::None);
+    });
+
+    // Lower bound : copying the raw accessor bytes.
+    const auto &buffer_data = std::get<fastgltf::sources::Vector>(asset.buffers.front().data).bytes;
+    auto copy_destination = std::vector<uint8_t>(buffer_data.size());
+    const auto memcpy_time_ms = bench::measure_ms(
+        [&]() { std::memcpy(copy_destination.data(), buffer_data.data(), buffer_data.size()); });
+
+    const auto bulk_copy_time_ms = std::max(model_loader_time_ms - parse_time_ms, 0.0);
+
+    std::cout << std::format("{} vertices, {} indices ({:.2f} MB of accessor data), loaded {} vertices\n",
+                             VERTEX_COUNT, INDEX_COUNT,
+                             static_cast<double>(buffer_data.size()) / (1024.0 * 1024.0), loaded_vertex_count);
+    std::cout << std::format("{:<44} {:>12} {:>16}\n", "Path", "Time (ms)", "M vertices/s");
+    std::cout << std::format("{:<44} {:>12.3f} {:>16.1f}\n", "fastgltf::iterateAccessorWithIndex",
+                             iteration_time_ms, bench::get_throughput(VERTEX_COUNT, iteration_time_ms));
+    std::cout << std::format("{:<44} {:>12.3f}\n", "ModelLoader::load_model (total)", model_loader_time_ms);
+    std::cout << std::format("{:<44} {:>12.3f}\n", "  of which gltf parsing", parse_time_ms);
+    std::cout << std::format("{:<44} {:>12.3f} {:>16.1f}\n", "  bulk copy / conversion (total - parsing)",
+                             bulk_copy_time_ms, bench::get_throughput(VERTEX_COUNT, bulk_copy_time_ms));
+    std::cout << std::format("{:<44} {:>12.3f} {:>16.1f}\n", "memcpy of the buffer (lower bound)", memcpy_time_ms,
+                             bench::get_throughput(VERTEX_COUNT, memcpy_time_ms));
+    std::cout << std::format("Bulk copy is {:.1f}x faster than per element iteration\n",
+                             iteration_time_ms / std::max(bulk_copy_time_ms, 0.001));
+
+    std::filesystem::remove(model_path);
+    std::filesystem::remove(std::filesystem::path(model_path).replace_extension(".bin"));
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+// Benchmarks of serenity-bench. Each benchmark file registers its benchmarks with SERENITY_BENCHMARK, and the
+// benchmarks print their results (timings and any quality metrics) as a report to stdout.
+// Benchmarks create the job system themselves if they need one, as the thread count is part of what some of them
+// measure.
+#define SERENITY_BENCHMARK(name, description)                                                                          \
+    static void name##_benchmark();                                                                                    \
+    static const serenity::bench::BenchmarkRegistrar name##_benchmark_registrar{#name, description,                   \
+                                                                                &name##_benchmark};                    \
+    static void name##_benchmark()
+
+namespace serenity::bench
+{
+    struct Benchmark
+    {
+        std::string_view name{};
+        std::string_view description{};
+        void (*function)(){};
+    };
+
+    // All registered benchmarks, in registration order.
+    std::vector<Benchmark> &get_benchmarks();
+
+    // Model used by the model benchmarks (relative to the root directory, can be set with --model).
+    std::string_view get_model_path();
+
+    struct BenchmarkRegistrar
+    {
+        explicit BenchmarkRegistrar(const std::string_view name, const std::string_view description,
+                                    void (*function)())
+        {
+            get_benchmarks().push_back(Benchmark{
+                .name = name,
+                .description = description,
+                .function = function,
+            });
+        }
+    };
+
+    // Median time (in milliseconds) of iteration_count runs of function. The function is run once before the timed
+    // runs, so that caches (including the OS file cache) are warm.
+    template <typename Function> double measure_ms(Function &&function, const uint32_t iteration_count = 5u)
+    {
+        function();
+
+        auto timings = std::vector<double>{};
+        for (auto i = 0u; i < std::max(iteration_count, 1u); ++i)
+        {
+            const auto start_time = std::chrono::high_resolution_clock::now();
+            function();
+            const auto end_time = std::chrono::high_resolution_clock::now();
+
+            timings.push_back(std::chrono::duration<double, std::milli>(end_time - start_time).count());
+        }
+
+        std::sort(timings.begin(), timings.end());
+        return timings[timings.size() / 2u];
+    }
+
+    // Throughput (in millions of elements per second) of processing element_count elements in time_ms milliseconds.
+    inline double get_throughput(const size_t element_count, const double time_ms)
+    {
+        return static_cast<double>(element_count) / (time_ms * 1000.0);
+    }
+} // namespace serenity::bench
\ No newline at end of file
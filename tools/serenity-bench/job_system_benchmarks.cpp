@@ -0,0 +1,69 @@
+#include "benchmark.hpp"
+
+#include "serenity-engine/core/job_system.hpp"
+
+using namespace serenity;
+
+namespace
+{
+    constexpr auto ELEMENT_COUNT = size_t{1u} << 22u;
+    constexpr auto SMALL_JOB_COUNT = 100'000u;
+
+    // A few hundred cycles of ALU work per element, so that the benchmark measures scaling rather than memory
+    // bandwidth.
+    float compute_element(const size_t index)
+    {
+        auto value = static_cast<float>(index);
+        for ([[maybe_unused]] const auto i : std::views::iota(0u, 16u))
+        {
+            value = std::sqrt(value * 1.0001f + 1.0f);
+        }
+
+        return value;
+    }
+} // namespace
+
+SERENITY_BENCHMARK(job_system_scaling,
+                   "parallel_for and small job scheduling throughput with 1 .. hardware concurrency threads")
+{
+    auto output = std::vector<float>(ELEMENT_COUNT);
+
+    // The single threaded baseline does not use the job system (a job system always has at least one worker thread).
+    const auto serial_time_ms = bench::measure_ms([&]() {
+        for (const auto i : std::views::iota(size_t{0u}, ELEMENT_COUNT))
+        {
+            output[i] = compute_element(i);
+        }
+    });
+
+    std::cout << std::format("{:>8} {:>18} {:>10} {:>11} {:>22}\n", "threads", "parallel_for (ms)", "speedup",
+                             "efficiency", "small jobs (M jobs/s)");
+    std::cout << std::format("{:>8} {:>18.2f} {:>10.2f} {:>10.0f}% {:>22}\n", 1u, serial_time_ms, 1.0, 100.0, "-");
+
+    const auto max_thread_count = std::max(std::thread::hardware_concurrency(), 2u);
+    for (const auto thread_count : std::views::iota(2u, max_thread_count + 1u))
+    {
+        auto job_system = core::JobSystem(thread_count - 1u);
+
+        const auto parallel_for_time_ms = bench::measure_ms([&]() {
+            job_system.parallel_for(ELEMENT_COUNT, [&](const size_t i) { output[i] = compute_element(i); });
+        });
+
+        // Scheduling overhead : many jobs that do (almost) no work.
+        auto executed_job_count = std::atomic<uint32_t>{0u};
+        const auto small_jobs_time_ms = bench::measure_ms([&]() {
+            auto counter = core::JobCounter{};
+            for ([[maybe_unused]] const auto i : std::views::iota(0u, SMALL_JOB_COUNT))
+            {
+                job_system.schedule([&]() { executed_job_count.fetch_add(1u, std::memory_order_relaxed); }, counter);
+            }
+
+            job_system.wait(counter);
+        });
+
+        const auto speedup = serial_time_ms / parallel_for_time_ms;
+        std::cout << std::format("{:>8} {:>18.2f} {:>10.2f} {:>10.0f}% {:>22.2f}\n", thread_count,
+                                 parallel_for_time_ms, speedup, speedup / thread_count * 100.0,
+                                 bench::get_throughput(SMALL_JOB_COUNT, small_jobs_time_ms));
+    }
+}
\ No newline at end of file
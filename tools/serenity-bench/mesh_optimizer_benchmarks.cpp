@@ -0,0 +1,197 @@
+#include "benchmark.hpp"
+
+#include "serenity-engine/asset/model_loader.hpp"
+
+using namespace serenity;
+
+namespace
+{
+    struct BenchmarkMesh
+    {
+        std::vector<math::XMFLOAT3> positions{};
+        std::vector<math::XMFLOAT3> normals{};
+        std::vector<math::XMFLOAT2> texture_coords{};
+        std::vector<uint32_t> indices{};
+    };
+
+    // Unit sphere with ring_count * segment_count * 2 triangles (minus the degenerate triangles at the poles), with
+    // the index buffer optimized for the vertex cache (as it is at import, before meshlets / LODs are built). The
+    // first and last vertex of each ring share their position, so the texture coords have a seam.
+    BenchmarkMesh create_sphere(const uint32_t ring_count, const uint32_t segment_count)
+    {
+        auto mesh = BenchmarkMesh{};
+
+        for (const auto ring : std::views::iota(0u, ring_count + 1u))
+        {
+            for (const auto segment : std::views::iota(0u, segment_count + 1u))
+            {
+                const auto theta = math::XM_PI * static_cast<float>(ring) / static_cast<float>(ring_count);
+                const auto phi = math::XM_2PI * static_cast<float>(segment) / static_cast<float>(segment_count);
+
+                mesh.positions.emplace_back(std::sin(theta) * std::cos(phi), std::cos(theta),
+                                            std::sin(theta) * std::sin(phi));
+                mesh.normals.push_back(mesh.positions.back());
+                mesh.texture_coords.emplace_back(static_cast<float>(segment) / static_cast<float>(segment_count),
+                                                 static_cast<float>(ring) / static_cast<float>(ring_count));
+            }
+        }
+
+        for (const auto ring : std::views::iota(0u, ring_count))
+        {
+            for (const auto segment : std::views::iota(0u, segment_count))
+            {
+                const auto vertex = ring * (segment_count + 1u) + segment;
+
+                if (ring != 0u)
+                {
+                    mesh.indices.insert(mesh.indices.end(), {vertex, vertex + 1u, vertex + segment_count + 1u});
+                }
+
+                if (ring != ring_count - 1u)
+                {
+                    mesh.indices.insert(mesh.indices.end(),
+                                        {vertex + 1u, vertex + segment_count + 2u, vertex + segment_count + 1u});
+                }
+            }
+        }
+
+        asset::MeshOptimizer::optimize_vertex_cache(mesh.indices, mesh.positions.size());
+
+        return mesh;
+    }
+} // namespace
+
+SERENITY_BENCHMARK(meshlet_generation, "Meshlet build and CPU cluster culling throughput on a million triangle mesh")
+{
+    const auto mesh = create_sphere(512u, 1024u);
+    const auto triangle_count = mesh.indices.size() / 3u;
+
+    std::cout << std::format("Mesh : {} vertices, {} triangles\n", mesh.positions.size(), triangle_count);
+    std::cout << std::format("{:<12} {:>10} {:>14} {:>10} {:>14} {:>16} {:>12}\n", "Limits", "Time (ms)",
+                             "M triangles/s", "Meshlets", "Vertex fill", "Triangle fill", "With cone");
+
+    constexpr auto LIMITS = std::array<std::pair<uint32_t, uint32_t>, 3u>{{{64u, 124u}, {128u, 256u}, {255u, 512u}}};
+
+    auto meshlet_data = asset::MeshletData{};
+    for (const auto &[max_vertices, max_triangles] : LIMITS)
+    {
+        const auto time_ms = bench::measure_ms([&]() {
+            meshlet_data =
+                asset::MeshOptimizer::build_meshlets(mesh.indices, mesh.positions, max_vertices, max_triangles);
+        });
+
+        const auto meshlet_count = meshlet_data.meshlets.size();
+        const auto cone_meshlet_count = std::ranges::count_if(
+            meshlet_data.meshlets, [](const asset::Meshlet &meshlet) { return meshlet.cone_cutoff < 1.0f; });
+
+        // Average utilization of the meshlet limits.
+        const auto vertex_fill = static_cast<double>(meshlet_data.vertices.size()) / (meshlet_count * max_vertices);
+        const auto triangle_fill = static_cast<double>(triangle_count) / (meshlet_count * max_triangles);
+
+        std::cout << std::format("{:<12} {:>10.2f} {:>14.1f} {:>10} {:>13.1f}% {:>15.1f}% {:>11.1f}%\n",
+                                 std::format("{} / {}", max_vertices, max_triangles), time_ms,
+                                 bench::get_throughput(triangle_count, time_ms), meshlet_count, vertex_fill * 100.0,
+                                 triangle_fill * 100.0, cone_meshlet_count * 100.0 / meshlet_count);
+    }
+
+    // Culling all meshlets (of the last build) from a camera outside of the sphere, against a plane that cuts the
+    // sphere in half and the normal cones.
+    const auto camera_position = math::XMFLOAT3(0.0f, 0.0f, -3.0f);
+    const auto planes = std::array<math::XMFLOAT4, 1u>{math::XMFLOAT4(1.0f, 0.0f, 0.0f, 0.0f)};
+
+    auto culled_meshlet_count = size_t{0u};
+    const auto culling_time_ms = bench::measure_ms([&]() {
+        culled_meshlet_count = 0u;
+        for (const auto &meshlet : meshlet_data.meshlets)
+        {
+            if (asset::MeshOptimizer::is_meshlet_outside_planes(meshlet, planes) ||
+                asset::MeshOptimizer::is_meshlet_back_facing(meshlet, camera_position))
+            {
+                ++culled_meshlet_count;
+            }
+        }
+    });
+
+    std::cout << std::format("Culling : {:.3f} ms for {} meshlets ({:.1f} M meshlets/s), {:.1f}% culled\n",
+                             culling_time_ms, meshlet_data.meshlets.size(),
+                             bench::get_throughput(meshlet_data.meshlets.size(), culling_time_ms),
+                             culled_meshlet_count * 100.0 / meshlet_data.meshlets.size());
+}
+
+SERENITY_BENCHMARK(lod_generation, "LOD chain generation time, and simplification error vs triangle count")
+{
+    const auto mesh = create_sphere(256u, 512u);
+    const auto triangle_count = mesh.indices.size() / 3u;
+
+    // The maximum distance of the (simplified) surface from the unit sphere, sampled at the vertices, edge midpoints
+    // and centroids of the triangles. This is the actual geometric error, which the error recorded by the simplifier
+    // is an estimate of.
+    const auto get_surface_deviation = [&](const std::span<const uint32_t> indices) {
+        auto max_deviation = 0.0f;
+        for (const auto triangle : std::views::iota(size_t{0u}, indices.size() / 3u))
+        {
+            const auto a = math::XMLoadFloat3(&mesh.positions[indices[triangle * 3u + 0u]]);
+            const auto b = math::XMLoadFloat3(&mesh.positions[indices[triangle * 3u + 1u]]);
+            const auto c = math::XMLoadFloat3(&mesh.positions[indices[triangle * 3u + 2u]]);
+
+            for (const auto &sample : {a, (a + b) * 0.5f, (b + c) * 0.5f, (c + a) * 0.5f, (a + b + c) / 3.0f})
+            {
+                max_deviation =
+                    std::max(max_deviation, std::abs(1.0f - math::XMVectorGetX(math::XMVector3Length(sample))));
+            }
+        }
+
+        return max_deviation;
+    };
+
+    // LOD chain generation with the default import settings (the error limit is relative to the mesh extent, which
+    // is 2 for the unit sphere).
+    const auto import_config = asset::ModelImportConfig{};
+    const auto max_lod_count = 6u;
+
+    auto lods = std::vector<asset::MeshLod>{};
+    const auto lod_time_ms = bench::measure_ms(
+        [&]() {
+            lods = asset::MeshOptimizer::generate_lods(mesh.indices, mesh.positions, mesh.normals, mesh.texture_coords,
+                                                       max_lod_count, import_config.lod_triangle_ratio,
+                                                       import_config.max_lod_error);
+        },
+        3u);
+
+    std::cout << std::format("Mesh : {} vertices, {} triangles\n", mesh.positions.size(), triangle_count);
+    std::cout << std::format("LOD chain ({} levels) : {:.2f} ms ({:.2f} M input triangles/s)\n", lods.size(),
+                             lod_time_ms, bench::get_throughput(triangle_count, lod_time_ms));
+
+    std::cout << std::format("{:<6} {:>12} {:>10} {:>16} {:>18}\n", "LOD", "Triangles", "Ratio", "Recorded error",
+                             "Measured error");
+    std::cout << std::format("{:<6} {:>12} {:>9.2f}% {:>16.5f} {:>18.5f}\n", 0u, triangle_count, 100.0, 0.0f,
+                             get_surface_deviation(mesh.indices));
+
+    for (const auto i : std::views::iota(size_t{0u}, lods.size()))
+    {
+        const auto lod_triangle_count = lods[i].indices.size() / 3u;
+        std::cout << std::format("{:<6} {:>12} {:>9.2f}% {:>16.5f} {:>18.5f}\n", i + 1u, lod_triangle_count,
+                                 lod_triangle_count * 100.0 / triangle_count, lods[i].error,
+                                 get_surface_deviation(lods[i].indices));
+    }
+
+    // Error vs triangle count, simplifying the full detail mesh directly to each target without an error limit.
+    std::cout << std::format("\n{:<14} {:>12} {:>12} {:>16} {:>18}\n", "Target ratio", "Triangles", "Time (ms)",
+                             "Recorded error", "Measured error");
+
+    for (const auto target_ratio : {0.5f, 0.25f, 0.1f, 0.05f, 0.02f, 0.01f})
+    {
+        const auto target_index_count = static_cast<size_t>(static_cast<float>(triangle_count) * target_ratio) * 3u;
+
+        auto lod = asset::MeshLod{};
+        const auto time_ms = bench::measure_ms(
+            [&]() {
+                lod = asset::MeshOptimizer::simplify(mesh.indices, mesh.positions, mesh.normals, mesh.texture_coords,
+                                                     target_index_count, std::numeric_limits<float>::max());
+            },
+            1u);
+
+        std::cout << std::format("{:<14.2f} {:>12} {:>12.2f} {:>16.5f} {:>18.5f}\n", target_ratio,
+                                 lod.indices.size() / 3u, time_ms, lod.error, get_surface_deviation(lod.indices));
+    }
+}
\ No newline at end of file
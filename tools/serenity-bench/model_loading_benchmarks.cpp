@@ -0,0 +1,97 @@
+#include "benchmark.hpp"
+
+#include "serenity-engine/asset/model_cooker.hpp"
+#include "serenity-engine/core/file_system.hpp"
+#include "serenity-engine/core/job_system.hpp"
+
+using namespace serenity;
+
+namespace
+{
+    // Sum of (a sample of) the data of the cooked model. The cooked model is memory mapped, so the data is only read
+    // from the file once it is accessed, which a scene does when uploading the model.
+    double touch_cooked_model(const asset::CookedModel &cooked_model)
+    {
+        auto sum = 0.0;
+        for (const auto &mesh : cooked_model.get_meshes())
+        {
+            for (const auto &position : cooked_model.get_positions(mesh))
+            {
+                sum += position.x;
+            }
+
+            for (const auto &normal : cooked_model.get_normals(mesh))
+            {
+                sum += normal.x;
+            }
+
+            for (const auto &texture_coord : cooked_model.get_texture_coords(mesh))
+            {
+                sum += texture_coord.x;
+            }
+
+            std::visit(
+                [&](const auto indices) {
+                    for (const auto index : indices)
+                    {
+                        sum += index;
+                    }
+                },
+                cooked_model.get_indices(mesh));
+        }
+
+        // One byte per page is enough to read the texture data from the file.
+        for (const auto &texture : cooked_model.get_textures())
+        {
+            const auto texture_data = cooked_model.get_texture_data(texture);
+            for (auto i = size_t{0u}; i < texture_data.size(); i += 4096u)
+            {
+                sum += static_cast<uint8_t>(texture_data[i]);
+            }
+        }
+
+        return sum;
+    }
+} // namespace
+
+SERENITY_BENCHMARK(model_loading, "Load time of a gltf model vs the same model cooked into a .smesh file")
+{
+    const auto job_system = std::make_unique<core::JobSystem>();
+
+    const auto model_path = core::FileSystem::instance().get_absolute_path(bench::get_model_path());
+    const auto cooked_model_path =
+        (std::filesystem::temp_directory_path() / "serenity_bench_model_loading.smesh").string();
+
+    // Both paths use the same import config, so the difference is the parsing / processing done at import.
+    const auto import_config = asset::ModelImportConfig{};
+    asset::ModelCooker::cook_model(model_path, cooked_model_path, import_config);
+
+    auto vertex_count = size_t{0u};
+    const auto gltf_time = bench::measure_ms(
+        [&]() {
+            const auto model_data = asset::ModelLoader::load_model(model_path, import_config);
+
+            vertex_count = 0u;
+            for (const auto &mesh_data : model_data.mesh_data)
+            {
+                vertex_count += mesh_data.positions.size();
+            }
+        },
+        3u);
+
+    auto checksum = 0.0;
+    const auto cooked_time = bench::measure_ms([&]() {
+        const auto cooked_model = asset::CookedModel(cooked_model_path);
+        checksum = touch_cooked_model(cooked_model);
+    });
+
+    std::cout << std::format("Model : {} ({} vertices, cooked size : {:.2f} MB)\n", bench::get_model_path(),
+                             vertex_count,
+                             static_cast<double>(std::filesystem::file_size(cooked_model_path)) / (1024.0 * 1024.0));
+    std::cout << std::format("{:<10} {:>12}\n", "Format", "Time (ms)");
+    std::cout << std::format("{:<10} {:>12.3f}\n", "gltf", gltf_time);
+    std::cout << std::format("{:<10} {:>12.3f}\n", "cooked", cooked_time);
+    std::cout << std::format("Cooked model loads {:.1f}x faster (checksum {})\n", gltf_time / cooked_time, checksum);
+
+    std::filesystem::remove(cooked_model_path);
+}
\ No newline at end of file
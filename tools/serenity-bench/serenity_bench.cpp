@@ -0,0 +1,90 @@
+#include "benchmark.hpp"
+
+#include "serenity-engine/core/file_system.hpp"
+
+// serenity-bench : Benchmarks of the core systems and the asset pipeline (serenity-engine-core), which print a report
+// of their timings / quality metrics. Like serenity-cooker, it does not depend on windows / D3D12, and must be run
+// from within the project directory (so that the models in the data directory can be found).
+//
+// Usage : serenity-bench [--list] [--model <model path>] [benchmark name ...]
+// If no benchmark names are given, all benchmarks are run.
+
+using namespace serenity;
+
+namespace
+{
+    auto g_model_path = std::string("data/sketchfab_pbr_material_reference_chart/scene.gltf");
+} // namespace
+
+namespace serenity::bench
+{
+    std::vector<Benchmark> &get_benchmarks()
+    {
+        static auto benchmarks = std::vector<Benchmark>{};
+        return benchmarks;
+    }
+
+    std::string_view get_model_path()
+    {
+        return g_model_path;
+    }
+} // namespace serenity::bench
+
+int main(int argc, char **argv)
+{
+    auto benchmark_names = std::vector<std::string_view>{};
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        const auto argument = std::string_view(argv[i]);
+
+        if (argument == "--list")
+        {
+            for (const auto &benchmark : bench::get_benchmarks())
+            {
+                std::cout << std::format("{:<24} {}\n", benchmark.name, benchmark.description);
+            }
+
+            return EXIT_SUCCESS;
+        }
+        else if (argument == "--model" && i + 1 < argc)
+        {
+            g_model_path = argv[++i];
+        }
+        else if (argument.starts_with("--"))
+        {
+            std::cerr << "Usage : serenity-bench [--list] [--model <model path>] [benchmark name ...]\n";
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            benchmark_names.push_back(argument);
+        }
+    }
+
+    const auto log = std::make_unique<core::Log>(true, false);
+
+    try
+    {
+        const auto file_system = std::make_unique<core::FileSystem>();
+
+        for (const auto &benchmark : bench::get_benchmarks())
+        {
+            if (!benchmark_names.empty() &&
+                std::find(benchmark_names.begin(), benchmark_names.end(), benchmark.name) == benchmark_names.end())
+            {
+                continue;
+            }
+
+            std::cout << std::format("\n== {} : {}\n", benchmark.name, benchmark.description);
+            benchmark.function();
+        }
+    }
+    catch (const std::exception &exception)
+    {
+        core::Log::instance().error(std::format("Benchmark failed : {}", exception.what()));
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,285 @@
+#include "benchmark.hpp"
+
+#include "serenity-engine/asset/float_conversion.hpp"
+#include "serenity-engine/asset/texture_loader.hpp"
+#include "serenity-engine/core/job_system.hpp"
+
+using namespace serenity;
+
+namespace
+{
+    // Deterministic 4 channel test image : smooth gradients with per texel noise, so that the filtered values cover
+    // the whole 8 bit range and are rarely exactly representable.
+    asset::TextureData create_test_texture(const uint32_t size)
+    {
+        auto data = std::vector<uint8_t>(static_cast<size_t>(size) * size * 4u);
+
+        for (const auto y : std::views::iota(0u, size))
+        {
+            for (const auto x : std::views::iota(0u, size))
+            {
+                auto hash = (x * 73856093u) ^ (y * 19349663u);
+                hash = (hash ^ (hash >> 13u)) * 0x5bd1e995u;
+
+                auto *texel = data.data() + (static_cast<size_t>(y) * size + x) * 4u;
+                texel[0] = static_cast<uint8_t>(x * 255u / size);
+                texel[1] = static_cast<uint8_t>(y * 255u / size);
+                texel[2] = static_cast<uint8_t>(hash >> 24u);
+                texel[3] = static_cast<uint8_t>(128u + ((hash >> 16u) & 0x3fu));
+            }
+        }
+
+        return asset::TextureData{
+            .dimension = Uint2{.x = size, .y = size},
+            .num_channels = 4u,
+            .data = std::move(data),
+        };
+    }
+
+    // Straightforward single threaded version of TextureLoader::generate_mip_chain for 4 channel 8 bit textures : each
+    // level is box filtered from the (float, linear) previous level, and the sRGB conversions use the exact formulas
+    // rather than lookup tables.
+    std::vector<uint8_t> generate_reference_mip_chain(const asset::TextureData &texture_data, const bool is_srgb)
+    {
+        const auto srgb_to_linear = [](const float value) {
+            return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        };
+
+        const auto linear_to_srgb = [](const float value) {
+            return value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        };
+
+        const auto dimension = texture_data.dimension;
+        const auto mip_levels = asset::TextureLoader::get_mip_level_count(dimension);
+        const auto &base_level = std::get<std::vector<uint8_t>>(texture_data.data);
+
+        auto mip_chain =
+            std::vector<uint8_t>(asset::TextureLoader::get_mip_chain_texel_count(dimension, mip_levels) * 4u);
+        std::copy(base_level.begin(), base_level.end(), mip_chain.begin());
+
+        auto source = std::vector<float>(base_level.size());
+        for (const auto i : std::views::iota(size_t{0u}, base_level.size()))
+        {
+            const auto value = base_level[i] / 255.0f;
+            source[i] = is_srgb && i % 4u != 3u ? srgb_to_linear(value) : value;
+        }
+
+        for (const auto mip_level : std::views::iota(1u, mip_levels))
+        {
+            const auto source_dimension = asset::TextureLoader::get_mip_dimension(dimension, mip_level - 1u);
+            const auto destination_dimension = asset::TextureLoader::get_mip_dimension(dimension, mip_level);
+
+            auto *output =
+                mip_chain.data() + asset::TextureLoader::get_mip_chain_texel_count(dimension, mip_level) * 4u;
+            auto destination =
+                std::vector<float>(static_cast<size_t>(destination_dimension.x) * destination_dimension.y * 4u);
+
+            for (const auto y : std::views::iota(0u, destination_dimension.y))
+            {
+                for (const auto x : std::views::iota(0u, destination_dimension.x))
+                {
+                    const auto rows = std::array{y * 2u, std::min(y * 2u + 1u, source_dimension.y - 1u)};
+                    const auto columns = std::array{x * 2u, std::min(x * 2u + 1u, source_dimension.x - 1u)};
+
+                    for (const auto channel : std::views::iota(0u, 4u))
+                    {
+                        auto sum = 0.0f;
+                        for (const auto row : rows)
+                        {
+                            for (const auto column : columns)
+                            {
+                                sum += source[(static_cast<size_t>(row) * source_dimension.x + column) * 4u + channel];
+                            }
+                        }
+
+                        const auto index = (static_cast<size_t>(y) * destination_dimension.x + x) * 4u + channel;
+                        destination[index] = sum * 0.25f;
+
+                        const auto value = std::clamp(destination[index], 0.0f, 1.0f);
+                        output[index] = static_cast<uint8_t>(
+                            std::round((is_srgb && channel != 3u ? linear_to_srgb(value) : value) * 255.0f));
+                    }
+                }
+            }
+
+            source = std::move(destination);
+        }
+
+        return mip_chain;
+    }
+
+    // Deterministic 4 channel HDR test image, with values from 2^-20 to 2^20 (so that the denormal and overflow paths
+    // of the conversions are used) and some negative values.
+    asset::TextureData create_test_hdr_texture(const uint32_t size)
+    {
+        auto data = std::vector<float>(static_cast<size_t>(size) * size * 4u);
+
+        for (const auto i : std::views::iota(size_t{0u}, data.size()))
+        {
+            auto hash = static_cast<uint32_t>(i) * 0x9e3779b9u;
+            hash = (hash ^ (hash >> 15u)) * 0x85ebca6bu;
+
+            const auto exponent = static_cast<int>(hash >> 27u) - 16;
+            const auto mantissa = 1.0f + static_cast<float>((hash >> 8u) & 0xffffu) / 65536.0f;
+            const auto sign = (hash & 0xffu) < 8u ? -1.0f : 1.0f;
+
+            data[i] = sign * std::ldexp(mantissa, exponent);
+        }
+
+        return asset::TextureData{
+            .dimension = Uint2{.x = size, .y = size},
+            .num_channels = 4u,
+            .data = std::move(data),
+        };
+    }
+} // namespace
+
+SERENITY_BENCHMARK(mip_generation, "Mip chain generation of 4K textures vs a scalar single threaded reference")
+{
+    constexpr auto TEXTURE_SIZE = 4096u;
+
+    const auto base_texture = create_test_texture(TEXTURE_SIZE);
+    const auto mip_levels = asset::TextureLoader::get_mip_level_count(base_texture.dimension);
+
+    std::cout << std::format("Texture : {} x {}, 4 channels, {} mip levels\n", TEXTURE_SIZE, TEXTURE_SIZE, mip_levels);
+
+    const auto job_system = std::make_unique<core::JobSystem>();
+
+    std::cout << std::format("{:<8} {:>16} {:>16} {:>10} {:>14} {:>14}\n", "Space", "Reference (ms)",
+                             std::format("Engine ({}T, ms)", job_system->get_thread_count()), "Speedup",
+                             "Max difference", "Differing");
+
+    for (const auto is_srgb : {false, true})
+    {
+        auto reference_mip_chain = std::vector<uint8_t>{};
+        const auto reference_time_ms = bench::measure_ms(
+            [&]() { reference_mip_chain = generate_reference_mip_chain(base_texture, is_srgb); }, 1u);
+
+        // generate_mip_chain replaces the base level with the mip chain, so each run starts from a copy of the base
+        // level (the time of the copy is not included).
+        auto texture_data = asset::TextureData{};
+        const auto copy_time_ms = bench::measure_ms([&]() { texture_data = base_texture; });
+        const auto time_ms = bench::measure_ms([&]() {
+            texture_data = base_texture;
+            asset::TextureLoader::generate_mip_chain(texture_data, is_srgb);
+        }) - copy_time_ms;
+
+        // Differences to the reference (in 8 bit steps), over all mip levels. The engine uses lookup tables for the
+        // sRGB conversions, which can round differently by one step.
+        const auto &mip_chain = std::get<std::vector<uint8_t>>(texture_data.data);
+
+        auto max_difference = 0;
+        auto differing_count = size_t{0u};
+        for (const auto i : std::views::iota(size_t{0u}, mip_chain.size()))
+        {
+            const auto difference =
+                std::abs(static_cast<int>(mip_chain[i]) - static_cast<int>(reference_mip_chain[i]));
+            max_difference = std::max(max_difference, difference);
+            differing_count += difference != 0;
+        }
+
+        std::cout << std::format("{:<8} {:>16.2f} {:>16.2f} {:>9.2f}x {:>14} {:>13.4f}%\n",
+                                 is_srgb ? "sRGB" : "Linear", reference_time_ms, time_ms, reference_time_ms / time_ms,
+                                 max_difference, differing_count * 100.0 / mip_chain.size());
+    }
+}
+
+SERENITY_BENCHMARK(float_conversion,
+                   "Float to half / R11G11B10 conversion of 4K HDR textures vs the scalar conversion functions")
+{
+    constexpr auto TEXTURE_SIZE = 4096u;
+
+    const auto base_texture = create_test_hdr_texture(TEXTURE_SIZE);
+    const auto &float_data = std::get<std::vector<float>>(base_texture.data);
+    const auto texel_count = float_data.size() / 4u;
+
+    std::cout << std::format("Texture : {} x {}, 4 channels\n", TEXTURE_SIZE, TEXTURE_SIZE);
+
+    const auto job_system = std::make_unique<core::JobSystem>();
+
+    // The SIMD column converts the whole texture on a single thread, while the engine column is the (parallel) texture
+    // conversion of the texture loader.
+    std::cout << std::format("{:<10} {:>12} {:>12} {:>18} {:>14} {:>10} {:>11}\n", "Format", "Scalar (ms)",
+                             "SIMD (ms)", std::format("Engine ({}T, ms)", job_system->get_thread_count()),
+                             "M texels/s", "Speedup", "Differing");
+
+    const auto print_row = [&](const std::string_view format, const double scalar_time_ms, const double simd_time_ms,
+                               const double engine_time_ms, const size_t differing_count, const size_t value_count) {
+        std::cout << std::format("{:<10} {:>12.2f} {:>12.2f} {:>18.2f} {:>14.1f} {:>9.2f}x {:>10.4f}%\n", format,
+                                 scalar_time_ms, simd_time_ms, engine_time_ms,
+                                 bench::get_throughput(texel_count, engine_time_ms), scalar_time_ms / engine_time_ms,
+                                 differing_count * 100.0 / value_count);
+    };
+
+    // convert_float_texture consumes the float data, so each run starts from a (newly allocated) copy of the texture
+    // (the time of the copy is not included).
+    auto texture_data = asset::TextureData{};
+    const auto copy_time_ms = bench::measure_ms([&]() {
+        texture_data = asset::TextureData{};
+        texture_data = base_texture;
+    });
+
+    const auto measure_engine_ms = [&](const asset::FloatTextureFormat format) {
+        return bench::measure_ms([&]() {
+            texture_data = asset::TextureData{};
+            texture_data = base_texture;
+            asset::TextureLoader::convert_float_texture(texture_data, format);
+        }) - copy_time_ms;
+    };
+
+    // Half floats.
+    {
+        auto reference_halves = std::vector<uint16_t>(float_data.size());
+        const auto scalar_time_ms = bench::measure_ms([&]() {
+            for (const auto i : std::views::iota(size_t{0u}, float_data.size()))
+            {
+                reference_halves[i] = asset::FloatConversion::convert_float_to_half(float_data[i]);
+            }
+        });
+
+        auto halves = std::vector<uint16_t>(float_data.size());
+        const auto simd_time_ms =
+            bench::measure_ms([&]() { asset::FloatConversion::convert_floats_to_halves(float_data, halves); });
+
+        const auto engine_time_ms = measure_engine_ms(asset::FloatTextureFormat::Float16);
+
+        // Differences to the scalar conversion, for both the single threaded and the engine conversion.
+        const auto &engine_halves = std::get<std::vector<uint16_t>>(texture_data.data);
+
+        auto differing_count = size_t{0u};
+        for (const auto i : std::views::iota(size_t{0u}, reference_halves.size()))
+        {
+            differing_count += halves[i] != reference_halves[i] || engine_halves[i] != reference_halves[i];
+        }
+
+        print_row("Half", scalar_time_ms, simd_time_ms, engine_time_ms, differing_count, reference_halves.size());
+    }
+
+    // R11G11B10 (the alpha channel is dropped).
+    {
+        auto reference_texels = std::vector<uint32_t>(texel_count);
+        const auto scalar_time_ms = bench::measure_ms([&]() {
+            for (const auto i : std::views::iota(size_t{0u}, texel_count))
+            {
+                const auto *texel = float_data.data() + i * 4u;
+                reference_texels[i] = asset::FloatConversion::pack_r11g11b10(texel[0], texel[1], texel[2]);
+            }
+        });
+
+        auto texels = std::vector<uint32_t>(texel_count);
+        const auto simd_time_ms = bench::measure_ms(
+            [&]() { asset::FloatConversion::convert_texels_to_r11g11b10(float_data, 4u, texels); });
+
+        const auto engine_time_ms = measure_engine_ms(asset::FloatTextureFormat::R11G11B10);
+
+        const auto &engine_texels = std::get<std::vector<uint32_t>>(texture_data.data);
+
+        auto differing_count = size_t{0u};
+        for (const auto i : std::views::iota(size_t{0u}, texel_count))
+        {
+            differing_count += texels[i] != reference_texels[i] || engine_texels[i] != reference_texels[i];
+        }
+
+        print_row("R11G11B10", scalar_time_ms, simd_time_ms, engine_time_ms, differing_count, texel_count);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,638 @@
+#include "serenity-engine/asset/asset_packer.hpp"
+#include "serenity-engine/asset/model_cooker.hpp"
+#include "serenity-engine/asset/texture_compressor.hpp"
+#include "serenity-engine/asset/texture_loader.hpp"
+#include "serenity-engine/core/file_system.hpp"
+#include "serenity-engine/core/job_system.hpp"
+#include "serenity-engine/core/memory_mapped_file.hpp"
+
+// serenity-cooker : Offline asset cooker, which converts the source assets in the data directory into engine ready
+// assets, so that they do not have to be imported at runtime.
+//  - gltf / glb models are cooked into .smesh files (see CookedModel), which are written to COOKED_DIRECTORY (at the
+//  same path relative to the data directory as the source model).
+//  - Images that are not used by any model are block compressed (with the full mip chain) into the texture cache (see
+//  TextureLoader::load_compressed_texture). The images used by models are part of the cooked models.
+// A dependency database records, for each cooked asset, the hash of every input file (the source file and the
+// buffers / images it references) and the hash of the cook settings (which include the versions of the cooker and the
+// file formats / encoders). Only assets whose inputs or settings have changed (or whose output is missing) are cooked
+// again, and independent assets are cooked in parallel using the job system.
+//
+// With --pack, all files in the data directory (source assets, cooked assets and the texture cache) are packed into
+// the asset archive (FileSystem::ASSET_ARCHIVE_PATH) after cooking, which the engine mounts at startup.
+//
+// Usage : serenity-cooker [--force] [--pack] [--threads <worker thread count>]
+// --force cooks all assets, regardless of the dependency database.
+// The cooker does not depend on windows / D3D12 (only on serenity-engine-core), so it can run headless on any
+// platform. The root directory is located the same way as in the engine (see FileSystem), so it must be run from
+// within the project directory.
+
+using namespace serenity;
+
+namespace
+{
+    // Increment when a change to the cooker / importers changes the cooked assets. The cooked model version and the
+    // texture encoder version are part of the settings hash as well.
+    constexpr uint32_t COOKER_VERSION = 1u;
+
+    constexpr uint32_t DATABASE_VERSION = 1u;
+
+    // Relative to the root directory.
+    constexpr std::string_view DATA_DIRECTORY = "data";
+    constexpr std::string_view COOKED_DIRECTORY = "data/cooked";
+    constexpr std::string_view DATABASE_PATH = "data/cooked/cooker_database.txt";
+
+    constexpr auto MODEL_EXTENSIONS = std::array<std::string_view, 2u>{".gltf", ".glb"};
+    constexpr auto IMAGE_EXTENSIONS = std::array<std::string_view, 5u>{".png", ".jpg", ".jpeg", ".tga", ".bmp"};
+
+    // Files that are stored uncompressed in the asset archive : cooked models / textures are used directly from the
+    // archive mapping, and png / jpg files are already compressed.
+    constexpr auto UNCOMPRESSED_PACKED_FILE_EXTENSIONS =
+        std::array<std::string_view, 5u>{".smesh", ".stex", ".png", ".jpg", ".jpeg"};
+
+    // Images are compressed with the same settings as base color textures of models.
+    constexpr auto TEXTURE_COMPRESSION = asset::TextureCompression::BC7;
+    constexpr auto TEXTURE_IS_SRGB = true;
+
+    // Cooking is done offline, so the processing that is too expensive for runtime imports is enabled.
+    const auto MODEL_IMPORT_CONFIG = asset::ModelImportConfig{
+        .optimize_overdraw = true,
+        .generate_meshlets = true,
+        .generate_lods = true,
+        .texture_compression = TEXTURE_COMPRESSION,
+        .normal_texture_compression = asset::TextureCompression::BC5,
+        .generate_texture_atlases = true,
+    };
+
+    enum class AssetType
+    {
+        Model,
+        Texture,
+    };
+
+    struct InputFile
+    {
+        // Relative to the root directory.
+        std::string path{};
+
+        // The content hash is only computed again if the size or last write time of the file changed.
+        uint64_t size{};
+        int64_t last_write_time{};
+        uint64_t content_hash{};
+    };
+
+    struct AssetRecord
+    {
+        // Relative to the root directory. The output path is empty if cooking the asset produced no output (for ex.
+        // images that cannot be block compressed).
+        std::string source_path{};
+        std::string output_path{};
+
+        uint64_t settings_hash{};
+
+        // The first input is always the source file itself.
+        std::vector<InputFile> inputs{};
+    };
+
+    struct Asset
+    {
+        AssetType type{};
+        AssetRecord record{};
+
+        bool requires_cook{};
+        bool failed{};
+    };
+
+    using AssetDatabase = std::unordered_map<std::string, AssetRecord>;
+
+    // FNV-1a hash.
+    uint64_t get_hash(const std::span<const std::byte> data)
+    {
+        auto hash = uint64_t{14695981039346656037u};
+        for (const auto byte : data)
+        {
+            hash ^= static_cast<uint8_t>(byte);
+            hash *= uint64_t{1099511628211u};
+        }
+
+        return hash;
+    }
+
+    std::string get_absolute_path(const std::string_view path)
+    {
+        return core::FileSystem::instance().get_absolute_path(path);
+    }
+
+    std::string get_relative_path(const std::filesystem::path &path)
+    {
+        return std::filesystem::path(path)
+            .lexically_relative(core::FileSystem::instance().get_root_directory())
+            .generic_string();
+    }
+
+    std::string get_lowercase_extension(const std::filesystem::path &path)
+    {
+        auto extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(),
+                       [](const char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+
+        return extension;
+    }
+
+    uint64_t get_settings_hash(const AssetType asset_type)
+    {
+        const auto &config = MODEL_IMPORT_CONFIG;
+
+        const auto settings =
+            asset_type == AssetType::Model
+                ? std::format("model {} {} {} {} {} {} {} {} {} {} {} {} {} {} {} {} {} {} {} {}", COOKER_VERSION,
+                              asset::COOKED_MODEL_VERSION, asset::TextureCompressor::ENCODER_VERSION,
+                              config.optimize_vertex_cache, config.optimize_overdraw, config.optimize_vertex_fetch,
+                              config.generate_meshlets, config.max_meshlet_vertices, config.max_meshlet_triangles,
+                              config.generate_lods, config.max_lod_count, config.lod_triangle_ratio,
+                              config.max_lod_error, config.quantize_vertices,
+                              static_cast<uint32_t>(config.texture_compression),
+                              static_cast<uint32_t>(config.normal_texture_compression),
+                              config.generate_texture_atlases, config.max_atlas_texture_dimension,
+                              config.texture_atlas_dimension, config.texture_atlas_padding)
+                : std::format("texture {} {} {} {}", COOKER_VERSION, asset::TextureCompressor::ENCODER_VERSION,
+                              static_cast<uint32_t>(TEXTURE_COMPRESSION), TEXTURE_IS_SRGB);
+
+        return get_hash(std::as_bytes(std::span{settings}));
+    }
+
+    // Get the current state of the input file. If the size and last write time match the previous record of the file,
+    // the previous content hash is used (so unchanged files are not read again).
+    InputFile get_input_file(const std::string_view path, const InputFile *previous_input_file)
+    {
+        auto input_file = InputFile{
+            .path = std::string(path),
+        };
+
+        const auto absolute_path = get_absolute_path(path);
+
+        auto error_code = std::error_code{};
+        input_file.size = std::filesystem::file_size(absolute_path, error_code);
+        if (error_code)
+        {
+            // The file is missing, so the asset will be cooked again (and fail to cook) until the file exists.
+            return InputFile{
+                .path = std::string(path),
+            };
+        }
+
+        input_file.last_write_time =
+            static_cast<int64_t>(std::filesystem::last_write_time(absolute_path).time_since_epoch().count());
+
+        if (previous_input_file && previous_input_file->size == input_file.size &&
+            previous_input_file->last_write_time == input_file.last_write_time)
+        {
+            input_file.content_hash = previous_input_file->content_hash;
+            return input_file;
+        }
+
+        const auto file = core::MemoryMappedFile(absolute_path);
+        input_file.content_hash = get_hash(file.get_span());
+
+        return input_file;
+    }
+
+    // Get the inputs of the asset, reusing the content hashes of the previous record where possible.
+    std::vector<InputFile> get_asset_inputs(const AssetType asset_type, const std::string &source_path,
+                                            const AssetRecord *previous_record)
+    {
+        const auto find_previous_input_file = [&](const std::string_view path) -> const InputFile * {
+            if (!previous_record)
+            {
+                return nullptr;
+            }
+
+            const auto itr = std::find_if(previous_record->inputs.begin(), previous_record->inputs.end(),
+                                          [&](const InputFile &input_file) { return input_file.path == path; });
+
+            return itr != previous_record->inputs.end() ? &*itr : nullptr;
+        };
+
+        auto inputs = std::vector<InputFile>{get_input_file(source_path, find_previous_input_file(source_path))};
+
+        if (asset_type == AssetType::Texture)
+        {
+            return inputs;
+        }
+
+        // The files referenced by a model can only change if the model file itself has changed, so the previous list
+        // of inputs is used if the model file is unchanged. Otherwise, the model is parsed to find its dependencies.
+        auto dependency_paths = std::vector<std::string>{};
+        if (const auto previous_source_file = find_previous_input_file(source_path);
+            previous_source_file && previous_source_file->content_hash == inputs.front().content_hash)
+        {
+            for (const auto &input_file : previous_record->inputs | std::views::drop(1))
+            {
+                dependency_paths.emplace_back(input_file.path);
+            }
+        }
+        else
+        {
+            for (const auto &dependency_path :
+                 asset::ModelLoader::get_model_dependencies(get_absolute_path(source_path)) | std::views::drop(1))
+            {
+                dependency_paths.emplace_back(get_relative_path(dependency_path));
+            }
+        }
+
+        for (const auto &dependency_path : dependency_paths)
+        {
+            inputs.emplace_back(get_input_file(dependency_path, find_previous_input_file(dependency_path)));
+        }
+
+        return inputs;
+    }
+
+    // Database format (a text file, with tab separated fields) :
+    // serenity-cooker database <DATABASE_VERSION>
+    // asset <source path> <output path, or - if there is no output> <settings hash>
+    // input <path> <size> <last write time> <content hash>   (inputs of the previous asset)
+    AssetDatabase read_database()
+    {
+        auto database = AssetDatabase{};
+
+        auto file = std::ifstream(get_absolute_path(DATABASE_PATH));
+        if (!file.is_open())
+        {
+            return database;
+        }
+
+        auto line = std::string{};
+        if (!std::getline(file, line) || line != std::format("serenity-cooker database {}", DATABASE_VERSION))
+        {
+            core::Log::instance().warn("Dependency database is of a different version, all assets will be cooked");
+            return database;
+        }
+
+        auto current_record = static_cast<AssetRecord *>(nullptr);
+
+        try
+        {
+            while (std::getline(file, line))
+            {
+                auto fields = std::vector<std::string>{};
+                for (const auto field : std::views::split(line, '\t'))
+                {
+                    fields.emplace_back(field.begin(), field.end());
+                }
+
+                if (fields.size() == 4u && fields[0] == "asset")
+                {
+                    current_record = &database[fields[1]];
+                    *current_record = AssetRecord{
+                        .source_path = fields[1],
+                        .output_path = fields[2] == "-" ? std::string{} : fields[2],
+                        .settings_hash = std::stoull(fields[3]),
+                    };
+                }
+                else if (fields.size() == 5u && fields[0] == "input" && current_record)
+                {
+                    current_record->inputs.emplace_back(InputFile{
+                        .path = fields[1],
+                        .size = std::stoull(fields[2]),
+                        .last_write_time = std::stoll(fields[3]),
+                        .content_hash = std::stoull(fields[4]),
+                    });
+                }
+                else
+                {
+                    throw std::runtime_error(std::format("Invalid line : {}", line));
+                }
+            }
+        }
+        catch (const std::exception &exception)
+        {
+            core::Log::instance().warn(std::format(
+                "Failed to parse dependency database ({}), all assets will be cooked", exception.what()));
+            return {};
+        }
+
+        return database;
+    }
+
+    void write_database(const std::vector<Asset> &assets)
+    {
+        const auto path = get_absolute_path(DATABASE_PATH);
+        const auto temporary_path = path + ".tmp";
+
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+
+        {
+            auto file = std::ofstream(temporary_path, std::ios::trunc);
+            if (!file.is_open())
+            {
+                core::Log::instance().critical(std::format("Failed to open file with path : {}", temporary_path));
+            }
+
+            file << std::format("serenity-cooker database {}\n", DATABASE_VERSION);
+
+            // Assets that failed to cook are not recorded, so they are cooked again on the next run.
+            for (const auto &asset : assets)
+            {
+                if (asset.failed)
+                {
+                    continue;
+                }
+
+                const auto &record = asset.record;
+                file << std::format("asset\t{}\t{}\t{}\n", record.source_path,
+                                    record.output_path.empty() ? "-" : record.output_path, record.settings_hash);
+
+                for (const auto &input_file : record.inputs)
+                {
+                    file << std::format("input\t{}\t{}\t{}\t{}\n", input_file.path, input_file.size,
+                                        input_file.last_write_time, input_file.content_hash);
+                }
+            }
+        }
+
+        std::filesystem::rename(temporary_path, path);
+    }
+
+    bool requires_cook(const AssetRecord &record, const AssetRecord *previous_record)
+    {
+        if (!previous_record || previous_record->settings_hash != record.settings_hash ||
+            previous_record->inputs.size() != record.inputs.size())
+        {
+            return true;
+        }
+
+        for (const auto i : std::views::iota(size_t{0u}, record.inputs.size()))
+        {
+            if (record.inputs[i].path != previous_record->inputs[i].path ||
+                record.inputs[i].content_hash != previous_record->inputs[i].content_hash)
+            {
+                return true;
+            }
+        }
+
+        return !previous_record->output_path.empty() &&
+               !std::filesystem::exists(get_absolute_path(previous_record->output_path));
+    }
+
+    // Returns the output path (relative to the root directory, empty if there is no output).
+    std::string cook_asset(const Asset &asset)
+    {
+        const auto source_path = get_absolute_path(asset.record.source_path);
+
+        if (asset.type == AssetType::Model)
+        {
+            // The cooked model has the same path relative to the cooked directory, as the model has relative to the
+            // data directory.
+            auto output_path = std::filesystem::path(COOKED_DIRECTORY) /
+                               std::filesystem::path(asset.record.source_path).lexically_relative(DATA_DIRECTORY);
+            output_path.replace_extension(".smesh");
+
+            const auto absolute_output_path = get_absolute_path(output_path.string());
+
+            std::filesystem::create_directories(std::filesystem::path(absolute_output_path).parent_path());
+            asset::ModelCooker::cook_model(source_path, absolute_output_path, MODEL_IMPORT_CONFIG);
+
+            return output_path.generic_string();
+        }
+
+        // The compressed texture is written to the texture cache by load_compressed_texture.
+        const auto file = core::MemoryMappedFile(source_path);
+        if (!file.is_valid())
+        {
+            core::Log::instance().critical(std::format("Failed to read image with path : {}", source_path));
+        }
+
+        [[maybe_unused]] const auto texture_data = asset::TextureLoader::load_compressed_texture(
+            file.get_data(), static_cast<uint32_t>(file.get_size()), TEXTURE_COMPRESSION, TEXTURE_IS_SRGB);
+
+        const auto cached_texture_path =
+            asset::TextureLoader::get_cached_texture_path(file.get_span(), TEXTURE_COMPRESSION, TEXTURE_IS_SRGB);
+
+        return std::filesystem::exists(cached_texture_path) ? get_relative_path(cached_texture_path) : std::string{};
+    }
+
+    // Find the source assets in the data directory (the cooked / cache directories are skipped).
+    std::vector<Asset> find_assets(const AssetType asset_type)
+    {
+        const auto &extensions = asset_type == AssetType::Model ? std::span<const std::string_view>(MODEL_EXTENSIONS)
+                                                                : std::span<const std::string_view>(IMAGE_EXTENSIONS);
+
+        const auto skipped_directories = std::array{
+            std::filesystem::path(get_absolute_path(COOKED_DIRECTORY)),
+            std::filesystem::path(get_absolute_path(asset::TextureLoader::TEXTURE_CACHE_DIRECTORY)),
+        };
+
+        auto assets = std::vector<Asset>{};
+
+        for (auto itr = std::filesystem::recursive_directory_iterator(get_absolute_path(DATA_DIRECTORY));
+             itr != std::filesystem::recursive_directory_iterator(); ++itr)
+        {
+            if (itr->is_directory())
+            {
+                if (std::find(skipped_directories.begin(), skipped_directories.end(), itr->path()) !=
+                    skipped_directories.end())
+                {
+                    itr.disable_recursion_pending();
+                }
+
+                continue;
+            }
+
+            if (std::find(extensions.begin(), extensions.end(), get_lowercase_extension(itr->path())) !=
+                extensions.end())
+            {
+                assets.emplace_back(Asset{
+                    .type = asset_type,
+                    .record =
+                        AssetRecord{
+                            .source_path = get_relative_path(itr->path()),
+                            .settings_hash = get_settings_hash(asset_type),
+                        },
+                });
+            }
+        }
+
+        // Sorted so that the database is written in a stable order.
+        std::sort(assets.begin(), assets.end(),
+                  [](const Asset &a, const Asset &b) { return a.record.source_path < b.record.source_path; });
+
+        return assets;
+    }
+
+    // Pack all files in the data directory (except the dependency database and the archive itself) into the asset
+    // archive.
+    void pack_data_directory()
+    {
+        const auto archive_path = std::filesystem::path(get_absolute_path(core::FileSystem::ASSET_ARCHIVE_PATH));
+        const auto database_path = std::filesystem::path(get_absolute_path(DATABASE_PATH));
+
+        auto files = std::vector<asset::PackedFile>{};
+
+        for (const auto &entry :
+             std::filesystem::recursive_directory_iterator(get_absolute_path(DATA_DIRECTORY)))
+        {
+            const auto extension = get_lowercase_extension(entry.path());
+
+            if (!entry.is_regular_file() || entry.path() == archive_path || entry.path() == database_path ||
+                extension == ".tmp")
+            {
+                continue;
+            }
+
+            files.emplace_back(asset::PackedFile{
+                .path = get_relative_path(entry.path()),
+                .source_path = entry.path().string(),
+                .allow_compression = std::find(UNCOMPRESSED_PACKED_FILE_EXTENSIONS.begin(),
+                                               UNCOMPRESSED_PACKED_FILE_EXTENSIONS.end(),
+                                               extension) == UNCOMPRESSED_PACKED_FILE_EXTENSIONS.end(),
+            });
+        }
+
+        asset::AssetPacker::pack_assets(core::FileSystem::ASSET_ARCHIVE_PATH, files);
+    }
+
+    // Compute the inputs of the assets (in parallel), and check which of the assets have to be cooked.
+    void update_assets(std::vector<Asset> &assets, const AssetDatabase &database, const bool force)
+    {
+        core::JobSystem::instance().parallel_for(
+            std::span{assets},
+            [&](Asset &asset, const size_t) {
+                const auto itr = database.find(asset.record.source_path);
+                const auto previous_record = itr != database.end() ? &itr->second : nullptr;
+
+                try
+                {
+                    asset.record.inputs = get_asset_inputs(asset.type, asset.record.source_path, previous_record);
+                }
+                catch (const std::exception &exception)
+                {
+                    core::Log::instance().error(std::format("Failed to get dependencies of asset {} : {}",
+                                                            asset.record.source_path, exception.what()));
+                    asset.failed = true;
+                    return;
+                }
+
+                asset.requires_cook = force || requires_cook(asset.record, previous_record);
+                if (!asset.requires_cook)
+                {
+                    asset.record.output_path = previous_record->output_path;
+                }
+            },
+            1u);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    auto force = false;
+    auto pack = false;
+    auto worker_thread_count = 0u;
+
+    for (auto i = 1; i < argc; ++i)
+    {
+        const auto argument = std::string_view(argv[i]);
+
+        if (argument == "--force")
+        {
+            force = true;
+        }
+        else if (argument == "--pack")
+        {
+            pack = true;
+        }
+        else if (argument == "--threads" && i + 1 < argc)
+        {
+            worker_thread_count = static_cast<uint32_t>(std::stoul(argv[++i]));
+        }
+        else
+        {
+            std::cerr << "Usage : serenity-cooker [--force] [--pack] [--threads <worker thread count>]\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto log = std::make_unique<core::Log>(true, false);
+
+    try
+    {
+        const auto file_system = std::make_unique<core::FileSystem>();
+        const auto job_system = std::make_unique<core::JobSystem>(worker_thread_count);
+
+        const auto start_time = std::chrono::high_resolution_clock::now();
+
+        const auto database = read_database();
+
+        // The images used by models are cooked as part of the models, so the model dependencies are required to find
+        // the standalone images.
+        auto assets = find_assets(AssetType::Model);
+        update_assets(assets, database, force);
+
+        auto model_inputs = std::unordered_set<std::string>{};
+        for (const auto &asset : assets)
+        {
+            for (const auto &input_file : asset.record.inputs)
+            {
+                model_inputs.insert(input_file.path);
+            }
+        }
+
+        auto textures = find_assets(AssetType::Texture);
+        std::erase_if(textures, [&](const Asset &asset) { return model_inputs.contains(asset.record.source_path); });
+        update_assets(textures, database, force);
+
+        assets.insert(assets.end(), std::make_move_iterator(textures.begin()), std::make_move_iterator(textures.end()));
+
+        // Cook the assets that have changed. Each asset is cooked by its own job (and the cooking of a single asset is
+        // parallelized internally as well).
+        auto assets_to_cook = std::vector<Asset *>{};
+        for (auto &asset : assets)
+        {
+            if (asset.requires_cook && !asset.failed)
+            {
+                assets_to_cook.emplace_back(&asset);
+            }
+        }
+
+        core::JobSystem::instance().parallel_for(
+            std::span{assets_to_cook},
+            [&](Asset *asset, const size_t) {
+                try
+                {
+                    asset->record.output_path = cook_asset(*asset);
+                    core::Log::instance().info(std::format("Cooked asset {}", asset->record.source_path));
+                }
+                catch (const std::exception &exception)
+                {
+                    core::Log::instance().error(
+                        std::format("Failed to cook asset {} : {}", asset->record.source_path, exception.what()));
+                    asset->failed = true;
+                }
+            },
+            1u);
+
+        write_database(assets);
+
+        if (pack)
+        {
+            pack_data_directory();
+        }
+
+        const auto failed_asset_count = std::count_if(assets.begin(), assets.end(), [](const Asset &asset) {
+            return asset.failed;
+        });
+
+        const auto end_time = std::chrono::high_resolution_clock::now();
+
+        core::Log::instance().info(std::format(
+            "Cooked {} of {} assets ({} up to date, {} failed) in {} ms", assets_to_cook.size() - failed_asset_count,
+            assets.size(), assets.size() - assets_to_cook.size(), failed_asset_count,
+            std::chrono::duration<float, std::milli>(end_time - start_time).count()));
+
+        return failed_asset_count == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (const std::exception &exception)
+    {
+        core::Log::instance().error(std::format("Asset cooking failed : {}", exception.what()));
+        return EXIT_FAILURE;
+    }
+}
\ No newline at end of file